@@ -0,0 +1,14 @@
+find_path(TRE_INCLUDE_DIR NAMES tre/regex.h)
+
+find_library(TRE_LIBRARY NAMES tre)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(TRE
+    FOUND_VAR TRE_FOUND
+    REQUIRED_VARS TRE_INCLUDE_DIR TRE_LIBRARY
+)
+
+set(TRE_INCLUDE_DIRS ${TRE_INCLUDE_DIR})
+set(TRE_LIBRARIES ${TRE_LIBRARY})
+
+mark_as_advanced(TRE_INCLUDE_DIR TRE_LIBRARY)
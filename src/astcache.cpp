@@ -0,0 +1,326 @@
+/***************************************************************************
+                          astcache.cpp  -  on-disk cache of parsed .pro files
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "includefirst.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <functional>
+#include <sys/stat.h>
+
+#ifdef _MSC_VER
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "astcache.hpp"
+#include "datatypes.hpp"
+#include "str.hpp"
+#include "objects.hpp"
+#include "GDLTokenTypes.hpp"
+
+#ifndef VERSION
+#define VERSION "unknown"
+#endif
+
+using namespace std;
+
+namespace {
+
+  // bump whenever the layout below or the parser output changes
+  const char* cacheMagic = "GDL-AST-CACHE 3 " VERSION;
+
+  const string& CacheDir()
+  {
+    static string dir;
+    static bool init = false;
+    if( !init)
+      {
+	dir = GetEnvString( "GDL_COMPILE_CACHE");
+	if( dir != "") AppendIfNeeded( dir, "/");
+	init = true;
+      }
+    return dir;
+  }
+
+  bool FileStamp( const string& file, DLong64& mTime, DLong64& size)
+  {
+    struct stat st;
+    if( stat( file.c_str(), &st) != 0) return false;
+    mTime = st.st_mtime;
+    size  = st.st_size;
+    return true;
+  }
+
+  string CacheFileName( const string& key)
+  {
+    ostringstream os;
+    os << CacheDir() << hex << std::hash<string>()( key) << ".gdlast";
+    return os.str();
+  }
+
+  // the parser output also depends on the syntax mode: in relaxed mode
+  // (the default) {} and * in array indices are read differently
+  string CacheKey( const string& file, const string& untilPro, bool searchForPro)
+  {
+    return file + (searchForPro ? "\nPRO " : "\nFUNCTION ") + untilPro +
+      (IsRelaxed() ? "\nRELAXED" : "\nSTRICT");
+  }
+
+  // files using @include depend on the content of other files
+  bool HasInclude( const string& file)
+  {
+    ifstream in( file.c_str());
+    string line;
+    while( getline( in, line))
+      {
+	SizeT p = line.find_first_not_of( " \t");
+	if( p != string::npos && line[ p] == '@') return true;
+      }
+    return false;
+  }
+
+  // ------------------------------------------------------------------
+  // binary layout: each sibling list is a sequence of nodes, each
+  // preceded by a 1 byte and terminated by a 0 byte. A node is followed
+  // by the list of its children.
+
+  void PutInt( ostream& os, DLong64 i) { os.write( reinterpret_cast<char*>(&i), sizeof( i));}
+  bool GetInt( istream& is, DLong64& i) { return bool( is.read( reinterpret_cast<char*>(&i), sizeof( i)));}
+
+  void PutString( ostream& os, const string& s)
+  {
+    PutInt( os, s.size());
+    os.write( s.data(), s.size());
+  }
+  bool GetString( istream& is, string& s)
+  {
+    DLong64 n;
+    if( !GetInt( is, n) || n < 0 || n > (1 << 30)) return false;
+    s.resize( n);
+    return n == 0 || bool( is.read( &s[0], n));
+  }
+
+  // only the scalar constants the parser creates (DNode::Text2*)
+  bool PutCData( ostream& os, BaseGDL* c)
+  {
+    if( c == NULL) { PutInt( os, GDL_UNDEF); return true;}
+    if( c->N_Elements() != 1) return false;
+
+    DType t = c->Type();
+    PutInt( os, t);
+    if( t == GDL_STRING)
+      {
+	PutString( os, (*static_cast<DStringGDL*>( c))[ 0]);
+	return true;
+      }
+    if( !NumericType( t)) return false;
+    os.write( static_cast<char*>( c->DataAddr()), c->Sizeof());
+    return true;
+  }
+
+  BaseGDL* GetCData( istream& is, bool& ok)
+  {
+    ok = false;
+    DLong64 t;
+    if( !GetInt( is, t)) return NULL;
+    BaseGDL* c;
+    switch( t)
+      {
+      case GDL_UNDEF: ok = true; return NULL;
+      case GDL_STRING:
+	{
+	  string s;
+	  if( !GetString( is, s)) return NULL;
+	  ok = true;
+	  return new DStringGDL( s);
+	}
+      case GDL_BYTE:      c = new DByteGDL( 0); break;
+      case GDL_INT:       c = new DIntGDL( 0); break;
+      case GDL_UINT:      c = new DUIntGDL( 0); break;
+      case GDL_LONG:      c = new DLongGDL( 0); break;
+      case GDL_ULONG:     c = new DULongGDL( 0); break;
+      case GDL_LONG64:    c = new DLong64GDL( 0); break;
+      case GDL_ULONG64:   c = new DULong64GDL( 0); break;
+      case GDL_FLOAT:     c = new DFloatGDL( 0); break;
+      case GDL_DOUBLE:    c = new DDoubleGDL( 0); break;
+      case GDL_COMPLEX:   c = new DComplexGDL( DComplex( 0)); break;
+      case GDL_COMPLEXDBL:c = new DComplexDblGDL( DComplexDbl( 0)); break;
+      default: return NULL;
+      }
+    if( !is.read( static_cast<char*>( c->DataAddr()), c->Sizeof()))
+      {
+	GDLDelete( c);
+	return NULL;
+      }
+    ok = true;
+    return c;
+  }
+
+} // namespace
+
+// DNode's friend: needs access to the node internals
+class ASTCacheIO
+{
+public:
+  static bool WriteList( ostream& os, RefDNode n)
+  {
+    for( ; n; n = n->GetNextSibling())
+      {
+	os.put( 1);
+	PutInt( os, n->getType());
+	PutString( os, n->getText());
+	PutInt( os, n->lineNumber);
+	PutInt( os, n->initInt);
+	PutInt( os, n->labelStart);
+	PutInt( os, n->labelEnd);
+	if( n->getType() == GDLTokenTypes::CONSTANT)
+	  if( !PutCData( os, n->cData)) return false;
+	// the parser does not resolve any of these
+	if( n->var != NULL || n->libFun != NULL || n->libPro != NULL ||
+	    n->arrIxList != NULL || n->arrIxListNoAssoc != NULL) return false;
+	if( !WriteList( os, n->GetFirstChild())) return false;
+      }
+    os.put( 0);
+    return bool( os);
+  }
+
+  static bool ReadList( istream& is, RefDNode& first)
+  {
+    RefDNode last;
+    for(;;)
+      {
+	char more;
+	if( !is.get( more)) return false;
+	if( more == 0) return true;
+
+	DLong64 type, line, initInt, labelStart, labelEnd;
+	string text;
+	if( !GetInt( is, type) || !GetString( is, text) || !GetInt( is, line) ||
+	    !GetInt( is, initInt) || !GetInt( is, labelStart) || !GetInt( is, labelEnd))
+	  return false;
+
+	RefDNode n = RefDNode( new DNode);
+	n->initialize( type, text);
+	n->SetLine( line);
+	n->initInt = initInt;
+	n->SetLabelRange( labelStart, labelEnd);
+	if( type == GDLTokenTypes::CONSTANT)
+	  {
+	    bool ok;
+	    n->cData = GetCData( is, ok);
+	    if( !ok) return false;
+	  }
+
+	RefDNode child;
+	if( !ReadList( is, child)) return false;
+	if( child)
+	  n->setFirstChild( static_cast<antlr::RefAST>( child));
+
+	if( !last)
+	  first = n;
+	else
+	  last->setNextSibling( static_cast<antlr::RefAST>( n));
+	last = n;
+      }
+  }
+};
+
+ASTCache::IsFunLog* ASTCache::IsFunLog::active = NULL;
+
+bool ASTCache::Enabled()
+{
+  return CacheDir() != "";
+}
+
+RefDNode ASTCache::Load( const string& file,
+			 const string& untilPro, bool searchForPro)
+{
+  RefDNode res;
+  if( !Enabled()) return res;
+
+  DLong64 mTime, size;
+  if( !FileStamp( file, mTime, size)) return res;
+
+  string key = CacheKey( file, untilPro, searchForPro);
+  ifstream in( CacheFileName( key).c_str(), ios::binary);
+  if( !in) return res;
+
+  string magic, storedKey;
+  DLong64 storedMTime, storedSize;
+  if( !GetString( in, magic) || magic != cacheMagic ||
+      !GetString( in, storedKey) || storedKey != key ||
+      !GetInt( in, storedMTime) || storedMTime != mTime ||
+      !GetInt( in, storedSize) || storedSize != size)
+    return res;
+
+  // the entry is only valid for the same known functions
+  DLong64 nAnswers;
+  if( !GetInt( in, nAnswers) || nAnswers < 0) return res;
+  for( DLong64 i=0; i<nAnswers; ++i)
+    {
+      string name;
+      DLong64 isFun;
+      if( !GetString( in, name) || !GetInt( in, isFun)) return res;
+      if( IsFun( name) != (isFun != 0)) return res;
+    }
+
+  RefDNode ast;
+  if( !ASTCacheIO::ReadList( in, ast)) return res;
+  return ast;
+}
+
+void ASTCache::Store( const string& file,
+		      const string& untilPro, bool searchForPro,
+		      const IsFunLog& isFunLog, const RefDNode& ast)
+{
+  if( !Enabled()) return;
+
+  DLong64 mTime, size;
+  if( !FileStamp( file, mTime, size)) return;
+  if( HasInclude( file)) return;
+
+  string key = CacheKey( file, untilPro, searchForPro);
+  string cacheFile = CacheFileName( key);
+  // write to a temporary and rename: concurrent sessions share the cache
+  ostringstream tmpName;
+  tmpName << cacheFile << "." << getpid();
+
+  bool ok;
+  {
+    ofstream out( tmpName.str().c_str(), ios::binary | ios::trunc);
+    if( !out) return;
+    PutString( out, cacheMagic);
+    PutString( out, key);
+    PutInt( out, mTime);
+    PutInt( out, size);
+    PutInt( out, isFunLog.answers.size());
+    for( map<string, bool>::const_iterator it = isFunLog.answers.begin();
+	 it != isFunLog.answers.end(); ++it)
+      {
+	PutString( out, it->first);
+	PutInt( out, it->second);
+      }
+    ok = ASTCacheIO::WriteList( out, ast);
+    out.close();
+    ok = ok && bool( out);
+  }
+  if( !ok || rename( tmpName.str().c_str(), cacheFile.c_str()) != 0)
+    remove( tmpName.str().c_str());
+}
@@ -0,0 +1,76 @@
+/***************************************************************************
+                          astcache.hpp  -  on-disk cache of parsed .pro files
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ASTCACHE_HPP_
+#define ASTCACHE_HPP_
+
+#include <string>
+#include <map>
+
+#include "dnode.hpp"
+
+// Stores the output of GDLParser (the AST which is then handed to
+// GDLTreeParser) for a .pro file, so that unchanged files are not lexed
+// and parsed again by the next GDL session.
+// An entry is keyed by the full file name, the routine compilation was
+// stopped at (see GDLInterpreter::CompileFile()) and the syntax mode
+// (IsRelaxed(), set by --strict or GDL_IS_FUSSY), and validated against
+// the file's mtime and size and the GDL version.
+// The parser's decision between a function call and an array expression
+// for foo(bar) depends on the functions known to the session (IsFun()):
+// the answers it got are stored with the entry, which is only used if the
+// session gives the same answers.
+// The cache is only active if the environment variable GDL_COMPILE_CACHE
+// is set to a (writable) directory.
+class ASTCache
+{
+public:
+  // records the IsFun() answers while a file is parsed
+  class IsFunLog
+  {
+    friend class ASTCache;
+
+    std::map<std::string, bool> answers;
+    IsFunLog* previous;
+
+    static IsFunLog* active;
+
+    IsFunLog( const IsFunLog&);
+    IsFunLog& operator=( const IsFunLog&);
+  public:
+    IsFunLog(): previous( active) { active = this;}
+    ~IsFunLog() { active = previous;}
+  };
+
+  // called by IsFun()
+  static void NoteIsFun( const std::string& name, bool isFun)
+  {
+    if( IsFunLog::active != NULL) IsFunLog::active->answers[ name] = isFun;
+  }
+
+  // returns a NULL RefDNode if there is no valid entry
+  static RefDNode Load( const std::string& file,
+			const std::string& untilPro, bool searchForPro);
+
+  // failures (e.g. a read-only cache directory) are silently ignored
+  static void Store( const std::string& file,
+		     const std::string& untilPro, bool searchForPro,
+		     const IsFunLog& isFunLog, const RefDNode& ast);
+
+  static bool Enabled();
+};
+
+#endif
@@ -45,10 +45,10 @@
 #endif
 
 #include <limits>
+#include <bitset>
 #include <string>
 #include <fstream>
 //#include <memory>
-#include <regex.h> // stregex
 
 #ifdef __APPLE__
 # include <crt_externs.h>
@@ -68,6 +68,8 @@ extern "C" char **environ;
 #include "typedefs.hpp"
 #include "base64.hpp"
 #include "objects.hpp"
+#include "list.hpp"
+#include "gdlregex.hpp"
 //#include "file.hpp"
 
 
@@ -78,6 +80,13 @@ extern "C" char **environ;
 /* max regexp error message length */
 #define MAX_REGEXPERR_LENGTH 80
 
+#ifdef _OPENMP
+#include <omp.h>
+#define GDL_THREAD_NUM omp_get_thread_num()
+#else
+#define GDL_THREAD_NUM 0
+#endif
+
 #ifdef _MSC_VER
 #if _MSC_VER < 1800
 #define std::isfinite _finite
@@ -6762,13 +6771,41 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
     return new DIntGDL( 1);
     } else {
       // Socket
-      string *recvBuf = &fileUnits[ lun-1].RecvBuf();
-      if (recvBuf->size() == 0)
+      if( fileUnits[ lun-1].SocketEof())
     return new DIntGDL( 1);
     }
     return new DIntGDL( 0);
   }
 
+  // 1 if input can be read from the unit without waiting: always for
+  // files, for sockets once data (or the end of the connection) arrived,
+  // waiting at most TIMEOUT seconds (default 0, negative: no limit)
+  BaseGDL* file_poll_input_fun( EnvT* e)
+  {
+    e->NParam( 1);
+
+    DLong lun;
+    e->AssureLongScalarPar( 0, lun);
+
+    DDouble timeout = 0.0;
+    static int timeoutIx = e->KeywordIx( "TIMEOUT");
+    e->AssureDoubleScalarKWIfPresent( timeoutIx, timeout);
+
+    bool stdLun = check_lun( e, lun);
+    if( stdLun)
+      return new DIntGDL( 1);
+
+    GDLStream& unit = fileUnits[ lun-1];
+    if ( unit.SockNum() == -1) {
+      if( !unit.IsOpen())
+    throw GDLIOException( e->CallingNode(), "File unit is not open: "+i2s( lun)+".");
+      return new DIntGDL( 1);
+    }
+    if( unit.SocketAvailable() > 0)
+      return new DIntGDL( 1);
+    return new DIntGDL( unit.SocketWait( timeout) ? 1 : 0);
+  }
+
   BaseGDL* rebin_fun( EnvT* e)
   {
     SizeT nParam = e->NParam( 2);
@@ -7141,6 +7178,221 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
     return dRes->Convert2(GDL_BYTE);
   } 
   
+  // STRTOK, STRSPLIT: splits strings at any of the characters of a pattern
+  // or (REGEX) at the matches of a regular expression; a character
+  // following one of the ESCAPE characters never separates.
+  // Set up once per call, but regexec serializes on a shared regex_t:
+  // every thread needs its own StrTokenizer (and CompiledRegex::Thread).
+  class StrTokenizer
+  {
+    bool sep[256];
+    bool esc[256];
+    bool hasEscape;
+    bool pre0;
+    const regex_t* regexp; // NULL: no REGEX
+    regex_t own;
+    bool owned;
+
+    StrTokenizer( const StrTokenizer&);
+    StrTokenizer& operator=( const StrTokenizer&);
+
+  public:
+    StrTokenizer(): hasEscape( false), pre0( false), regexp( NULL), owned( false) {}
+    ~StrTokenizer() { if( owned) regfree( &own); }
+
+    static DString RegexPattern( const DString& pattern)
+    {
+      if (pattern == " \t") return " "; // regcomp doesn't like "\t" JMG
+      return pattern;
+    }
+
+    static int RegexFlags( bool foldCase)
+    {
+      // set the compile flags to use the REG_ICASE facility in case /FOLD_CASE is given.
+      int cflags = REG_EXTENDED;
+      if (foldCase)
+	cflags |= REG_ICASE;
+      return cflags;
+    }
+
+    // returns the error message for an invalid regular expression, else "";
+    // with REGEX 'compiled' (if not NULL) is the compiled RegexPattern( pattern)
+    string Init( const DString& pattern, bool isRegex, bool foldCase,
+		 const DString& escape, bool preserveNull,
+		 const regex_t* compiled = NULL)
+    {
+      pre0 = preserveNull;
+      std::fill( sep, sep + 256, false);
+      std::fill( esc, esc + 256, false);
+      for( SizeT i = 0; i < escape.length(); ++i)
+	esc[ static_cast<unsigned char>( escape[ i])] = true;
+      hasEscape = !escape.empty();
+
+      if( isRegex) {
+	if( compiled != NULL) {
+	  regexp = compiled;
+	  return "";
+	}
+	DString regexPattern = RegexPattern( pattern);
+	int compRes = regcomp(&own, regexPattern.c_str(), RegexFlags( foldCase));
+	if (compRes) {
+	  char err_msg[MAX_REGEXPERR_LENGTH];
+	  regerror(compRes, &own, err_msg, MAX_REGEXPERR_LENGTH);
+	  return "Error processing regular expression: " +
+	    regexPattern + "\n           " + string(err_msg) + ".";
+	}
+	regexp = &own;
+	owned = true;
+	return "";
+      }
+
+      for( SizeT i = 0; i < pattern.length(); ++i) {
+	unsigned char c = pattern[ i];
+	sep[ c] = true;
+	if( foldCase) sep[ static_cast<unsigned char>( toupper( c))] = true;
+      }
+      return "";
+    }
+
+    // start and length of the tokens of 's'
+    void Split( const DString& s, vector<long>& tokenStart, vector<long>& tokenLen) const
+    {
+      long strLen = s.length();
+      long tokB = 0;
+      if( regexp != NULL) {
+	const char* c = s.c_str();
+	regmatch_t pmatch[1];
+	// an empty match (e.g. "x*") would not advance
+	while( regexec( regexp, c + tokB, 1, pmatch, 0) == 0 && pmatch[0].rm_eo > 0) {
+	  long actLen = pmatch[0].rm_so;
+	  if (actLen > 0 || pre0) {
+	    tokenStart.push_back(tokB);
+	    tokenLen.push_back(actLen);
+	  }
+	  tokB += pmatch[0].rm_eo;
+	}
+      } else {
+	for( long k = 0; k < strLen; ) {
+	  unsigned char c = s[ k];
+	  if( sep[ c]) {
+	    long actLen = k - tokB;
+	    if (actLen > 0 || pre0) {
+	      tokenStart.push_back(tokB);
+	      tokenLen.push_back(actLen);
+	    }
+	    tokB = k + 1;
+	  }
+	  // the escaped character is skipped
+	  k += (hasEscape && esc[ c]) ? 2 : 1;
+	}
+      }
+      long actLen = strLen - tokB;
+      if (actLen > 0 || pre0) {
+	tokenStart.push_back(tokB);
+	tokenLen.push_back(actLen);
+      }
+    }
+
+    // the token at 'start' of 's', escape characters removed
+    void Token( const DString& s, long start, long len, DString& tok) const
+    {
+      if( !hasEscape) {
+	tok.assign( s, start, len);
+	return;
+      }
+      tok.clear();
+      tok.reserve( len);
+      long end = start + len;
+      for( long k = start; k < end; ++k) {
+	if( esc[ static_cast<unsigned char>( s[ k])] && ++k == end) break;
+	tok += s[ k];
+      }
+    }
+  };
+
+  // the keywords of STRTOK and STRSPLIT (both use strtokKey)
+  struct StrTokKeywords
+  {
+    bool extract, countPresent, lengthPresent, pre0, regex, foldCase;
+    int countIx, lengthIx;
+    DString escape;
+
+    StrTokKeywords( EnvT* e)
+    {
+      static int extractIx = e->KeywordIx( "EXTRACT");
+      extract = e->KeywordSet( extractIx);
+
+      static int countIxS = e->KeywordIx( "COUNT");
+      countIx = countIxS;
+      countPresent = e->KeywordPresent( countIx);
+
+      static int lengthIxS = e->KeywordIx( "LENGTH");
+      lengthIx = lengthIxS;
+      lengthPresent = e->KeywordPresent( lengthIx);
+
+      static int pre0Ix = e->KeywordIx("PRESERVE_NULL");
+      pre0 = e->KeywordSet(pre0Ix);
+
+      static int regexIx = e->KeywordIx("REGEX");
+      regex = e->KeywordSet(regexIx);
+
+      static int foldCaseIx = e->KeywordIx( "FOLD_CASE" );
+      foldCase = e->KeywordSet( foldCaseIx );
+      //FOLD_CASE can only be specified if the REGEX keyword is set
+      if (!regex && foldCase)   e->Throw("Conflicting keywords.");
+
+      static int ESCAPEIx=e->KeywordIx("ESCAPE");
+      //ESCAPE cannot be specified with the FOLD_CASE or REGEX keywords.
+      if (regex && e->KeywordPresent(ESCAPEIx))   e->Throw("Conflicting keywords.");
+      if (foldCase && e->KeywordPresent(ESCAPEIx))   e->Throw("Conflicting keywords.");
+      e->AssureStringScalarKWIfPresent(ESCAPEIx, escape);
+    }
+  };
+
+  // the compiled (cached) REGEX pattern of STRTOK, STRSPLIT for 'nThreads'
+  static const CompiledRegex* StrTokRegex( EnvT* e, const DString& pattern,
+					   bool foldCase, SizeT nThreads)
+  {
+    DString regexPattern = StrTokenizer::RegexPattern( pattern);
+    string errMsg;
+    const CompiledRegex* re = RegexCache::Get( regexPattern, StrTokenizer::RegexFlags( foldCase),
+					       nThreads, errMsg);
+    if( re == NULL)
+      e->Throw("Error processing regular expression: " +
+	       regexPattern + "\n           " + errMsg + ".");
+    return re;
+  }
+
+  // the result of STRTOK for the tokens of 's'
+  static BaseGDL* StrTokResult( const StrTokenizer& tok, const DString& s,
+				const vector<long>& tokenStart, const vector<long>& tokenLen,
+				bool extract)
+  {
+    SizeT nTok = tokenStart.size();
+    if (!extract) {
+      if (nTok == 0) return new DLongGDL(0);
+      DLongGDL* d = new DLongGDL(dimension(nTok), BaseGDL::NOZERO);
+      for (SizeT i = 0; i < nTok; i++)
+        (*d)[i] = tokenStart[i];
+      return d;
+    }
+    if (nTok == 0) return new DStringGDL("");
+    DStringGDL *d = new DStringGDL(dimension(nTok));
+    for (SizeT i = 0; i < nTok; i++)
+      tok.Token( s, tokenStart[i], tokenLen[i], (*d)[i]);
+    return d;
+  }
+
+  static DLongGDL* StrTokLength( const vector<long>& tokenLen)
+  {
+    SizeT nTok = tokenLen.size();
+    if (nTok == 0) return new DLongGDL(0);
+    DLongGDL* len = new DLongGDL(dimension(nTok), BaseGDL::NOZERO);
+    for (SizeT i = 0; i < nTok; i++)
+      (*len)[i] = tokenLen[i];
+    return len;
+  }
+
   BaseGDL* strtok_fun(EnvT* e) {
     SizeT nParam = e->NParam(1);
 
@@ -7152,178 +7404,275 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
       e->AssureStringScalarPar(1, pattern);
     }
 
-    static int extractIx = e->KeywordIx( "EXTRACT");
-    bool extract = e->KeywordSet( extractIx);
-
-    static int countIx = e->KeywordIx( "COUNT");
-    bool countPresent = e->KeywordPresent( countIx);
-     
-    static int lengthIx = e->KeywordIx( "LENGTH");
-    bool lengthPresent = e->KeywordPresent( lengthIx);
-
-    static int pre0Ix = e->KeywordIx("PRESERVE_NULL");
-    bool pre0 = e->KeywordSet(pre0Ix);
-
-    static int regexIx = e->KeywordIx("REGEX");
-    bool regex = e->KeywordSet(regexIx);
-    char err_msg[MAX_REGEXPERR_LENGTH];
-    regex_t regexp;
-
-    static int foldCaseIx = e->KeywordIx( "FOLD_CASE" );
-    bool foldCaseKW = e->KeywordSet( foldCaseIx );
-    //FOLD_CASE can only be specified if the REGEX keyword is set
-    if (!regex && foldCaseKW)   e->Throw("Conflicting keywords.");
+    StrTokKeywords kw( e);
 
     vector<long> tokenStart;
     vector<long> tokenLen;
 
-    int strLen = stringIn.length();
-
-    DString escape = "";
-    static int ESCAPEIx=e->KeywordIx("ESCAPE");
-    
-    //ESCAPE cannot be specified with the FOLD_CASE or REGEX keywords.
-    if (regex && e->KeywordPresent(ESCAPEIx))   e->Throw("Conflicting keywords.");
-    if (foldCaseKW && e->KeywordPresent(ESCAPEIx))   e->Throw("Conflicting keywords.");
-
-    e->AssureStringScalarKWIfPresent(ESCAPEIx, escape);
-    vector<long> escList;
-    long pos = 0;
-    while (pos != string::npos) {
-      pos = stringIn.find_first_of(escape, pos);
-      if (pos != string::npos) {
-        escList.push_back(pos + 1); // remember escaped char
-        pos += 2; // skip escaped char
-      }
-    }
-    vector<long>::iterator escBeg = escList.begin();
-    vector<long>::iterator escEnd = escList.end();
-
-    long tokB = 0;
-    long tokE;
-    long nextE = 0;
-    long actLen;
     //special case: pattern void string
     if (pattern.size()==0) {
-      if (lengthPresent) {
-        e->AssureGlobalKW(lengthIx);
-        e->SetKW(lengthIx, new DLongGDL(0));
+      if (kw.lengthPresent) {
+        e->AssureGlobalKW(kw.lengthIx);
+        e->SetKW(kw.lengthIx, new DLongGDL(0));
       }
-     if (countPresent) {
-        e->AssureGlobalKW(countIx);
-        e->SetKW(countIx, new DLongGDL(0));
+     if (kw.countPresent) {
+        e->AssureGlobalKW(kw.countIx);
+        e->SetKW(kw.countIx, new DLongGDL(0));
       }   
-      if (!extract) return new DLongGDL(0); else return new DStringGDL("");
+      if (!kw.extract) return new DLongGDL(0); else return new DStringGDL("");
     }
-      
-    // If regex then compile regex. 
-    // set the compile flags to use the REG_ICASE facility in case /FOLD_CASE is given.
-    int cflags = REG_EXTENDED;
-    if (foldCaseKW)
-      cflags |= REG_ICASE;
 
-    if (regex) {
-      if (pattern == " \t") pattern = " "; // regcomp doesn't like "\t" JMG
-      int compRes = regcomp(&regexp, pattern.c_str(), cflags);
-      if (compRes) {
-        regerror(compRes, &regexp, err_msg, MAX_REGEXPERR_LENGTH);
-        e->Throw("Error processing regular expression: " +
-         pattern + "\n           " + string(err_msg) + ".");
-      }
-    }
+    StrTokenizer tok;
+    if( kw.regex)
+      tok.Init( pattern, true, kw.foldCase, kw.escape, kw.pre0,
+		StrTokRegex( e, pattern, kw.foldCase, 1)->Thread( 0));
+    else
+      tok.Init( pattern, false, kw.foldCase, kw.escape, kw.pre0);
 
-    if (foldCaseKW && !regex) { //duplicate pattern with ascii chars upcased
-      pattern=pattern+StrUpCase(pattern);
+    tok.Split( stringIn, tokenStart, tokenLen);
+
+    SizeT nTok = tokenStart.size();
+    if (kw.countPresent) {
+      e->AssureGlobalKW(kw.countIx);
+      e->SetKW(kw.countIx, new DLongGDL(nTok));
+    }
+    if (kw.lengthPresent) {
+      e->AssureGlobalKW(kw.lengthIx);
+      e->SetKW(kw.lengthIx, StrTokLength( tokenLen));
     }
-    for (;;) {
-      regmatch_t pmatch[1];
-      if (regex) {
-        int matchres = regexec(&regexp, stringIn.c_str() + nextE, 1, pmatch, 0);
-        tokE = matchres ? -1 : pmatch[0].rm_so;
-      } else {
-        tokE = stringIn.find_first_of(pattern, nextE);
-      }
 
-      if (tokE == string::npos) {
-        actLen = strLen - tokB;
-        if (actLen > 0 || pre0) {
-          tokenStart.push_back(tokB);
-          tokenLen.push_back(actLen);
-        }
-        break;
-      }
+    return StrTokResult( tok, stringIn, tokenStart, tokenLen, kw.extract);
+  }
 
-      if (find(escBeg, escEnd, tokE) == escEnd) {
-        if (regex) actLen = tokE;
-        else actLen = tokE - tokB;
-        if (actLen > 0 || pre0) {
-          tokenStart.push_back(tokB);
-          tokenLen.push_back(actLen);
-        }
-        if (regex) tokB += pmatch[0].rm_eo;
-        else tokB = tokE + 1;
-      }
-      if (regex) nextE += pmatch[0].rm_eo;
-      else nextE = tokE + 1;
-    } // for(;;)
+  // a string array is split element by element (in parallel): the result
+  // is a LIST of what STRTOK returns for each element, COUNT an array and
+  // LENGTH a LIST
+  BaseGDL* strsplit_fun( EnvT* e)
+  {
+    SizeT nParam = e->NParam(1);
 
-    if (regex) regfree(&regexp);
+    SizeT nEl = e->GetParDefined(0)->N_Elements();
+    if( nEl <= 1) return strtok_fun( e);
 
-    SizeT nTok = tokenStart.size();
-    if (countPresent) {
-        e->AssureGlobalKW(countIx);
-         if (nTok > 0) {
-          DLongGDL* count = new DLongGDL(nTok);
-          e->SetKW(countIx, count);
-        } else {
-          e->SetKW(countIx, new DLongGDL(0));
-        }
-      }
-     
-      if (lengthPresent) {
-        e->AssureGlobalKW(lengthIx);
+    StrTokKeywords kw( e);
 
-        if (nTok > 0) {
-          dimension dim(nTok);
-          DLongGDL* len = new DLongGDL(dim);
-          for (int i = 0; i < nTok; i++)
-            (*len)[i] = tokenLen[i];
+    DStringGDL* strIn = e->GetParAs<DStringGDL>(0);
 
-          e->SetKW(lengthIx, len);
-        } else {
-          e->SetKW(lengthIx, new DLongGDL(0));
-        }
-      }
-    
-    if (!extract) {
+    DString pattern = " \t";
+    DStringGDL* patterns = NULL; // one per element
+    if (nParam > 1) {
+      DStringGDL* p1 = e->GetParAs<DStringGDL>(1);
+      SizeT nPat = p1->N_Elements();
+      if( nPat == 1) pattern = (*p1)[0];
+      else if( nPat == nEl) patterns = p1;
+      else e->Throw( "PATTERN must be a scalar or have the same number of elements as STRING.");
+    }
 
-      if (nTok == 0) return new DLongGDL(0);
+    if (kw.countPresent) e->AssureGlobalKW(kw.countIx);
+    if (kw.lengthPresent) e->AssureGlobalKW(kw.lengthIx);
 
-      dimension dim(nTok);
-      DLongGDL* d = new DLongGDL(dim);
-      for (int i = 0; i < nTok; i++)
-        (*d)[i] = tokenStart[i];
-      return d;
-    } else {
+    bool parallelize = ((nEl*10) >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl*10)));
+    const CompiledRegex* compiled = NULL;
+    if( kw.regex && patterns == NULL && !pattern.empty())
+      compiled = StrTokRegex( e, pattern, kw.foldCase, parallelize ? CpuTPOOL_NTHREADS : 1);
 
-    // EXTRACT
-    if (nTok == 0) return new DStringGDL("");
+    vector<BaseGDL*> res( nEl, NULL);
+    vector<BaseGDL*> len( kw.lengthPresent ? nEl : 0, NULL);
+    DLongGDL* count = new DLongGDL( dimension( nEl), BaseGDL::NOZERO);
+    Guard<DLongGDL> countGuard( count);
+    string errMsg;
 
-    dimension dim(nTok);
-    DStringGDL *d = new DStringGDL(dim);
-    for (int i = 0; i < nTok; i++) {
-      (*d)[i] = stringIn.substr(tokenStart[i], tokenLen[i]);
+#pragma omp parallel num_threads(CpuTPOOL_NTHREADS) if (parallelize)
+    {
+      vector<long> tokenStart;
+      vector<long> tokenLen;
+      StrTokenizer common;
+      if( patterns == NULL && !pattern.empty())
+	common.Init( pattern, kw.regex, kw.foldCase, kw.escape, kw.pre0,
+		     compiled != NULL ? compiled->Thread( GDL_THREAD_NUM) : NULL);
+#pragma omp for
+      for( OMPInt i = 0; i < nEl; ++i) {
+	const DString& actPattern = (patterns == NULL) ? pattern : (*patterns)[i];
+	tokenStart.clear();
+	tokenLen.clear();
+	if( actPattern.empty()) {
+	  res[i] = kw.extract ? static_cast<BaseGDL*>( new DStringGDL("")) : new DLongGDL(0);
+	} else if( patterns == NULL) {
+	  common.Split( (*strIn)[i], tokenStart, tokenLen);
+	  res[i] = StrTokResult( common, (*strIn)[i], tokenStart, tokenLen, kw.extract);
+	} else {
+	  StrTokenizer tok;
+	  string actErr = tok.Init( actPattern, kw.regex, kw.foldCase, kw.escape, kw.pre0);
+	  if( !actErr.empty()) {
+#pragma omp critical(strsplit_error)
+	    if( errMsg.empty()) errMsg = actErr;
+	    continue;
+	  }
+	  tok.Split( (*strIn)[i], tokenStart, tokenLen);
+	  res[i] = StrTokResult( tok, (*strIn)[i], tokenStart, tokenLen, kw.extract);
+	}
+	(*count)[i] = tokenStart.size();
+	if( kw.lengthPresent) len[i] = StrTokLength( tokenLen);
+      }
+    }
+
+    if( !errMsg.empty()) {
+      for( SizeT i = 0; i < nEl; ++i) {
+	GDLDelete( res[i]);
+	if( kw.lengthPresent) GDLDelete( len[i]);
+      }
+      e->Throw( errMsg);
+    }
+
+    if (kw.countPresent) e->SetKW(kw.countIx, countGuard.release());
+    if (kw.lengthPresent) e->SetKW(kw.lengthIx, NewLIST( len));
+    return NewLIST( res);
+  }
+
+  // STRMATCH: a wildcard pattern, '*' matches any (also empty) string,
+  // '?' any character, [...] one of the enclosed characters or ranges
+  // (a-z), [!...] any other character; '\' quotes the next character
+  class StrGlob
+  {
+    enum { LITERAL, ANY, STAR, SET };
+    struct Item
+    {
+      int kind;
+      unsigned char c; // LITERAL
+      SizeT set;       // SET: index in sets
+    };
+    vector<Item> items;
+    vector<std::bitset<256> > sets;
+    bool fold;
+
+    void Add( int kind, unsigned char c = 0, SizeT set = 0)
+    {
+      Item item = { kind, c, set };
+      items.push_back( item);
+    }
 
-      // remove escape
-      DString& act = (*d)[i];
-      long escPos = act.find_first_of(escape, 0);
-      while (escPos != string::npos) {
-        act = act.substr(0, escPos) + act.substr(escPos + 1);
-        escPos = act.find_first_of(escape, escPos + 1);
+    // the set [...] starting at pattern[ i] ('['), returns the position
+    // after the closing ']' (0 if there is none: '[' is literal then)
+    SizeT AddSet( const DString& pattern, SizeT i)
+    {
+      SizeT n = pattern.length();
+      SizeT j = i + 1;
+      bool negate = (j < n && (pattern[ j] == '!' || pattern[ j] == '^'));
+      if( negate) ++j;
+      SizeT first = j;
+      if( j < n && pattern[ j] == ']') ++j; // a leading ']' is literal
+      while( j < n && pattern[ j] != ']') ++j;
+      if( j >= n) return 0;
+
+      std::bitset<256> set;
+      for( SizeT k = first; k < j; ++k) {
+	unsigned char lo = pattern[ k];
+	unsigned char hi = lo;
+	if( k + 2 < j && pattern[ k + 1] == '-') {
+	  hi = pattern[ k + 2];
+	  k += 2;
+	}
+	for( unsigned c = lo; c <= hi; ++c) {
+	  set.set( c);
+	  if( fold) {
+	    set.set( static_cast<unsigned char>( tolower( c)));
+	    set.set( static_cast<unsigned char>( toupper( c)));
+	  }
+	}
+      }
+      if( negate) set.flip();
+      sets.push_back( set);
+      Add( SET, 0, sets.size() - 1);
+      return j + 1;
+    }
+
+    bool One( const Item& item, unsigned char c) const
+    {
+      switch( item.kind) {
+      case LITERAL:
+	return item.c == c || (fold && tolower( item.c) == tolower( c));
+      case SET:
+	return sets[ item.set].test( c);
+      default: // ANY
+	return true;
       }
     }
-    return d;
+
+  public:
+    StrGlob( const DString& pattern, bool foldCase): fold( foldCase)
+    {
+      SizeT n = pattern.length();
+      for( SizeT i = 0; i < n; ) {
+	char c = pattern[ i];
+	if( c == '\\' && i + 1 < n) {
+	  Add( LITERAL, pattern[ i + 1]);
+	  i += 2;
+	  continue;
+	}
+	if( c == '[') {
+	  SizeT next = AddSet( pattern, i);
+	  if( next != 0) {
+	    i = next;
+	    continue;
+	  }
+	}
+	if( c == '*') {
+	  if( items.empty() || items.back().kind != STAR) Add( STAR);
+	} else if( c == '?')
+	  Add( ANY);
+	else
+	  Add( LITERAL, c);
+	++i;
+      }
+    }
+
+    bool Match( const DString& s) const
+    {
+      SizeT n = s.length();
+      SizeT m = items.size();
+      SizeT si = 0, pi = 0;
+      bool star = false; // a '*' was seen
+      SizeT starPi = 0;  // after the last '*'
+      SizeT starSi = 0;  // where it started to match
+      while( si < n) {
+	if( pi < m && items[ pi].kind == STAR) {
+	  star = true;
+	  starPi = ++pi;
+	  starSi = si;
+	} else if( pi < m && One( items[ pi], s[ si])) {
+	  ++pi;
+	  ++si;
+	} else if( star) {
+	  // let the last '*' match one more character
+	  pi = starPi;
+	  si = ++starSi;
+	} else
+	  return false;
+      }
+      while( pi < m && items[ pi].kind == STAR) ++pi;
+      return pi == m;
     }
+  };
+
+  BaseGDL* strmatch_fun( EnvT* e)
+  {
+    e->NParam(2);
+
+    DStringGDL* strIn = e->GetParAs<DStringGDL>(0);
+    if( e->GetParDefined(1)->Rank() != 0)
+      e->Throw( "Search string must be a scalar.");
+    DString search;
+    e->AssureStringScalarPar(1, search);
+
+    static int foldCaseIx = e->KeywordIx( "FOLD_CASE");
+    StrGlob glob( search, e->KeywordSet( foldCaseIx));
+
+    SizeT nEl = strIn->N_Elements();
+    DByteGDL* res = new DByteGDL( strIn->Dim(), BaseGDL::NOZERO);
+#pragma omp parallel for if ((nEl*10) >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl*10)))
+    for( OMPInt i = 0; i < nEl; ++i)
+      (*res)[i] = glob.Match( (*strIn)[i]) ? 1 : 0;
+    return res;
   }
 
   BaseGDL* getenv_fun( EnvT* e)
@@ -7482,8 +7831,6 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
     if( booleanKW && (subexprKW || extractKW || lengthKW))
       e->Throw( "Conflicting keywords.");
   
-    char err_msg[MAX_REGEXPERR_LENGTH];
-
     // set the compile flags 
     int cflags = REG_EXTENDED;
     if (foldCaseKW)
@@ -7491,18 +7838,18 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
     if (booleanKW)
       cflags |= REG_NOSUB;
 
-    // compile the regular expression
-    regex_t regexp;
-    int compRes = regcomp( &regexp, pattern.c_str(), cflags);
-    SizeT nSubExpr = regexp.re_nsub + 1;
-    
-    //    cout << regexp.re_nsub << endl;
+    SizeT nEl = dim.NDimElements();
+    bool parallelize = ((nEl*10) >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl*10)));
 
-    if (compRes) {
-      regerror(compRes, &regexp, err_msg, MAX_REGEXPERR_LENGTH);
+    // compile the regular expression (or take it from the cache)
+    string errMsg;
+    const CompiledRegex* regexp = RegexCache::Get( pattern, cflags,
+						   parallelize ? CpuTPOOL_NTHREADS : 1, errMsg);
+    if (regexp == NULL) {
       e->Throw( "Error processing regular expression: "+
-        pattern+"\n           "+string(err_msg)+".");
+        pattern+"\n           "+errMsg+".");
     }
+    SizeT nSubExpr = regexp->NSubExpr();
 
     BaseGDL* result;
 
@@ -7546,11 +7893,15 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
     int nmatch = 1;
     if( subexprKW) nmatch = nSubExpr;
 
-    regmatch_t* pmatch = new regmatch_t[nSubExpr];
-    ArrayGuard<regmatch_t> pmatchGuard( pmatch);
+    // the elements are independent: each thread matches with its own regex_t
+#pragma omp parallel num_threads(CpuTPOOL_NTHREADS) if (parallelize)
+    {
+    const regex_t* re = regexp->Thread( GDL_THREAD_NUM);
+    vector<regmatch_t> pmatch( nSubExpr);
 
     //    cout << "dim " << dim.NDimElements() << endl;     
-    for( SizeT s=0; s<dim.NDimElements(); ++s)
+#pragma omp for
+    for( OMPInt s=0; s<nEl; ++s)
       {
     int eflags = 0; 
 
@@ -7558,7 +7909,7 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
       pmatch[sE].rm_so = -1;
 
     // now match towards the string
-    int matchres = regexec( &regexp, (*stringExpr)[s].c_str(),  nmatch, pmatch, eflags);
+    int matchres = regexec( re, (*stringExpr)[s].c_str(),  nmatch, &pmatch[0], eflags);
 
     // subexpressions
     if ( extractKW && subexprKW) {
@@ -7566,18 +7917,14 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
       // Loop through subexpressions & fill output array
       for( SizeT i = 0; i<nSubExpr; ++i) {
         if (pmatch[i].rm_so != -1)
-          (*static_cast<DStringGDL*>(result))[i+s*nSubExpr] =
-        (*stringExpr)[s].substr( pmatch[i].rm_so,  pmatch[i].rm_eo - pmatch[i].rm_so);
-        //          (*stringExpr)[i+s*nSubExpr].substr( pmatch[i].rm_so,  pmatch[i].rm_eo - pmatch[i].rm_so);
+          (*static_cast<DStringGDL*>(result))[i+s*nSubExpr].assign(
+        (*stringExpr)[s], pmatch[i].rm_so,  pmatch[i].rm_eo - pmatch[i].rm_so);
         if( lengthKW)
           (*len)[i+s*nSubExpr] = pmatch[i].rm_so != -1 ? pmatch[i].rm_eo - pmatch[i].rm_so : -1;
-        //            (*len)[i+s*nSubExpr] = pmatch[i].rm_eo - pmatch[i].rm_so;
       }
     }
     else  if ( subexprKW) 
       {
-        //      cout << "je ne comprends pas v2: "<< nSubExpr << endl;
-
         // Loop through subexpressions & fill output array
         for( SizeT i = 0; i<nSubExpr; ++i) {
           (* static_cast<DLongGDL*>(result))[i+s*nSubExpr] =  pmatch[i].rm_so;
@@ -7592,8 +7939,8 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
         else if ( extractKW) // !subExprKW
           {
         if( matchres == 0)
-          (* static_cast<DStringGDL*>(result))[s] = 
-            (*stringExpr)[s].substr( pmatch[0].rm_so, 
+          (* static_cast<DStringGDL*>(result))[s].assign(
+            (*stringExpr)[s], pmatch[0].rm_so, 
                          pmatch[0].rm_eo - pmatch[0].rm_so);
           }
         else
@@ -7605,8 +7952,7 @@ template <typename Ty, typename T2>  static inline Ty do_mean_cpx_nan(const Ty*
       (*len)[s] = pmatch[0].rm_so != -1 ? pmatch[0].rm_eo - pmatch[0].rm_so : -1;
 
       }
-
-    regfree( &regexp);
+    }
 
     if( lengthKW)
       e->SetKW( lengthIx, len);    
@@ -7975,16 +8321,22 @@ BaseGDL* routine_filepath( EnvT* e)
     static int Ix_kw_num_alloc = e->KeywordIx("NUM_ALLOC");
     static int Ix_kw_num_free  = e->KeywordIx("NUM_FREE");
     static int Ix_kw_highwater = e->KeywordIx("HIGHWATER");
+    // GDL extension: reuse statistics of large array buffers (see gdlbufferpool.hpp)
+    static int Ix_kw_pool_hits   = e->KeywordIx("POOL_HITS");
+    static int Ix_kw_pool_misses = e->KeywordIx("POOL_MISSES");
 
     bool kw_current =   e->KeywordSet( Ix_kw_current  );
     bool kw_num_alloc = e->KeywordSet( Ix_kw_num_alloc);
     bool kw_num_free =  e->KeywordSet( Ix_kw_num_free );
     bool kw_highwater = e->KeywordSet( Ix_kw_highwater);
+    bool kw_pool_hits = e->KeywordSet( Ix_kw_pool_hits);
+    bool kw_pool_misses = e->KeywordSet( Ix_kw_pool_misses);
 
     // Following the IDL documentation: mutually exclusive keywords
     // IDL behaves different, incl. segfaults with selected kw combinations
-    if (kw_current + kw_num_alloc + kw_num_free + kw_highwater > 1) 
-      e->Throw("CURRENT, NUM_ALLOC, NUM_FREE & HIGHWATER keywords"
+    if (kw_current + kw_num_alloc + kw_num_free + kw_highwater
+	+ kw_pool_hits + kw_pool_misses > 1) 
+      e->Throw("CURRENT, NUM_ALLOC, NUM_FREE, HIGHWATER, POOL_HITS & POOL_MISSES keywords"
            " are mutually exclusive");
 
     if (kw_current)
@@ -8007,6 +8359,16 @@ BaseGDL* routine_filepath( EnvT* e)
         if (kw_l64) ret = new DLong64GDL(MemStats::GetHighWater());
         else ret = new DLongGDL(MemStats::GetHighWater());
       }
+    else if (kw_pool_hits)
+      {
+        if (kw_l64) ret = new DLong64GDL(BufferPool::GetHits());
+        else ret = new DLongGDL(BufferPool::GetHits());
+      }
+    else if (kw_pool_misses)
+      {
+        if (kw_l64) ret = new DLong64GDL(BufferPool::GetMisses());
+        else ret = new DLongGDL(BufferPool::GetMisses());
+      }
     else 
       {
         // returning 4-element array 
@@ -124,6 +124,7 @@ namespace lib {
   BaseGDL* arg_present( EnvT* e);
 
   BaseGDL* eof_fun( EnvT* e);
+  BaseGDL* file_poll_input_fun( EnvT* e);
 
   BaseGDL* strjoin( EnvT* e);
 
@@ -149,7 +150,9 @@ namespace lib {
 
   // the following by Peter Messmer 
   // (messmer@users.sourceforge.net)
-  BaseGDL* strtok_fun( EnvT* e); // strsplit
+  BaseGDL* strtok_fun( EnvT* e);
+  BaseGDL* strsplit_fun( EnvT* e);
+  BaseGDL* strmatch_fun( EnvT* e);
   BaseGDL* getenv_fun( EnvT* e);
   BaseGDL* tag_names_fun( EnvT* e);
   BaseGDL* stregex_fun( EnvT* e);
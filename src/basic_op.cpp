@@ -55,7 +55,7 @@ Data_<Sp>* Data_<Sp>::NotOp()
 
   //  if( !nEl) throw GDLException("Variable is undefined.");  
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
   {
 #pragma omp for
     for( OMPInt i=0; i < nEl; ++i)
@@ -77,7 +77,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::NotOp()
     }
 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -96,7 +96,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::NotOp()
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -149,7 +149,7 @@ BaseGDL* Data_<Sp>::UMinus()
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -196,7 +196,7 @@ Data_<SpDByte>* Data_<Sp>::LogNeg()
     }
   
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -230,7 +230,7 @@ Data_<SpDByte>* Data_<SpDObj>::LogNeg()
     }
   
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -251,7 +251,7 @@ Data_<SpDByte>* Data_<SpDFloat>::LogNeg()
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -272,7 +272,7 @@ Data_<SpDByte>* Data_<SpDDouble>::LogNeg()
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -292,7 +292,7 @@ Data_<SpDByte>* Data_<SpDString>::LogNeg()
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -312,7 +312,7 @@ Data_<SpDByte>* Data_<SpDComplex>::LogNeg()
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -332,7 +332,7 @@ Data_<SpDByte>* Data_<SpDComplexDbl>::LogNeg()
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -354,7 +354,7 @@ void Data_<Sp>::Dec()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -372,7 +372,7 @@ void Data_<Sp>::Inc()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -392,7 +392,7 @@ void Data_<SpDFloat>::Dec()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -411,7 +411,7 @@ void Data_<SpDFloat>::Inc()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -431,7 +431,7 @@ void Data_<SpDDouble>::Dec()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -450,7 +450,7 @@ void Data_<SpDDouble>::Inc()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -470,7 +470,7 @@ void Data_<SpDComplex>::Dec()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -489,7 +489,7 @@ void Data_<SpDComplex>::Inc()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -508,7 +508,7 @@ void Data_<SpDComplexDbl>::Dec()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -527,7 +527,7 @@ void Data_<SpDComplexDbl>::Inc()
       return;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -596,7 +596,7 @@ BaseGDL* Data_<Sp>::EqOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -611,7 +611,7 @@ BaseGDL* Data_<Sp>::EqOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -621,7 +621,7 @@ BaseGDL* Data_<Sp>::EqOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -636,7 +636,7 @@ BaseGDL* Data_<Sp>::EqOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -772,7 +772,7 @@ BaseGDL* Data_<SpDObj>::EqOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -787,7 +787,7 @@ BaseGDL* Data_<SpDObj>::EqOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -797,7 +797,7 @@ BaseGDL* Data_<SpDObj>::EqOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -812,7 +812,7 @@ BaseGDL* Data_<SpDObj>::EqOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -862,7 +862,7 @@ BaseGDL* Data_<Sp>::NeOp( BaseGDL* r)
 	}
 
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -877,7 +877,7 @@ BaseGDL* Data_<Sp>::NeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -887,7 +887,7 @@ BaseGDL* Data_<Sp>::NeOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -902,7 +902,7 @@ BaseGDL* Data_<Sp>::NeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1034,7 +1034,7 @@ BaseGDL* Data_<SpDObj>::NeOp( BaseGDL* r)
 	}
 
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1049,7 +1049,7 @@ BaseGDL* Data_<SpDObj>::NeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1059,7 +1059,7 @@ BaseGDL* Data_<SpDObj>::NeOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1074,7 +1074,7 @@ BaseGDL* Data_<SpDObj>::NeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1124,7 +1124,7 @@ BaseGDL* Data_<Sp>::LeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1139,7 +1139,7 @@ BaseGDL* Data_<Sp>::LeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1149,7 +1149,7 @@ BaseGDL* Data_<Sp>::LeOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1164,7 +1164,7 @@ BaseGDL* Data_<Sp>::LeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1225,7 +1225,7 @@ BaseGDL* Data_<Sp>::LtOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1240,7 +1240,7 @@ BaseGDL* Data_<Sp>::LtOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1250,7 +1250,7 @@ BaseGDL* Data_<Sp>::LtOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1265,7 +1265,7 @@ BaseGDL* Data_<Sp>::LtOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1326,7 +1326,7 @@ BaseGDL* Data_<Sp>::GeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1341,7 +1341,7 @@ BaseGDL* Data_<Sp>::GeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1351,7 +1351,7 @@ BaseGDL* Data_<Sp>::GeOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1366,7 +1366,7 @@ BaseGDL* Data_<Sp>::GeOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1427,7 +1427,7 @@ BaseGDL* Data_<Sp>::GtOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1442,7 +1442,7 @@ BaseGDL* Data_<Sp>::GtOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1452,7 +1452,7 @@ BaseGDL* Data_<Sp>::GtOp( BaseGDL* r)
     {
       res= new Data_<SpDByte>( right->dim, BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -1467,7 +1467,7 @@ BaseGDL* Data_<Sp>::GtOp( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1654,7 +1654,7 @@ Data_<Sp>* Data_<Sp>::MatrixOp( BaseGDL* r, bool atranspose, bool btranspose)
       SizeT nOp = nRow * nCol;
 #endif
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
+#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
 	{
 #pragma omp for 
 	  for( OMPInt colA=0; colA < nCol; colA++)   // res dim 0
@@ -1703,7 +1703,7 @@ Data_<Sp>* Data_<Sp>::MatrixOp( BaseGDL* r, bool atranspose, bool btranspose)
 	  if( !bt) // normal
 	    {
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
+#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
 		{
 #pragma omp for
 		  for( OMPInt colA=0; colA < nCol; ++colA) // res dim 0
@@ -1720,7 +1720,7 @@ Data_<Sp>* Data_<Sp>::MatrixOp( BaseGDL* r, bool atranspose, bool btranspose)
 	  else // transpose r
 	    {
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
+#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
 		{
 #pragma omp for
 		  for( OMPInt colA=0; colA < nCol; ++colA) // res dim 0
@@ -1739,7 +1739,7 @@ Data_<Sp>* Data_<Sp>::MatrixOp( BaseGDL* r, bool atranspose, bool btranspose)
 	  if( !bt) // normal
 	    {
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
+#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
 		{
 #pragma omp for
 		  for( OMPInt colA=0; colA < nCol; ++colA) // res dim 0
@@ -1758,7 +1758,7 @@ Data_<Sp>* Data_<Sp>::MatrixOp( BaseGDL* r, bool atranspose, bool btranspose)
 	  else // transpose r
 	    {
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
+#pragma omp parallel if (nOp >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nOp)) default(shared)
 		{
 #pragma omp for
 		  for( OMPInt colA=0; colA < nCol; ++colA) // res dim 0
@@ -1828,7 +1828,7 @@ Data_<Sp>* Data_<Sp>::AndOp( BaseGDL* r)
   // note: we can't use valarray operation here as right->dd 
   // might be larger than this->dd
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1858,7 +1858,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::AndOp( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1882,7 +1882,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::AndOpInv( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1906,7 +1906,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::AndOp( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1930,7 +1930,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::AndOpInv( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2016,7 +2016,7 @@ Data_<Sp>* Data_<Sp>::AndOpS( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared(s)
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared(s)
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2079,7 +2079,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::AndOpInvS( BaseGDL* r)
 	  return this;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2135,7 +2135,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::AndOpInvS( BaseGDL* r)
 	  return this;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2202,7 +2202,7 @@ Data_<Sp>* Data_<Sp>::OrOp( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2234,7 +2234,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOp( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2258,7 +2258,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOpInv( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2283,7 +2283,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOp( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2307,7 +2307,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOpInv( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2367,7 +2367,7 @@ Data_<Sp>* Data_<Sp>::OrOpS( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2400,7 +2400,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOpS( BaseGDL* r)
 	  return this;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2435,7 +2435,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOpInvS( BaseGDL* r)
 	  return this;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2461,7 +2461,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOpS( BaseGDL* r)
 	  return this;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2495,7 +2495,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOpInvS( BaseGDL* r)
 	  return this;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2561,7 +2561,7 @@ Data_<Sp>* Data_<Sp>::XorOp( BaseGDL* r)
 	//	dd ^= s;
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i < nEl; ++i)
@@ -2571,7 +2571,7 @@ Data_<Sp>* Data_<Sp>::XorOp( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2638,7 +2638,7 @@ Data_<Sp>* Data_<Sp>::XorOpS( BaseGDL* r)
   Ty s = (*right)[0];
   //  dd ^= s;
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2713,7 +2713,7 @@ Data_<Sp>* Data_<Sp>::LtMark( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2767,7 +2767,7 @@ Data_<Sp>* Data_<Sp>::LtMarkS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s);
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2825,7 +2825,7 @@ Data_<Sp>* Data_<Sp>::GtMark( BaseGDL* r)
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2880,7 +2880,7 @@ Data_<Sp>* Data_<Sp>::GtMarkS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s);
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2945,7 +2945,7 @@ Data_<Sp>* Data_<Sp>::Mod( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 	  //       bool zeroEncountered = false;
 #pragma omp for
@@ -2990,7 +2990,7 @@ Data_<Sp>* Data_<Sp>::ModInv( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 	  //       bool zeroEncountered = false;
 #pragma omp for
@@ -3031,7 +3031,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::Mod( BaseGDL* r)
   assert( nEl);
   //  if( !rEl || !nEl) throw GDLException("Variable is undefined.");  
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3051,7 +3051,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::ModInv( BaseGDL* r)
   assert( nEl);
   //  if( !rEl || !nEl) throw GDLException("Variable is undefined.");  
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3079,7 +3079,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::Mod( BaseGDL* r)
   assert( nEl);
   //  if( !rEl || !nEl) throw GDLException("Variable is undefined.");  
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3099,7 +3099,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::ModInv( BaseGDL* r)
   assert( nEl);
   //  if( !rEl || !nEl) throw GDLException("Variable is undefined.");  
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3251,7 +3251,7 @@ Data_<Sp>* Data_<Sp>::ModInvS( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  //       bool zeroEncountered = false;
@@ -3285,7 +3285,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::ModS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s); 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3305,7 +3305,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::ModInvS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s); 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3323,7 +3323,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::ModS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s);
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3342,7 +3342,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::ModInvS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s); 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3452,7 +3452,7 @@ Data_<Sp>* Data_<Sp>::Pow( BaseGDL* r)
   assert( nEl);
   //  if( !rEl || !nEl) throw GDLException("Variable is undefined.");  
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3475,7 +3475,7 @@ Data_<Sp>* Data_<Sp>::PowInv( BaseGDL* r)
   //      dd = pow( right->Resize(nEl), dd); // valarray
       
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3501,7 +3501,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::Pow( BaseGDL* r)
       else*/
   {
     TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       {
 #pragma omp for
 	for( OMPInt i=0; i < nEl; ++i)
@@ -3531,7 +3531,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowInt( BaseGDL* r)
     {
       DLong r0 = (*right)[0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -3543,7 +3543,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowInt( BaseGDL* r)
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       Ty s0 = (*this)[ 0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -3553,7 +3553,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowInt( BaseGDL* r)
   if( nEl <= rEl)
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -3564,7 +3564,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowInt( BaseGDL* r)
     {
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -3586,7 +3586,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowInt( BaseGDL* r)
     {
       DLong r0 = (*right)[0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -3598,7 +3598,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowInt( BaseGDL* r)
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       Ty s0 = (*this)[ 0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -3608,7 +3608,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowInt( BaseGDL* r)
   if( nEl <= rEl)
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -3619,7 +3619,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowInt( BaseGDL* r)
     {
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -3644,7 +3644,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowInv( BaseGDL* r)
       dd = pow( right->dd, dd); // valarray
       else*/
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3669,7 +3669,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::Pow( BaseGDL* r)
       dd = pow( dd, right->dd); // valarray
       else*/
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3694,7 +3694,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowInv( BaseGDL* r)
       dd = pow( right->dd, dd); // valarray
       else*/
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3723,7 +3723,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -3742,7 +3742,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -3752,7 +3752,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3765,7 +3765,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3787,7 +3787,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -3806,7 +3806,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -3816,7 +3816,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3829,7 +3829,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3857,7 +3857,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::Pow( BaseGDL* r)
       dd = pow( dd, right->dd); // valarray
       else*/
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3888,7 +3888,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowInv( BaseGDL* r)
       dd = pow( right->dd, dd); // valarray
       else*/
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3918,7 +3918,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -3937,7 +3937,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -3947,7 +3947,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3960,7 +3960,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3984,7 +3984,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -4003,7 +4003,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -4013,7 +4013,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -4026,7 +4026,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -4054,7 +4054,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::Pow( BaseGDL* r)
       dd = pow( dd, right->dd); // valarray
       else*/
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -4085,7 +4085,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowInv( BaseGDL* r)
       dd = pow( right->dd, dd); // valarray
       else*/
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -4144,7 +4144,7 @@ Data_<Sp>* Data_<Sp>::PowS( BaseGDL* r)
   // right->Scalar(s); 
 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -4166,7 +4166,7 @@ Data_<Sp>* Data_<Sp>::PowInvS( BaseGDL* r)
   // right->Scalar(s); 
   //      dd = pow( s, d); // valarray
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -4185,7 +4185,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s); 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)	
@@ -4204,7 +4204,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowInvS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s); 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)	
@@ -4223,7 +4223,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s); 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)	
@@ -4242,7 +4242,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowInvS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s); 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)	
@@ -4271,7 +4271,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -4290,7 +4290,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -4300,7 +4300,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -4313,7 +4313,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -4335,7 +4335,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -4354,7 +4354,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -4364,7 +4364,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -4377,7 +4377,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -4398,7 +4398,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowS( BaseGDL* r)
   // right->Scalar(s); 
   //#if (__GNUC__ == 3) && (__GNUC_MINOR__ <= 2)
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
@@ -4426,7 +4426,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowInvS( BaseGDL* r)
   // right->Scalar(s); 
   //#if (__GNUC__ == 3) && (__GNUC_MINOR__ <= 2)
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
@@ -4459,7 +4459,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -4478,7 +4478,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -4488,7 +4488,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -4501,7 +4501,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -4525,7 +4525,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
       if( right->StrictScalar(s)) 
 	{
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -4544,7 +4544,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -4554,7 +4554,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
 		}
 
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -4567,7 +4567,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -4588,7 +4588,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowS( BaseGDL* r)
   // right->Scalar(s); 
   //#if (__GNUC__ == 3) && (__GNUC_MINOR__ <= 2)
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
@@ -4613,7 +4613,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowInvS( BaseGDL* r)
   // right->Scalar(s); 
   //#if (__GNUC__ == 3) && (__GNUC_MINOR__ <= 2)
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
@@ -58,7 +58,7 @@ BaseGDL* Data_<Sp>::Add( BaseGDL* r)
 #else
 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -90,7 +90,7 @@ BaseGDL* Data_<SpDString>::AddInv( BaseGDL* r)
     }
   //  if( !rEl || !nEl) throw GDLException("Variable is undefined.");  
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -321,7 +321,7 @@ BaseGDL* Data_<Sp>::AddS( BaseGDL* r)
 	return this;
 #else
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -348,7 +348,7 @@ BaseGDL* Data_<SpDString>::AddS( BaseGDL* r)
   // right->Scalar(s);
   //  dd += s;
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -378,7 +378,7 @@ BaseGDL* Data_<SpDString>::AddInvS( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s);
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -58,7 +58,7 @@ Data_<Sp>* Data_<Sp>::Div( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 	  //       bool zeroEncountered = false; // until zero operation is already done.
 #pragma omp for
@@ -98,7 +98,7 @@ Data_<Sp>* Data_<Sp>::DivInv( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 	  //       bool zeroEncountered = false; // until zero operation is already done.
 #pragma omp for
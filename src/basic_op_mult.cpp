@@ -54,7 +54,7 @@ Data_<Sp>* Data_<Sp>::Mult( BaseGDL* r)
   return this;
 #else
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -106,7 +106,7 @@ Data_<Sp>* Data_<Sp>::MultS( BaseGDL* r)
   return this;
 #else
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
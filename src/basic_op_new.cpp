@@ -64,7 +64,7 @@ Data_<Sp>* Data_<Sp>::AndOpNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -96,7 +96,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::AndOpNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for ( OMPInt i=0; i < nEl; ++i )
@@ -120,7 +120,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::AndOpInvNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -145,7 +145,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::AndOpNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -169,7 +169,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::AndOpInvNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -245,7 +245,7 @@ Data_<Sp>* Data_<Sp>::AndOpSNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared(s)
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared(s)
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -291,7 +291,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::AndOpInvSNew( BaseGDL* r)
 	  return res;	
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -332,7 +332,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::AndOpInvSNew( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -402,7 +402,7 @@ Data_<Sp>* Data_<Sp>::OrOpNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -435,7 +435,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOpNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -459,7 +459,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOpInvNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -485,7 +485,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOpNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -509,7 +509,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOpInvNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -569,7 +569,7 @@ Data_<Sp>* Data_<Sp>::OrOpSNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -602,7 +602,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOpSNew( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -638,7 +638,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::OrOpInvSNew( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -665,7 +665,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOpSNew( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -699,7 +699,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::OrOpInvSNew( BaseGDL* r)
 	  return res;
 	}
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -769,7 +769,7 @@ Data_<Sp>* Data_<Sp>::XorOpNew( BaseGDL* r)
 	  
 	Data_* res = NewResult();
 	TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 		for( OMPInt i=0; i < nEl; ++i)
@@ -781,7 +781,7 @@ Data_<Sp>* Data_<Sp>::XorOpNew( BaseGDL* r)
 	{
  	Data_* res = NewResult();
 	TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -852,7 +852,7 @@ Data_<Sp>* Data_<Sp>::XorOpSNew( BaseGDL* r)
      
   Data_* res = NewResult();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -937,7 +937,7 @@ BaseGDL* Data_<Sp>::AddNew( BaseGDL* r)
 #else
     
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -969,7 +969,7 @@ BaseGDL* Data_<SpDString>::AddInvNew( BaseGDL* r)
     }
 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1021,7 +1021,7 @@ BaseGDL* Data_<Sp>::AddSNew( BaseGDL* r)
 #else
     
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1050,7 +1050,7 @@ BaseGDL* Data_<SpDString>::AddInvSNew( BaseGDL* r)
     }
   Ty s = (*right)[0];
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1110,7 +1110,7 @@ BaseGDL* Data_<Sp>::SubNew( BaseGDL* r)
 	return res;
 #else
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1131,7 +1131,7 @@ BaseGDL* Data_<Sp>::SubNew( BaseGDL* r)
 	return res;
 #else
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -1166,7 +1166,7 @@ BaseGDL* Data_<Sp>::SubInvNew( BaseGDL* r)
   return res;
 #else
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1237,7 +1237,7 @@ BaseGDL* Data_<Sp>::SubSNew( BaseGDL* r)
 #else
   
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1274,7 +1274,7 @@ BaseGDL* Data_<Sp>::SubInvSNew( BaseGDL* r)
 	return res;
 #else
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1339,7 +1339,7 @@ Data_<Sp>* Data_<Sp>::LtMarkNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1396,7 +1396,7 @@ Data_<Sp>* Data_<Sp>::LtMarkSNew( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s);
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1455,7 +1455,7 @@ Data_<Sp>* Data_<Sp>::GtMarkNew( BaseGDL* r)
       return res;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1512,7 +1512,7 @@ Data_<Sp>* Data_<Sp>::GtMarkSNew( BaseGDL* r)
   Ty s = (*right)[0];
   // right->Scalar(s);
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1581,7 +1581,7 @@ Data_<Sp>* Data_<Sp>::MultNew( BaseGDL* r)
 	return res;
 #else
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -1635,7 +1635,7 @@ Data_<Sp>* Data_<Sp>::MultSNew( BaseGDL* r )
 	return res;
 #else
   TRACEOMP ( __FILE__, __LINE__ )
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for ( OMPInt i=0; i < nEl; ++i )
@@ -1693,7 +1693,7 @@ Data_<Sp>* Data_<Sp>::DivNew( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt ix=i; ix < nEl; ++ix)
@@ -1728,7 +1728,7 @@ Data_<Sp>* Data_<Sp>::DivInvNew( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt ix=i; ix < nEl; ++ix)
@@ -1837,7 +1837,7 @@ Data_<Sp>* Data_<Sp>::DivInvSNew( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt ix=i; ix < nEl; ++ix)
@@ -1931,7 +1931,7 @@ Data_<Sp>* Data_<Sp>::ModNew( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt ix=i; ix < nEl; ++ix)
@@ -1964,7 +1964,7 @@ Data_<Sp>* Data_<Sp>::ModInvNew( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt ix=i; ix < nEl; ++ix)
@@ -1995,7 +1995,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::ModNew( BaseGDL* r)
   }
   
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
    {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2021,7 +2021,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::ModInvNew( BaseGDL* r)
   }
   
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2048,7 +2048,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::ModNew( BaseGDL* r)
   }
   
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2074,7 +2074,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::ModInvNew( BaseGDL* r)
   }
   
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2208,7 +2208,7 @@ Data_<Sp>* Data_<Sp>::ModInvSNew( BaseGDL* r)
   else
     {
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt ix=i; ix < nEl; ++ix)
@@ -2237,7 +2237,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::ModSNew( BaseGDL* r)
     
   Ty s = (*right)[0];
 TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2263,7 +2263,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::ModInvSNew( BaseGDL* r)
   
   Ty s = (*right)[0];
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2288,7 +2288,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::ModSNew( BaseGDL* r)
     
   Ty s = (*right)[0];
 TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2314,7 +2314,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::ModInvSNew( BaseGDL* r)
   
   Ty s = (*right)[0];
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2429,7 +2429,7 @@ Data_<Sp>* Data_<Sp>::PowNew( BaseGDL* r)
 	return res;
   }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2453,7 +2453,7 @@ Data_<Sp>* Data_<Sp>::PowInvNew( BaseGDL* r)
   }
       
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2485,7 +2485,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowIntNew( BaseGDL* r)
       Data_* res = new Data_( Dim(), BaseGDL::NOZERO);
       DLong r0 = (*right)[0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2497,7 +2497,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowIntNew( BaseGDL* r)
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       Ty s0 = (*this)[ 0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -2508,7 +2508,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowIntNew( BaseGDL* r)
     {
       Data_* res = new Data_( Dim(), BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2519,7 +2519,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowIntNew( BaseGDL* r)
     {
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -2541,7 +2541,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowIntNew( BaseGDL* r)
       Data_* res = new Data_( Dim(), BaseGDL::NOZERO);
       DLong r0 = (*right)[0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2553,7 +2553,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowIntNew( BaseGDL* r)
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       Ty s0 = (*this)[ 0];  
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -2564,7 +2564,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowIntNew( BaseGDL* r)
     {
       Data_* res = new Data_( Dim(), BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2575,7 +2575,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowIntNew( BaseGDL* r)
     {
       Data_* res = new Data_( right->Dim(), BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < rEl; ++i)
@@ -2599,7 +2599,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowNew( BaseGDL* r)
 	return res;
   }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	for( OMPInt i=0; i < nEl; ++i)
@@ -2622,7 +2622,7 @@ Data_<SpDFloat>* Data_<SpDFloat>::PowInvNew( BaseGDL* r)
 	return res;
   }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2645,7 +2645,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowNew( BaseGDL* r)
 	return res;
   }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	for( OMPInt i=0; i < nEl; ++i)
@@ -2669,7 +2669,7 @@ Data_<SpDDouble>* Data_<SpDDouble>::PowInvNew( BaseGDL* r)
   }
 
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2700,7 +2700,7 @@ SizeT nEl = N_Elements();
 	  DComplexGDL* res = new DComplexGDL( this->Dim(), 
 					      BaseGDL::NOZERO);
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -2719,7 +2719,7 @@ SizeT nEl = N_Elements();
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -2731,7 +2731,7 @@ SizeT nEl = N_Elements();
 	      DComplexGDL* res = new DComplexGDL( this->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -2744,7 +2744,7 @@ SizeT nEl = N_Elements();
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -2768,7 +2768,7 @@ SizeT nEl = N_Elements();
 	  DComplexGDL* res = new DComplexGDL( this->Dim(), 
 					      BaseGDL::NOZERO);
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -2787,7 +2787,7 @@ SizeT nEl = N_Elements();
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -2799,7 +2799,7 @@ SizeT nEl = N_Elements();
 	      DComplexGDL* res = new DComplexGDL( this->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -2812,7 +2812,7 @@ SizeT nEl = N_Elements();
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -2836,7 +2836,7 @@ SizeT nEl = N_Elements();
 					  BaseGDL::NOZERO);
       //#if (__GNUC__ == 3) && (__GNUC_MINOR__ <= 2)
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i<nEl; ++i)
@@ -2849,7 +2849,7 @@ SizeT nEl = N_Elements();
       DComplexGDL* res = new DComplexGDL( this->Dim(), 
 					  BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -2869,7 +2869,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowInvNew( BaseGDL* r)
     
   Data_* res = NewResult();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -2899,7 +2899,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 	  DComplexDblGDL* res = new DComplexDblGDL( this->Dim(), 
 						    BaseGDL::NOZERO);
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -2918,7 +2918,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -2930,7 +2930,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( this->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -2943,7 +2943,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -2966,7 +2966,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 	  DComplexDblGDL* res = new DComplexDblGDL( this->Dim(), 
 						    BaseGDL::NOZERO);
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -2985,7 +2985,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -2997,7 +2997,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( this->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3010,7 +3010,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3029,7 +3029,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
       DComplexDblGDL* res = new DComplexDblGDL( this->Dim(), 
 						BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i<nEl; ++i)
@@ -3042,7 +3042,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowNew( BaseGDL* r)
       DComplexDblGDL* res = new DComplexDblGDL( this->Dim(), 
 						BaseGDL::NOZERO);
       TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 #pragma omp for
 	  for( OMPInt i=0; i < nEl; ++i)
@@ -3063,7 +3063,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowInvNew( BaseGDL* r)
   assert( nEl);
   Data_* res = NewResult();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3125,7 +3125,7 @@ Data_<Sp>* Data_<Sp>::PowSNew( BaseGDL* r)
 	return res;
   }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3150,7 +3150,7 @@ Data_<Sp>* Data_<Sp>::PowInvSNew( BaseGDL* r)
 	return res;
   }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i < nEl; ++i)
@@ -3179,7 +3179,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 	{
 	  Data_* res = NewResult();
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -3198,7 +3198,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -3209,7 +3209,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 
 	      Data_* res = NewResult();
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3222,7 +3222,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3245,7 +3245,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 	{
 	  Data_* res = NewResult();
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -3264,7 +3264,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 		  DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						      BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -3275,7 +3275,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 
 	      Data_* res = NewResult();
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3288,7 +3288,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
 	      DComplexGDL* res = new DComplexGDL( right->Dim(), 
 						  BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3305,7 +3305,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowSNew( BaseGDL* r)
   Ty s = (*right)[0];
   Data_* res = NewResult();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
@@ -3330,7 +3330,7 @@ Data_<SpDComplex>* Data_<SpDComplex>::PowInvSNew( BaseGDL* r)
 	return res;
   }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
@@ -3360,7 +3360,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 	{
 	  Data_* res = NewResult();
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -3379,7 +3379,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -3390,7 +3390,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 
 	      Data_* res = NewResult();
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3403,7 +3403,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3427,7 +3427,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 	{
 	  Data_* res = NewResult();
 	  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	    {
 #pragma omp for
 	      for( OMPInt i=0; i<nEl; ++i)
@@ -3446,7 +3446,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 		  DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							    BaseGDL::NOZERO);
 		  TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		    {
 #pragma omp for
 		      for( OMPInt i=0; i<rEl; ++i)
@@ -3457,7 +3457,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 
 	      Data_* res = NewResult();
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<nEl; ++i)
@@ -3470,7 +3470,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
 	      DComplexDblGDL* res = new DComplexDblGDL( right->Dim(), 
 							BaseGDL::NOZERO);
 	      TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
+#pragma omp parallel if (rEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= rEl)) 
 		{
 #pragma omp for
 		  for( OMPInt i=0; i<rEl; ++i)
@@ -3485,7 +3485,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowSNew( BaseGDL* r)
   const Ty s = (*right)[0];
   Data_* res = NewResult();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
@@ -3504,7 +3504,7 @@ Data_<SpDComplexDbl>* Data_<SpDComplexDbl>::PowInvSNew( BaseGDL* r)
   Ty s = (*right)[0];
   Data_* res = NewResult();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
 #pragma omp for
       for( OMPInt i=0; i<nEl; ++i)
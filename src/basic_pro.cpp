@@ -49,6 +49,10 @@
 #include "basic_pro.hpp"
 #include "semshm.hpp"
 #include "graphicsdevice.hpp"
+#include "list.hpp"
+#include "gdlbufferpool.hpp"
+#include "exprfusion.hpp"
+#include "getfmtast.hpp"
 
 #ifdef HAVE_EXT_STDIO_FILEBUF_H
 #include <ext/stdio_filebuf.h> // TODO: is it portable across compilers?
@@ -63,16 +67,37 @@ namespace lib {
 
   // control !CPU settings
   void cpu_pro(EnvT* e) {
+    static int calibrateIx = e->KeywordIx("CALIBRATE");
     static int resetIx = e->KeywordIx("RESET");
     static int restoreIx = e->KeywordIx("RESTORE");
     static int max_eltsIx = e->KeywordIx("TPOOL_MAX_ELTS");
     static int min_eltsIx = e->KeywordIx("TPOOL_MIN_ELTS");
+    static int min_elts_arithIx = e->KeywordIx("TPOOL_MIN_ELTS_ARITH");
+    static int min_elts_transcIx = e->KeywordIx("TPOOL_MIN_ELTS_TRANSC");
     static int nThreadsIx = e->KeywordIx("TPOOL_NTHREADS");
     static int vectorEableIx = e->KeywordIx("VECTOR_ENABLE");
+    // GDL extension: MB of freed large array buffers kept for reuse, 0 (the
+    // default) disables the pool (see gdlbufferpool.hpp)
+    static int bufferPoolIx = e->KeywordIx("BUFFER_POOL");
+    // GDL extension: single pass evaluation of large FLOAT/DOUBLE
+    // expressions (see exprfusion.hpp)
+    static int exprFusionIx = e->KeywordIx("EXPR_FUSION");
+    // GDL extension: FORMAT_CACHE=0 parses each format string anew and
+    // runs it through FMTOut (see getfmtast.hpp)
+    static int formatCacheIx = e->KeywordIx("FORMAT_CACHE");
 
     bool reset = e->KeywordSet(resetIx);
-    bool restore = e->KeywordSet(restoreIx);
+    bool restore = e->KeywordPresent(restoreIx);
     if ((reset) && (restore)) e->Throw("Conflicting keywords (/reset and /restore).");
+    bool calibrate = e->KeywordSet(calibrateIx);
+    if ((calibrate) && (restore)) e->Throw("Conflicting keywords (/calibrate and /restore).");
+
+    // new defaults for the per operation class thresholds, applied below
+    // as with /RESET
+    if (calibrate) {
+      CalibrateTPoolThresholds();
+      reset = true;
+    }
 
     bool vectorEnable = e->KeywordSet(vectorEableIx);
 
@@ -84,17 +109,27 @@ namespace lib {
     DLong locCpuTPOOL_NTHREADS = CpuTPOOL_NTHREADS;
     DLong64 locCpuTPOOL_MIN_ELTS = CpuTPOOL_MIN_ELTS;
     DLong64 locCpuTPOOL_MAX_ELTS = CpuTPOOL_MAX_ELTS;
+    DLong64 locCpuTPOOL_MIN_ELTS_ARITH = CpuTPOOL_MIN_ELTS_ARITH;
+    DLong64 locCpuTPOOL_MIN_ELTS_TRANSC = CpuTPOOL_MIN_ELTS_TRANSC;
+    DLong64 locBufferPool = -1;
+    if (e->KeywordPresent(bufferPoolIx)) {
+      e->AssureLongScalarKW(bufferPoolIx, locBufferPool);
+    }
 
     // reading the Tag Index of the variable parts in !CPU
     DStructGDL* cpu = SysVar::Cpu();
     static unsigned NTHREADSTag = cpu->Desc()->TagIndex("TPOOL_NTHREADS");
     static unsigned TPOOL_MIN_ELTSTag = cpu->Desc()->TagIndex("TPOOL_MIN_ELTS");
     static unsigned TPOOL_MAX_ELTSTag = cpu->Desc()->TagIndex("TPOOL_MAX_ELTS");
+    static unsigned TPOOL_MIN_ELTS_ARITHTag = cpu->Desc()->TagIndex("TPOOL_MIN_ELTS_ARITH");
+    static unsigned TPOOL_MIN_ELTS_TRANSCTag = cpu->Desc()->TagIndex("TPOOL_MIN_ELTS_TRANSC");
 
     if (reset) {
       locCpuTPOOL_NTHREADS = NbCOREs;
       locCpuTPOOL_MIN_ELTS = DefaultTPOOL_MIN_ELTS;
       locCpuTPOOL_MAX_ELTS = DefaultTPOOL_MAX_ELTS;
+      locCpuTPOOL_MIN_ELTS_ARITH = DefaultTPOOL_MIN_ELTS_ARITH;
+      locCpuTPOOL_MIN_ELTS_TRANSC = DefaultTPOOL_MIN_ELTS_TRANSC;
     } else if (e->KeywordPresent(restoreIx)) {
       DStructGDL* restoreCpu = e->GetKWAs<DStructGDL>(restoreIx);
 
@@ -104,12 +139,23 @@ namespace lib {
       locCpuTPOOL_NTHREADS = (*(static_cast<DLongGDL*> (restoreCpu->GetTag(NTHREADSTag, 0))))[0];
       locCpuTPOOL_MIN_ELTS = (*(static_cast<DLong64GDL*> (restoreCpu->GetTag(TPOOL_MIN_ELTSTag, 0))))[0];
       locCpuTPOOL_MAX_ELTS = (*(static_cast<DLong64GDL*> (restoreCpu->GetTag(TPOOL_MAX_ELTSTag, 0))))[0];
+      locCpuTPOOL_MIN_ELTS_ARITH = (*(static_cast<DLong64GDL*> (restoreCpu->GetTag(TPOOL_MIN_ELTS_ARITHTag, 0))))[0];
+      locCpuTPOOL_MIN_ELTS_TRANSC = (*(static_cast<DLong64GDL*> (restoreCpu->GetTag(TPOOL_MIN_ELTS_TRANSCTag, 0))))[0];
     } else {
       if (e->KeywordPresent(nThreadsIx)) {
         e->AssureLongScalarKW(nThreadsIx, locCpuTPOOL_NTHREADS);
       }
+      // TPOOL_MIN_ELTS applies to all operations, as in IDL
       if (e->KeywordPresent(min_eltsIx)) {
         e->AssureLongScalarKW(min_eltsIx, locCpuTPOOL_MIN_ELTS);
+        locCpuTPOOL_MIN_ELTS_ARITH = locCpuTPOOL_MIN_ELTS;
+        locCpuTPOOL_MIN_ELTS_TRANSC = locCpuTPOOL_MIN_ELTS;
+      }
+      if (e->KeywordPresent(min_elts_arithIx)) {
+        e->AssureLongScalarKW(min_elts_arithIx, locCpuTPOOL_MIN_ELTS_ARITH);
+      }
+      if (e->KeywordPresent(min_elts_transcIx)) {
+        e->AssureLongScalarKW(min_elts_transcIx, locCpuTPOOL_MIN_ELTS_TRANSC);
       }
       if (e->KeywordPresent(max_eltsIx)) {
         e->AssureLongScalarKW(max_eltsIx, locCpuTPOOL_MAX_ELTS);
@@ -132,11 +178,18 @@ namespace lib {
 #endif
     if (locCpuTPOOL_MIN_ELTS >= 0) CpuTPOOL_MIN_ELTS = locCpuTPOOL_MIN_ELTS;
     if (locCpuTPOOL_MAX_ELTS >= 0) CpuTPOOL_MAX_ELTS = locCpuTPOOL_MAX_ELTS;
+    if (locCpuTPOOL_MIN_ELTS_ARITH >= 0) CpuTPOOL_MIN_ELTS_ARITH = locCpuTPOOL_MIN_ELTS_ARITH;
+    if (locCpuTPOOL_MIN_ELTS_TRANSC >= 0) CpuTPOOL_MIN_ELTS_TRANSC = locCpuTPOOL_MIN_ELTS_TRANSC;
+    if (locBufferPool >= 0) BufferPool::SetMaxCached(static_cast<std::size_t>(locBufferPool) << 20);
+    if (e->KeywordPresent(exprFusionIx)) FusedExpr::SetEnabled(e->KeywordSet(exprFusionIx));
+    if (e->KeywordPresent(formatCacheIx)) SetFMTCacheEnabled(e->KeywordSet(formatCacheIx));
 
     // update !CPU system variable
     (*static_cast<DLongGDL*> (cpu->GetTag(NTHREADSTag, 0)))[0] = CpuTPOOL_NTHREADS;
     (*static_cast<DLong64GDL*> (cpu->GetTag(TPOOL_MIN_ELTSTag, 0)))[0] = CpuTPOOL_MIN_ELTS;
     (*static_cast<DLong64GDL*> (cpu->GetTag(TPOOL_MAX_ELTSTag, 0)))[0] = CpuTPOOL_MAX_ELTS;
+    (*static_cast<DLong64GDL*> (cpu->GetTag(TPOOL_MIN_ELTS_ARITHTag, 0)))[0] = CpuTPOOL_MIN_ELTS_ARITH;
+    (*static_cast<DLong64GDL*> (cpu->GetTag(TPOOL_MIN_ELTS_TRANSCTag, 0)))[0] = CpuTPOOL_MIN_ELTS_TRANSC;
 
 #ifdef _OPENMP
     omp_set_num_threads(CpuTPOOL_NTHREADS);
@@ -244,7 +297,10 @@ namespace lib {
 
     e->HeapGC(doPtr, doObj, verbose);
       if( GDLInterpreter::HeapSize() == 0 and (GDLInterpreter::ObjHeapSize() == 0)  )
+      {
 				GDLInterpreter::ResetHeap();
+				ResetLISTNodeIndex();
+      }
   }
 
   void HeapFreeObj(EnvT* env, BaseGDL* var, bool verbose) {
@@ -965,6 +1021,8 @@ namespace lib {
     }
   }
 
+  void byteorderDo(EnvT* e, BaseGDL* pIn, SizeT swapSz, DLong p);
+
   void readu(EnvT* e) {
     SizeT nParam = e->NParam(1);
 
@@ -987,31 +1045,8 @@ namespace lib {
         " Unit: " + i2s(lun));
       is = &cin;
     } else if (sockNum != -1) {
-      // Socket Read
+      // Socket Read: see below
       swapEndian = fileUnits[lun - 1].SwapEndian();
-
-      compress = fileUnits[lun - 1].Compress();
-
-      string *recvBuf = &fileUnits[lun - 1].RecvBuf();
-
-      // Setup recv buffer & string
-      const int MAXRECV = 2048 * 8;
-      char buf[MAXRECV + 1];
-
-      // Read socket until finished & store in recv string
-      while (1) {
-        memset(buf, 0, MAXRECV + 1);
-        int status = recv(sockNum, buf, MAXRECV, 0);
-        //	  cout << "Bytes received: " << status << endl;
-        if (status == 0) break;
-        for (SizeT i = 0; i < status; i++)
-          recvBuf->push_back(buf[i]);
-      }
-
-      // Get istringstream, write recv string, & assign to istream
-      istringstream *iss = &fileUnits[lun - 1].ISocketStream();
-      iss->str(*recvBuf);
-      is = iss;
     } else {
       compress = fileUnits[lun - 1].Compress();
       if (!compress)
@@ -1062,7 +1097,25 @@ namespace lib {
           e->SetPar(i, p);
         }
 
-        if (compress) {
+        if (sockNum != -1) {
+          GDLStream& sock = fileUnits[lun - 1];
+          DType t = p->Type();
+          if (t != GDL_STRING && t != GDL_STRUCT && t != GDL_PTR && t != GDL_OBJ) {
+            // numeric data are received directly into the variable
+            SizeT nBytes = p->NBytes();
+            if (sock.SocketRead(static_cast<char*> (p->DataAddr()), nBytes) < nBytes)
+              e->Throw("End of file encountered. Unit: " + i2s(lun));
+            if (swapEndian && p->Sizeof() > 1)
+              byteorderDo(e, p, (t == GDL_COMPLEX || t == GDL_COMPLEXDBL) ? p->Sizeof() / 2 : p->Sizeof(), i);
+          } else {
+            SizeT nBytes = (t == GDL_STRUCT) ? static_cast<DStructGDL*> (p)->NBytesToTransfer() : p->NBytes();
+            if (sock.SocketFill(nBytes) < nBytes)
+              e->Throw("End of file encountered. Unit: " + i2s(lun));
+            istringstream& iss = sock.SocketStream();
+            p->Read(iss, swapEndian, compress, xdrs);
+            sock.SocketConsume(iss.tellg());
+          }
+        } else if (compress) {
           p->Read(*igzs, swapEndian, compress, xdrs);
         } else if (varlenVMS && i == 1) {
           // Check if VMS variable-length file
@@ -1106,14 +1159,6 @@ namespace lib {
           p->Read(*is, swapEndian, compress, xdrs);
         } else
           p->Read(*is, swapEndian, compress, xdrs);
-
-        // Socket Read
-        if (sockNum != -1) {
-          int pos = is->tellg();
-          string *recvBuf = &fileUnits[lun - 1].RecvBuf();
-          //	    cout << "pos: " << pos << endl;
-          recvBuf->erase(0, pos);
-        }
       }
 
     BaseGDL* p = e->GetParDefined(nParam - 1);
@@ -2282,6 +2327,7 @@ static DWORD launch_cmd(BOOL hide, BOOL nowait,
       string proFile = StrLowCase(pro);
       AppendIfNeeded(proFile, ".pro");
 
+      NewPathListingPass(); // find files created since the last command
       bool found = CompleteFileName(proFile);
       if (!found ) {
         if (!quiet)
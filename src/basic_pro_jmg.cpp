@@ -50,6 +50,7 @@ namespace lib {
         if( it < itE ) {
             delete *it;
             libProList.erase( it );
+            InvalidateRoutineIndex();
         }
     }
 
@@ -62,6 +63,7 @@ namespace lib {
         if( it < itE ) {
             delete *it;
             libFunList.erase( it );
+            InvalidateRoutineIndex();
         }
     }
 
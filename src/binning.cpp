@@ -0,0 +1,1062 @@
+/***************************************************************************
+                          binning.cpp  -  UNIQ, VALUE_LOCATE, HISTOGRAM, HIST_ND, HIST_2D
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+// These functions replace the former library routines uniq.pro,
+// value_locate.pro, hist_nd.pro and hist_2d.pro. The results (values,
+// types and dimensions) are those of the .pro versions: all arithmetic
+// on the data is done in the types the interpreter would have used for
+// the expressions in these routines, only without the full size
+// temporaries.
+
+#include "includefirst.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "datatypes.hpp"
+#include "envt.hpp"
+#include "dinterpreter.hpp"
+#include "binning.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace lib {
+
+  using namespace std;
+
+// calls CALL( Sp) for the Sp of the real numeric type t
+#define BINNING_REAL_SWITCH( t, CALL)			\
+  switch( t) {						\
+  case GDL_BYTE:    CALL( SpDByte);    break;		\
+  case GDL_INT:     CALL( SpDInt);     break;		\
+  case GDL_UINT:    CALL( SpDUInt);    break;		\
+  case GDL_LONG:    CALL( SpDLong);    break;		\
+  case GDL_ULONG:   CALL( SpDULong);   break;		\
+  case GDL_LONG64:  CALL( SpDLong64);  break;		\
+  case GDL_ULONG64: CALL( SpDULong64); break;		\
+  case GDL_FLOAT:   CALL( SpDFloat);   break;		\
+  case GDL_DOUBLE:  CALL( SpDDouble);  break;		\
+  default: assert( false);				\
+  }
+
+  namespace {
+
+    bool Parallel( SizeT n)
+    {
+      return CpuTPOOL_NTHREADS > 1 && n >= CpuTPOOL_MIN_ELTS_ARITH &&
+	(CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= n);
+    }
+
+    // type of 'a op b' (as ProgNode::AdjustTypes, the left operand wins a tie)
+    DType OpType( DType a, DType b)
+    {
+      return (DTypeOrder[a] >= DTypeOrder[b]) ? a : b;
+    }
+    // type of '[a, b]' (as ARRAYDEFNode, the right operand wins a tie)
+    DType CatType( DType a, DType b)
+    {
+      return (DTypeOrder[b] >= DTypeOrder[a]) ? b : a;
+    }
+
+    enum SmallOp { ADD, SUB, DIV, MINOP, LE, GE, EQ };
+
+    // 'a op b' on the (small) parameter arrays of HIST_ND and HIST_2D,
+    // with the interpreter's type conversion; a and b have the same size
+    BaseGDL* SmallBinOp( BaseGDL* a, BaseGDL* b, SmallOp op)
+    {
+      DType t = OpType( a->Type(), b->Type());
+      Guard<BaseGDL> l( a->Convert2( t, BaseGDL::COPY));
+      Guard<BaseGDL> r( b->Convert2( t, BaseGDL::COPY));
+      switch( op)
+	{
+	case ADD:   l->Add( r.Get()); break;
+	case SUB:   l->Sub( r.Get()); break;
+	case DIV:   l->Div( r.Get()); break;
+	case MINOP: l->LtMark( r.Get()); break;
+	case LE: return l->LeOp( r.Get());
+	case GE: return l->GeOp( r.Get());
+	case EQ: return l->EqOp( r.Get());
+	}
+      return l.release();
+    }
+
+    // the keyword value, NULL if not given or undefined (N_ELEMENTS() eq 0)
+    BaseGDL* DefinedKW( EnvT* e, int ix)
+    {
+      BaseGDL* p = e->GetKW( ix);
+      return (p == NULL || p->Type() == GDL_UNDEF) ? NULL : p;
+    }
+
+    bool AllTrue( BaseGDL* b)
+    {
+      Guard<BaseGDL> g( b);
+      DByteGDL* t = static_cast<DByteGDL*>( b);
+      for( SizeT i = 0; i < t->N_Elements(); ++i)
+	if( (*t)[i] == 0) return false;
+      return true;
+    }
+
+    // '[a, b]' for two scalars
+    BaseGDL* Cat2( BaseGDL* a, BaseGDL* b)
+    {
+      DType t = CatType( a->Type(), b->Type());
+      Guard<BaseGDL> l( a->Convert2( t, BaseGDL::COPY));
+      Guard<BaseGDL> r( b->Convert2( t, BaseGDL::COPY));
+      BaseGDL* res = l->New( dimension( 2), BaseGDL::NOZERO);
+      res->AssignAtIx( 0, l.Get());
+      res->AssignAtIx( 1, r.Get());
+      return res;
+    }
+
+    // the keyword value 'p' as an n element array (a scalar is replicated)
+    BaseGDL* ToN( EnvT* e, BaseGDL* p, SizeT n, const string& name)
+    {
+      SizeT nEl = p->N_Elements();
+      if( nEl == 1) return p->New( dimension( n), BaseGDL::INIT);
+      if( nEl == n) return p->Dup();
+      if( nEl > n) return p->NewIxFrom( 0, n - 1);
+      e->Throw( name + " must have 1 or " + i2s( n) + " elements.");
+      return NULL;
+    }
+
+    // chunk boundaries for the threads of the two pass algorithms below
+    SizeT ChunkStart( SizeT n, int c, int nChunks)
+    {
+      return static_cast<SizeT>( (static_cast<double>( n) * c) / nChunks);
+    }
+
+    // ------------------------------------------------------------------
+    // UNIQ
+
+    // arr[i] ne arr[(i+1) mod n] as in 'arr ne SHIFT(arr, -1)'
+    template< typename Sp>
+    struct UniqDirect
+    {
+      const typename Data_<Sp>::Ty* a;
+      SizeT n;
+      bool operator()( SizeT i) const
+      {
+	return a[i] != a[(i + 1 == n) ? 0 : i + 1];
+      }
+    };
+
+    // the same for tmp = arr[index] (index clipped as in a subscript)
+    template< typename Sp>
+    struct UniqIndexed
+    {
+      const typename Data_<Sp>::Ty* a;
+      BaseGDL* index;
+      SizeT n, upper;
+      SizeT Ix( SizeT i) const
+      {
+	SizeT ix = index->GetAsIndex( i);
+	return (ix > upper) ? upper : ix;
+      }
+      bool operator()( SizeT i) const
+      {
+	return a[Ix( i)] != a[Ix( (i + 1 == n) ? 0 : i + 1)];
+      }
+    };
+
+    // WHERE( keep(i), i=0..n-1), NULL if empty
+    template< typename IxGDL, typename Pred>
+    IxGDL* Compact( SizeT n, const Pred& keep)
+    {
+      int nChunks = Parallel( n) ? CpuTPOOL_NTHREADS : 1;
+      vector<SizeT> count( nChunks + 1, 0);
+#pragma omp parallel for num_threads( nChunks) if( nChunks > 1)
+      for( int c = 0; c < nChunks; ++c)
+	{
+	  SizeT k = 0;
+	  for( SizeT i = ChunkStart( n, c, nChunks); i < ChunkStart( n, c + 1, nChunks); ++i)
+	    if( keep( i)) ++k;
+	  count[c + 1] = k;
+	}
+      for( int c = 0; c < nChunks; ++c) count[c + 1] += count[c];
+      if( count[nChunks] == 0) return NULL;
+
+      IxGDL* res = new IxGDL( dimension( count[nChunks]), BaseGDL::NOZERO);
+      typename IxGDL::Ty* r = static_cast<typename IxGDL::Ty*>( res->DataAddr());
+#pragma omp parallel for num_threads( nChunks) if( nChunks > 1)
+      for( int c = 0; c < nChunks; ++c)
+	{
+	  SizeT k = count[c];
+	  for( SizeT i = ChunkStart( n, c, nChunks); i < ChunkStart( n, c + 1, nChunks); ++i)
+	    if( keep( i)) r[k++] = i;
+	}
+      return res;
+    }
+
+    template< typename Sp, typename IxGDL>
+    BaseGDL* Uniq( BaseGDL* arr, BaseGDL* index)
+    {
+      const typename Data_<Sp>::Ty* a =
+	static_cast<const typename Data_<Sp>::Ty*>( static_cast<Data_<Sp>*>( arr)->DataAddr());
+      SizeT nEl = arr->N_Elements();
+      if( index == NULL)
+	{
+	  UniqDirect<Sp> keep;
+	  keep.a = a;
+	  keep.n = nEl;
+	  IxGDL* res = Compact<IxGDL>( nEl, keep);
+	  return (res != NULL) ? res : new IxGDL( nEl - 1);
+	}
+      UniqIndexed<Sp> keep;
+      keep.a = a;
+      keep.index = index;
+      keep.n = index->N_Elements();
+      keep.upper = nEl - 1;
+      IxGDL* ix = Compact<IxGDL>( keep.n, keep);
+      if( ix == NULL) return new IxGDL( nEl - 1);
+      Guard<IxGDL> ixGuard( ix);
+      return index->NewIx( ix, true);
+    }
+
+    // ------------------------------------------------------------------
+    // VALUE_LOCATE
+
+    // index of the last x[i] <= v (-1 if none) for increasing x,
+    // without branches in the loop
+    inline SizeT UpperIx( const DDouble* x, SizeT n, DDouble v)
+    {
+      const DDouble* base = x;
+      while( n > 1)
+	{
+	  SizeT half = n / 2;
+	  base = (base[half] <= v) ? base + half : base;
+	  n -= half;
+	}
+      return (*base <= v) ? (base - x) : static_cast<SizeT>( -1);
+    }
+
+    template< typename Sp, typename OutT>
+    void Locate( BaseGDL* u, const DDouble* x, SizeT nx, bool decreasing, OutT* out)
+    {
+      const typename Data_<Sp>::Ty* v =
+	static_cast<const typename Data_<Sp>::Ty*>( static_cast<Data_<Sp>*>( u)->DataAddr());
+      SizeT nu = u->N_Elements();
+      const OutT last = static_cast<OutT>( nx) - 1;
+#pragma omp parallel for if( Parallel( nu))
+      for( OMPInt i = 0; i < nu; ++i)
+	{
+	  DDouble d = static_cast<DDouble>( v[i]);
+	  // NaN sorts behind all values in value_locate.pro
+	  OutT j = (d != d) ? last : static_cast<OutT>( UpperIx( x, nx, d));
+	  out[i] = decreasing ? last - 1 - j : j;
+	}
+    }
+
+    // ------------------------------------------------------------------
+    // counting (HISTOGRAM, HIST_ND, HIST_2D)
+
+    // bin( i) is the bin of element i, outside [0, nBins-1] if it is not
+    // counted. Per thread histograms (if they are small compared to the
+    // data) are merged at the end; the reverse indices are then filled
+    // by a second pass over the data, as in a counting sort.
+    template< class BinOf>
+    DLongGDL* BinCountOf( const BinOf& bin, SizeT n, SizeT nBins, DLongGDL** ri)
+    {
+      int nChunks = 1;
+      if( Parallel( n))
+	{
+	  nChunks = CpuTPOOL_NTHREADS;
+	  if( nBins * nChunks > n) nChunks = 1;
+	}
+
+      DLongGDL* res = new DLongGDL( dimension( nBins), BaseGDL::NOZERO);
+      Guard<DLongGDL> resGuard( res);
+      DLong* cnt = static_cast<DLong*>( res->DataAddr());
+
+      // local[c*nBins + b]: count of bin b in chunk c
+      vector<DLong> local( nChunks > 1 ? nChunks * nBins : 0);
+      if( nChunks == 1)
+	{
+	  for( SizeT b = 0; b < nBins; ++b) cnt[b] = 0;
+	  for( SizeT i = 0; i < n; ++i)
+	    {
+	      DLong k = bin( i);
+	      if( k >= 0 && static_cast<SizeT>( k) < nBins) ++cnt[k];
+	    }
+	}
+      else
+	{
+#pragma omp parallel for num_threads( nChunks)
+	  for( int c = 0; c < nChunks; ++c)
+	    {
+	      DLong* lc = &local[c * nBins];
+	      for( SizeT i = ChunkStart( n, c, nChunks); i < ChunkStart( n, c + 1, nChunks); ++i)
+		{
+		  DLong k = bin( i);
+		  if( k >= 0 && static_cast<SizeT>( k) < nBins) ++lc[k];
+		}
+	    }
+#pragma omp parallel for if( Parallel( nBins))
+	  for( OMPInt b = 0; b < nBins; ++b)
+	    {
+	      DLong s = 0;
+	      for( int c = 0; c < nChunks; ++c) s += local[c * nBins + b];
+	      cnt[b] = s;
+	    }
+	}
+
+      if( ri != NULL)
+	{
+	  SizeT nIx = 0;
+	  for( SizeT b = 0; b < nBins; ++b) nIx += cnt[b];
+	  DLongGDL* r = new DLongGDL( dimension( nBins + 1 + nIx), BaseGDL::NOZERO);
+	  Guard<DLongGDL> rGuard( r);
+	  DLong* rp = static_cast<DLong*>( r->DataAddr());
+	  rp[0] = nBins + 1;
+	  for( SizeT b = 0; b < nBins; ++b) rp[b + 1] = rp[b] + cnt[b];
+
+	  if( nChunks == 1)
+	    {
+	      vector<DLong> pos( rp, rp + nBins);
+	      for( SizeT i = 0; i < n; ++i)
+		{
+		  DLong k = bin( i);
+		  if( k >= 0 && static_cast<SizeT>( k) < nBins) rp[pos[k]++] = i;
+		}
+	    }
+	  else
+	    {
+	      // chunk c writes bin b after the entries of the chunks before it,
+	      // which keeps the indices of each bin in increasing order
+	      for( SizeT b = 0; b < nBins; ++b)
+		{
+		  DLong p = rp[b];
+		  for( int c = 0; c < nChunks; ++c)
+		    {
+		      DLong nc = local[c * nBins + b];
+		      local[c * nBins + b] = p;
+		      p += nc;
+		    }
+		}
+#pragma omp parallel for num_threads( nChunks)
+	      for( int c = 0; c < nChunks; ++c)
+		{
+		  DLong* pc = &local[c * nBins];
+		  for( SizeT i = ChunkStart( n, c, nChunks); i < ChunkStart( n, c + 1, nChunks); ++i)
+		    {
+		      DLong k = bin( i);
+		      if( k >= 0 && static_cast<SizeT>( k) < nBins) rp[pc[k]++] = i;
+		    }
+		}
+	    }
+	  *ri = rGuard.release();
+	}
+      return resGuard.release();
+    }
+
+    struct IndexBin
+    {
+      const DLong* h;
+      IndexBin( const DLong* h_): h( h_) {}
+      DLong operator()( SizeT i) const { return h[i]; }
+    };
+
+    // ------------------------------------------------------------------
+    // HISTOGRAM
+
+    // the bins [r(i), r(i+1)), r(i) = a + i*(b-a)/nBins, as formerly set up
+    // for gsl_histogram (gdl_make_uniform), so that no value changes its bin
+    class HistRanges
+    {
+      double a, w, rn;
+      SizeT nBins;
+      vector<double> r; // r(i), if not too large
+
+      double R( SizeT i) const
+      {
+	return r.empty() ? a + static_cast<double>( i) * w / static_cast<double>( nBins) : r[i];
+      }
+
+    public:
+      HistRanges( double a_, double b_, SizeT nBins_, bool tabulate)
+	: a( a_), w( b_ - a_), nBins( nBins_)
+      {
+	if( tabulate)
+	  {
+	    r.resize( nBins + 1);
+	    for( SizeT i = 0; i <= nBins; ++i)
+	      r[i] = a + static_cast<double>( i) * w / static_cast<double>( nBins);
+	  }
+	rn = R( nBins);
+      }
+
+      SizeT NBins() const { return nBins; }
+      double Min() const { return a; }
+      double Max() const { return rn; }
+
+      // bin of x (as gsl_histogram_find), -1 outside [r(0), r(nBins))
+      DLong Find( double x) const
+      {
+	if( x < a || x >= rn) return -1;
+	double g = (x - a) / (rn - a) * nBins;
+	if( g >= 0 && g < nBins)
+	  {
+	    SizeT i = static_cast<SizeT>( g);
+	    if( x >= R( i) && x < R( i + 1)) return i;
+	  }
+	SizeT lower = 0, upper = nBins;
+	while( upper - lower > 1)
+	  {
+	    SizeT mid = (upper + lower) / 2;
+	    if( x >= R( mid)) lower = mid; else upper = mid;
+	  }
+	return lower;
+      }
+    };
+
+    // values above maxV are not counted
+    template< typename T>
+    struct RangeBin
+    {
+      const T* d;
+      const HistRanges& r;
+      double maxV;
+      RangeBin( const T* d_, const HistRanges& r_, double maxV_): d( d_), r( r_), maxV( maxV_) {}
+      DLong operator()( SizeT i) const
+      {
+	double x = d[i];
+	return (x <= maxV) ? r.Find( x) : -1;
+      }
+    };
+
+    // integer data: the bins of lo ... lo+span-1 are looked up
+    template< typename T>
+    struct LookupBin
+    {
+      const T* d;
+      T lo;
+      DULong64 span;
+      const DLong* lut;
+      LookupBin( const T* d_, T lo_, DULong64 span_, const DLong* lut_)
+	: d( d_), lo( lo_), span( span_), lut( lut_) {}
+      DLong operator()( SizeT i) const
+      {
+	if( d[i] < lo) return -1;
+	DULong64 o = static_cast<DULong64>( d[i]) - static_cast<DULong64>( lo);
+	return (o < span) ? lut[o] : -1;
+      }
+    };
+
+    template< typename Sp>
+    DLongGDL* HistCount( BaseGDL* p0, const HistRanges& r, double dataMin, double dataMax,
+			 double maxV, DLongGDL** ri)
+    {
+      typedef typename Data_<Sp>::Ty T;
+      const T* d = static_cast<const T*>( static_cast<Data_<Sp>*>( p0)->DataAddr());
+      SizeT n = p0->N_Elements();
+
+      // (up to 32 bit) integers: all values which can be counted are
+      // exact in DOUBLE, their bins are computed once
+      if( numeric_limits<T>::is_integer && sizeof( T) <= 4)
+	{
+	  double lo = max( dataMin, ceil( r.Min()));
+	  double hi = min( min( dataMax, floor( maxV)), floor( r.Max()));
+	  SizeT span = (hi >= lo) ? static_cast<SizeT>( hi - lo) + 1 : 0;
+	  if( span <= max<SizeT>( 65536, n / 2))
+	    {
+	      vector<DLong> lut( span);
+#pragma omp parallel for if( Parallel( span))
+	      for( OMPInt o = 0; o < span; ++o)
+		lut[o] = r.Find( lo + o);
+	      return BinCountOf( LookupBin<T>( d, (span > 0) ? static_cast<T>( lo) : 0, span,
+					       span > 0 ? &lut[0] : NULL), n, r.NBins(), ri);
+	    }
+	}
+      return BinCountOf( RangeBin<T>( d, r, maxV), n, r.NBins(), ri);
+    }
+
+    // minimum and maximum as formerly in HISTOGRAM: NaN are skipped
+    // (unless in the first element), false for an infinite value
+    template< typename T>
+    bool DataRange( const T* d, SizeT n, T& mn, T& mx)
+    {
+      int nChunks = Parallel( n) ? CpuTPOOL_NTHREADS : 1;
+      vector<T> cMin( nChunks), cMax( nChunks);
+      vector<char> cInf( nChunks, 0);
+#pragma omp parallel for num_threads( nChunks)
+      for( int c = 0; c < nChunks; ++c)
+	{
+	  T lMin = d[0], lMax = d[0];
+	  char inf = 0;
+	  for( SizeT i = max<SizeT>( 1, ChunkStart( n, c, nChunks)); i < ChunkStart( n, c + 1, nChunks); ++i)
+	    {
+	      if( d[i] < lMin) lMin = d[i];
+	      else if( d[i] > lMax) lMax = d[i];
+	      if( !numeric_limits<T>::is_integer && std::isinf( d[i])) inf = 1;
+	    }
+	  cMin[c] = lMin;
+	  cMax[c] = lMax;
+	  cInf[c] = inf;
+	}
+      mn = d[0];
+      mx = d[0];
+      bool finite = true;
+      for( int c = 0; c < nChunks; ++c)
+	{
+	  if( cMin[c] < mn) mn = cMin[c];
+	  if( cMax[c] > mx) mx = cMax[c];
+	  if( cInf[c]) finite = false;
+	}
+      return finite;
+    }
+
+    template< typename Sp>
+    bool HistDataRange( BaseGDL* p0, bool omitNaN, double& mn, double& mx)
+    {
+      typedef typename Data_<Sp>::Ty T;
+      Data_<Sp>* p = static_cast<Data_<Sp>*>( p0);
+      if( omitNaN)
+	{
+	  DLong minEl, maxEl;
+	  p->MinMax( &minEl, &maxEl, NULL, NULL, true);
+	  mn = (*p)[minEl];
+	  mx = (*p)[maxEl];
+	  return true;
+	}
+      T tMin, tMax;
+      bool finite = DataRange( static_cast<const T*>( p->DataAddr()), p->N_Elements(), tMin, tMax);
+      mn = tMin;
+      mx = tMax;
+      return finite;
+    }
+
+    // ------------------------------------------------------------------
+    // HIST_ND
+
+    const SizeT maxHistDim = 8;
+
+    // dimension i of point p is (*var[i])[off[i] + p*stride]
+    struct PointSet
+    {
+      SizeT    nDim, nPts, stride;
+      BaseGDL* var[maxHistDim];
+      SizeT    off[maxHistDim];
+    };
+
+    // owns the type converted copies of the data
+    class PointCopies
+    {
+      vector<BaseGDL*> copies;
+    public:
+      ~PointCopies()
+      {
+	for( SizeT i = 0; i < copies.size(); ++i) delete copies[i];
+      }
+      PointSet As( const PointSet& src, DType t)
+      {
+	PointSet dst = src;
+	for( SizeT i = 0; i < src.nDim; ++i)
+	  {
+	    if( src.var[i]->Type() == t) continue;
+	    // one copy for all dimensions sharing a variable
+	    SizeT j = 0;
+	    for( ; j < i; ++j) if( src.var[j] == src.var[i]) break;
+	    if( j < i)
+	      dst.var[i] = dst.var[j];
+	    else
+	      {
+		dst.var[i] = src.var[i]->Convert2( t, BaseGDL::COPY);
+		copies.push_back( dst.var[i]);
+	      }
+	  }
+	return dst;
+      }
+    };
+
+    // h = the bin index, from dimension nDim-1 down to 0:
+    // h = nbins[i]*h + LONG((V[i,*]-mn[i])/bs[i]), with V-mn in type of Sp1
+    // and the division in the type of Sp
+    template< typename Sp1, typename Sp>
+    void BinIndex( const PointSet& v, BaseGDL* mnVar, BaseGDL* bsVar, const DLong* nbins, DLong* h)
+    {
+      typedef typename Data_<Sp1>::Ty T1;
+      typedef typename Data_<Sp>::Ty  T;
+      const T1* mn = static_cast<const T1*>( static_cast<Data_<Sp1>*>( mnVar)->DataAddr());
+      const T*  bs = static_cast<const T*>( static_cast<Data_<Sp>*>( bsVar)->DataAddr());
+      const T1* base[maxHistDim];
+      for( SizeT i = 0; i < v.nDim; ++i)
+	base[i] = static_cast<const T1*>( static_cast<Data_<Sp1>*>( v.var[i])->DataAddr()) + v.off[i];
+      const int  last = v.nDim - 1;
+      const SizeT stride = v.stride;
+      const SizeT nPts = v.nPts;
+#pragma omp parallel for if( Parallel( nPts))
+      for( OMPInt p = 0; p < nPts; ++p)
+	{
+	  DULong acc = 0;
+	  for( int i = last; i >= 0; --i)
+	    {
+	      T1 d = base[i][p * stride] - mn[i];
+	      T  q = static_cast<T>( d);
+	      // as Data_::Div(): integer division by zero leaves the dividend
+	      if( !numeric_limits<T>::is_integer || bs[i] != 0) q /= bs[i];
+	      DULong l = static_cast<DULong>( static_cast<DLong>( q));
+	      acc = (i == last) ? l : static_cast<DULong>( nbins[i]) * acc + l;
+	    }
+	  h[p] = static_cast<DLong>( acc);
+	}
+    }
+
+    template< typename Sp1>
+    void BinIndexQ( DType tq, const PointSet& v, BaseGDL* mn, BaseGDL* bs, const DLong* nbins, DLong* h)
+    {
+#define BIN_INDEX( Sp) BinIndex<Sp1, Sp>( v, mn, bs, nbins, h)
+      BINNING_REAL_SWITCH( tq, BIN_INDEX)
+#undef BIN_INDEX
+    }
+
+    // h = -1 where V < lim (low) or V > lim (high) in any dimension
+    template< typename Sp>
+    void ClipRange( const PointSet& v, BaseGDL* limVar, bool low, DLong* h)
+    {
+      typedef typename Data_<Sp>::Ty T;
+      const T* lim = static_cast<const T*>( static_cast<Data_<Sp>*>( limVar)->DataAddr());
+      const T* base[maxHistDim];
+      for( SizeT i = 0; i < v.nDim; ++i)
+	base[i] = static_cast<const T*>( static_cast<Data_<Sp>*>( v.var[i])->DataAddr()) + v.off[i];
+      const SizeT nDim = v.nDim;
+      const SizeT stride = v.stride;
+      const SizeT nPts = v.nPts;
+#pragma omp parallel for if( Parallel( nPts))
+      for( OMPInt p = 0; p < nPts; ++p)
+	for( SizeT i = 0; i < nDim; ++i)
+	  {
+	    T x = base[i][p * stride];
+	    if( low ? !(x >= lim[i]) : !(x <= lim[i]))
+	      {
+		h[p] = -1;
+		break;
+	      }
+	  }
+    }
+
+    // the body of hist_nd.pro for the points 'v'
+    DLongGDL* HistND( EnvT* e, const PointSet& v, BaseGDL* mnKW, BaseGDL* mxKW,
+		      BaseGDL* bsPar, BaseGDL* nbinsKW, DLongGDL** ri)
+    {
+      const SizeT nDim = v.nDim;
+      const DType vTy = v.var[0]->Type();
+
+      // imx = MAX( V, DIMENSION=2, MIN=imn)
+      BaseGDL* imn = v.var[0]->New( dimension( nDim), BaseGDL::NOZERO);
+      Guard<BaseGDL> imnGuard( imn);
+      BaseGDL* imx = v.var[0]->New( dimension( nDim), BaseGDL::NOZERO);
+      Guard<BaseGDL> imxGuard( imx);
+      for( SizeT i = 0; i < nDim; ++i)
+	v.var[i]->MinMax( NULL, NULL, &imn, &imx, false,
+			  v.off[i], v.off[i] + v.nPts * v.stride, v.stride, i);
+
+      Guard<BaseGDL> mn( (mnKW != NULL) ? ToN( e, mnKW, nDim, "MIN") : imn->Dup());
+      Guard<BaseGDL> mx( (mxKW != NULL) ? ToN( e, mxKW, nDim, "MAX") : imx->Dup());
+
+      if( !AllTrue( SmallBinOp( mn.Get(), mx.Get(), LE)))
+	e->Throw( "Min must be less than or equal to max.");
+
+      Guard<BaseGDL> bs;
+      Guard<DLongGDL> nbins;
+      if( bsPar == NULL)
+	{
+	  if( nbinsKW == NULL)
+	    e->Throw( "Must pass either binsize or NBINS");
+	  Guard<BaseGDL> nb( ToN( e, nbinsKW, nDim, "NBINS"));
+	  nbins.Init( static_cast<DLongGDL*>( nb->Convert2( GDL_LONG, BaseGDL::COPY)));
+	  // bs = FLOAT(mx-mn)/nbins
+	  Guard<BaseGDL> range( SmallBinOp( mx.Get(), mn.Get(), SUB));
+	  Guard<BaseGDL> fRange( range->Convert2( GDL_FLOAT, BaseGDL::COPY));
+	  bs.Init( SmallBinOp( fRange.Get(), nbins.Get(), DIV));
+	}
+      else
+	{
+	  bs.Init( ToN( e, bsPar, nDim, "Binsize"));
+	  // nbins = LONG((mx-mn)/bs+1)
+	  Guard<BaseGDL> range( SmallBinOp( mx.Get(), mn.Get(), SUB));
+	  Guard<BaseGDL> n( SmallBinOp( range.Get(), bs.Get(), DIV));
+	  DIntGDL one( dimension( nDim), BaseGDL::NOZERO);
+	  for( SizeT i = 0; i < nDim; ++i) one[i] = 1;
+	  Guard<BaseGDL> n1( SmallBinOp( n.Get(), &one, ADD));
+	  nbins.Init( static_cast<DLongGDL*>( n1->Convert2( GDL_LONG, BaseGDL::COPY)));
+	}
+
+      SizeT dims[maxHistDim];
+      DULong totalBins = 1;
+      for( SizeT i = 0; i < nDim; ++i)
+	{
+	  if( (*nbins.Get())[i] <= 0)
+	    e->Throw( "Array dimensions must be greater than 0.");
+	  dims[i] = (*nbins.Get())[i];
+	  totalBins *= static_cast<DULong>( (*nbins.Get())[i]);
+	}
+      if( static_cast<DLong>( totalBins) <= 0)
+	e->Throw( "Array has too many elements.");
+
+      PointCopies copies;
+
+      // the bin indices, with V-mn in the type of V op mn and the
+      // division in the type of that op bs
+      DType t1 = OpType( vTy, mn->Type());
+      DType tq = OpType( t1, bs->Type());
+      Guard<BaseGDL> mn1( mn->Convert2( t1, BaseGDL::COPY));
+      Guard<BaseGDL> bsq( bs->Convert2( tq, BaseGDL::COPY));
+      PointSet v1 = copies.As( v, t1);
+      DLongGDL h( dimension( v.nPts), BaseGDL::NOZERO);
+      DLong* hp = static_cast<DLong*>( h.DataAddr());
+      const DLong* nb = static_cast<const DLong*>( nbins->DataAddr());
+#define BIN_INDEX_Q( Sp) BinIndexQ<Sp>( tq, v1, mn1.Get(), bsq.Get(), nb, hp)
+      BINNING_REAL_SWITCH( t1, BIN_INDEX_Q)
+#undef BIN_INDEX_Q
+
+      // points outside [mn, mx] (only checked if the range was given)
+      if( !AllTrue( SmallBinOp( mn.Get(), imn, LE)))
+	{
+#define CLIP_LOW( Sp) ClipRange<Sp>( v1, mn1.Get(), true, hp)
+	  BINNING_REAL_SWITCH( t1, CLIP_LOW)
+#undef CLIP_LOW
+	}
+      if( !AllTrue( SmallBinOp( mx.Get(), imx, GE)))
+	{
+	  DType tx = OpType( vTy, mx->Type());
+	  Guard<BaseGDL> mxx( mx->Convert2( tx, BaseGDL::COPY));
+	  PointSet vx = copies.As( v, tx);
+#define CLIP_HIGH( Sp) ClipRange<Sp>( vx, mxx.Get(), false, hp)
+	  BINNING_REAL_SWITCH( tx, CLIP_HIGH)
+#undef CLIP_HIGH
+	}
+
+      DLongGDL* res = BinCount( hp, v.nPts, totalBins, ri);
+      res->SetDim( dimension( dims, nDim));
+      res->Purge();
+      return res;
+    }
+
+  } // namespace
+
+  // ------------------------------------------------------------------
+
+  DLongGDL* BinCount( const DLong* h, SizeT n, SizeT nBins, DLongGDL** ri)
+  {
+    return BinCountOf( IndexBin( h), n, nBins, ri);
+  }
+
+  bool HistogramDataRange( BaseGDL* p0, bool omitNaN, DDouble& minVal, DDouble& maxVal)
+  {
+    bool finite = true;
+#define HIST_DATA_RANGE( Sp) finite = HistDataRange<Sp>( p0, omitNaN, minVal, maxVal)
+    BINNING_REAL_SWITCH( p0->Type(), HIST_DATA_RANGE)
+#undef HIST_DATA_RANGE
+    return finite;
+  }
+
+  DLongGDL* HistogramCount( BaseGDL* p0, DDouble a, DDouble b, SizeT nBins,
+			    DDouble dataMin, DDouble dataMax, DDouble maxVal, DLongGDL** ri)
+  {
+    HistRanges r( a, b, nBins, nBins <= 2 * p0->N_Elements() + 1024);
+    DLongGDL* res = NULL;
+#define HIST_COUNT( Sp) res = HistCount<Sp>( p0, r, dataMin, dataMax, maxVal, ri)
+    BINNING_REAL_SWITCH( p0->Type(), HIST_COUNT)
+#undef HIST_COUNT
+    return res;
+  }
+
+  BaseGDL* uniq_fun( EnvT* e)
+  {
+    SizeT nParam = e->NParam( 1);
+
+    BaseGDL* arr = e->GetPar( 0);
+    SizeT nEl = (arr != NULL) ? arr->N_Elements() : 0;
+    if( nEl <= 1) return new DLongGDL( 0);
+
+    if( arr->Type() == GDL_STRUCT)
+      e->Throw( "Struct expression not allowed in this context: " + e->GetParString( 0));
+
+    BaseGDL* index = NULL;
+    if( nParam > 1)
+      {
+	index = e->GetParDefined( 1);
+	if( !RealType( index->Type()))
+	  e->Throw( "Type not allowed as subscript: " + e->GetParString( 1));
+      }
+
+    bool l64 = nEl > static_cast<SizeT>( numeric_limits<DLong>::max()) ||
+      (index != NULL && index->N_Elements() > static_cast<SizeT>( numeric_limits<DLong>::max()));
+
+#define UNIQ_CASE( Sp)							\
+    return l64 ? Uniq<Sp, DLong64GDL>( arr, index) : Uniq<Sp, DLongGDL>( arr, index)
+
+    switch( arr->Type())
+      {
+      case GDL_STRING:     UNIQ_CASE( SpDString);
+      case GDL_COMPLEX:    UNIQ_CASE( SpDComplex);
+      case GDL_COMPLEXDBL: UNIQ_CASE( SpDComplexDbl);
+      case GDL_PTR:        UNIQ_CASE( SpDPtr);
+      case GDL_OBJ:        UNIQ_CASE( SpDObj);
+      default: break;
+      }
+    BINNING_REAL_SWITCH( arr->Type(), UNIQ_CASE)
+#undef UNIQ_CASE
+    return NULL;
+  }
+
+  BaseGDL* value_locate_fun( EnvT* e)
+  {
+    e->NParam( 2);
+
+    BaseGDL* x = e->GetPar( 0);
+    if( x == NULL || x->Type() == GDL_UNDEF)
+      e->Throw( "First variable is undefined.");
+    BaseGDL* u = e->GetPar( 1);
+    if( u == NULL || u->Type() == GDL_UNDEF)
+      e->Throw( "Second variable is undefined.");
+
+    DType xTy = x->Type();
+    if( xTy == GDL_COMPLEX || DTypeOrder[xTy] >= 20)
+      e->Throw( "First variable : " + x->TypeStr() + " not allowed in this context.");
+    DType uTy = u->Type();
+    if( uTy == GDL_STRUCT || uTy == GDL_PTR || uTy == GDL_OBJ)
+      e->Throw( "Second variable : " + u->TypeStr() + " not allowed in this context.");
+
+    static int l64Ix = e->KeywordIx( "L64");
+    SizeT nx = x->N_Elements();
+    bool l64 = e->KeywordSet( l64Ix) ||
+      nx > static_cast<SizeT>( numeric_limits<DLong>::max());
+
+    // as in value_locate.pro, complex values of u become FLOAT or DOUBLE
+    // and strings (x or u) become FLOAT, or DOUBLE if the other argument
+    // is DOUBLE. All values are then compared as DOUBLE (value_locate.pro
+    // compared in the promoted type, at least FLOAT, which lost precision
+    // for large integers).
+    Guard<BaseGDL> uGuard;
+    if( uTy == GDL_COMPLEX)
+      uTy = GDL_FLOAT;
+    else if( uTy == GDL_COMPLEXDBL)
+      uTy = GDL_DOUBLE;
+    else if( uTy == GDL_STRING)
+      uTy = (xTy == GDL_DOUBLE) ? GDL_DOUBLE : GDL_FLOAT;
+    if( uTy != u->Type())
+      {
+	u = u->Convert2( uTy, BaseGDL::COPY);
+	uGuard.Init( u);
+      }
+    Guard<BaseGDL> xGuard;
+    if( xTy == GDL_STRING && uTy != GDL_DOUBLE)
+      {
+	x = x->Convert2( GDL_FLOAT, BaseGDL::COPY);
+	xGuard.Init( x);
+      }
+
+    DDoubleGDL* xd = static_cast<DDoubleGDL*>( x->Convert2( GDL_DOUBLE, BaseGDL::COPY));
+    Guard<DDoubleGDL> xdGuard( xd);
+
+    // warning if the array is not monotonic (GDL extension)
+    bool up = false, down = false;
+    for( SizeT i = 1; i < nx; ++i)
+      {
+	if( (*xd)[i] > (*xd)[i - 1]) up = true;
+	else if( (*xd)[i] < (*xd)[i - 1]) down = true;
+      }
+    if( up && down)
+      Message( e->GetProName() + ": Warning : input array \"" + e->GetParString( 0) +
+	       "\" is NOT monotonically increasing or decreasing");
+
+    bool decreasing = (*xd)[nx - 1] < (*xd)[0];
+    if( decreasing) xd->Reverse( 0);
+    const DDouble* xp = static_cast<const DDouble*>( xd->DataAddr());
+
+    dimension dim = u->Dim();
+    BaseGDL* res;
+    if( l64)
+      {
+	DLong64GDL* r = new DLong64GDL( dim, BaseGDL::NOZERO);
+	DLong64* out = static_cast<DLong64*>( r->DataAddr());
+#define LOCATE( Sp) Locate<Sp, DLong64>( u, xp, nx, decreasing, out)
+	BINNING_REAL_SWITCH( u->Type(), LOCATE)
+#undef LOCATE
+	res = r;
+      }
+    else
+      {
+	DLongGDL* r = new DLongGDL( dim, BaseGDL::NOZERO);
+	DLong* out = static_cast<DLong*>( r->DataAddr());
+#define LOCATE( Sp) Locate<Sp, DLong>( u, xp, nx, decreasing, out)
+	BINNING_REAL_SWITCH( u->Type(), LOCATE)
+#undef LOCATE
+	res = r;
+      }
+    return res;
+  }
+
+  BaseGDL* hist_nd_fun( EnvT* e)
+  {
+    SizeT nParam = e->NParam( 1);
+
+    BaseGDL* v = e->GetNumericParDefined( 0);
+    if( v->Rank() != 2)
+      e->Throw( "Input must be N (dimensions) x P (points)");
+    if( v->Dim( 0) > maxHistDim)
+      e->Throw( "Only up to 8 dimensions allowed");
+    if( !RealType( v->Type()))
+      e->Throw( v->TypeStr() + " expression not allowed in this context: " + e->GetParString( 0));
+
+    PointSet ps;
+    ps.nDim = v->Dim( 0);
+    ps.nPts = v->Dim( 1);
+    ps.stride = ps.nDim;
+    for( SizeT i = 0; i < ps.nDim; ++i)
+      {
+	ps.var[i] = v;
+	ps.off[i] = i;
+      }
+
+    BaseGDL* bs = (nParam > 1) ? e->GetNumericParDefined( 1) : NULL;
+
+    static int minIx = e->KeywordIx( "MIN");
+    static int maxIx = e->KeywordIx( "MAX");
+    static int nbinsIx = e->KeywordIx( "NBINS");
+    static int riIx = e->KeywordIx( "REVERSE_INDICES");
+
+    DLongGDL* ri = NULL;
+    bool doRi = e->KeywordPresent( riIx);
+    DLongGDL* res = HistND( e, ps, DefinedKW( e, minIx), DefinedKW( e, maxIx),
+			    bs, DefinedKW( e, nbinsIx), doRi ? &ri : NULL);
+    if( doRi) e->SetKW( riIx, ri);
+    return res;
+  }
+
+  BaseGDL* hist_2d_fun( EnvT* e)
+  {
+    e->NParam( 2);
+
+    BaseGDL* v1 = e->GetNumericParDefined( 0);
+    BaseGDL* v2 = e->GetNumericParDefined( 1);
+    if( v1->Rank() == 0 && v2->Rank() == 0)
+      e->Throw( "one of the 2 Expressions must be an array in this context");
+    if( !RealType( v1->Type()))
+      e->Throw( v1->TypeStr() + " expression not allowed in this context: " + e->GetParString( 0));
+    if( !RealType( v2->Type()))
+      e->Throw( v2->TypeStr() + " expression not allowed in this context: " + e->GetParString( 1));
+
+    static int bin1Ix = e->KeywordIx( "BIN1");
+    static int bin2Ix = e->KeywordIx( "BIN2");
+    static int max1Ix = e->KeywordIx( "MAX1");
+    static int max2Ix = e->KeywordIx( "MAX2");
+    static int min1Ix = e->KeywordIx( "MIN1");
+    static int min2Ix = e->KeywordIx( "MIN2");
+
+    // defaults of hist_2d.pro: BIN = 1, MIN = 0 < MIN( v, /NAN), MAX = MAX( v, /NAN)
+    DIntGDL zero( 0);
+    BaseGDL* lim[2][2]; // [variable][min, max]
+    Guard<BaseGDL> limGuard[2][2];
+    BaseGDL* vv[2] = { v1, v2 };
+    int minIx[2] = { min1Ix, min2Ix };
+    int maxIx[2] = { max1Ix, max2Ix };
+    for( int k = 0; k < 2; ++k)
+      {
+	BaseGDL* mnKW = DefinedKW( e, minIx[k]);
+	BaseGDL* mxKW = DefinedKW( e, maxIx[k]);
+	BaseGDL* vMin = NULL;
+	BaseGDL* vMax = NULL;
+	if( mnKW == NULL || mxKW == NULL)
+	  {
+	    vv[k]->MinMax( NULL, NULL, (mnKW == NULL) ? &vMin : NULL,
+			   (mxKW == NULL) ? &vMax : NULL, true);
+	  }
+	Guard<BaseGDL> vMinGuard( vMin);
+	if( mnKW == NULL)
+	  limGuard[k][0].Init( SmallBinOp( &zero, vMin, MINOP));
+	else
+	  limGuard[k][0].Init( mnKW->Dup());
+	if( mxKW == NULL)
+	  limGuard[k][1].Init( vMax);
+	else
+	  limGuard[k][1].Init( mxKW->Dup());
+	lim[k][0] = limGuard[k][0].Get();
+	lim[k][1] = limGuard[k][1].Get();
+      }
+
+    DIntGDL one( 1);
+    BaseGDL* bin1 = DefinedKW( e, bin1Ix);
+    BaseGDL* bin2 = DefinedKW( e, bin2Ix);
+    if( bin1 == NULL) bin1 = &one;
+    if( bin2 == NULL) bin2 = &one;
+
+    DDouble check;
+    Guard<BaseGDL> b1d( bin1->Convert2( GDL_DOUBLE, BaseGDL::COPY));
+    Guard<BaseGDL> b2d( bin2->Convert2( GDL_DOUBLE, BaseGDL::COPY));
+    if( (*static_cast<DDoubleGDL*>( b1d.Get()))[0] <= 0) e->Throw( "bin1 must be > 0");
+    if( (*static_cast<DDoubleGDL*>( b2d.Get()))[0] <= 0) e->Throw( "bin2 must be > 0");
+    for( int k = 0; k < 2; ++k)
+      for( int m = 0; m < 2; ++m)
+	{
+	  Guard<BaseGDL> d( lim[k][m]->Convert2( GDL_DOUBLE, BaseGDL::COPY));
+	  check = (*static_cast<DDoubleGDL*>( d.Get()))[0];
+	  if( !isfinite( check))
+	    e->Throw( "min1, min2, max1 and max2 must all be finite");
+	}
+    if( AllTrue( SmallBinOp( lim[0][0], lim[0][1], EQ)))
+      e->Throw( "min1 must not be equal to max1");
+    if( AllTrue( SmallBinOp( lim[1][0], lim[1][1], EQ)))
+      e->Throw( "min2 must not be equal to max2");
+
+    // data = TRANSPOSE( [[v1[0:n-1]], [v2[0:n-1]]])
+    SizeT n = min( v1->N_Elements(), v2->N_Elements());
+    BaseGDL* col[2] = { v1, v2 };
+    Guard<BaseGDL> colGuard[2];
+    PointSet ps;
+    ps.nDim = 2;
+    ps.stride = 1;
+    ps.off[0] = ps.off[1] = 0;
+    if( n == 1)
+      {
+	// emulating IDL behaviour with 1-element arrays and scalars:
+	// a second point (max1+1, max2+1) which is out of range
+	for( int k = 0; k < 2; ++k)
+	  {
+	    Guard<BaseGDL> first( vv[k]->NewIx( 0));
+	    Guard<BaseGDL> beyond( SmallBinOp( lim[k][1], &one, ADD));
+	    col[k] = Cat2( first.Get(), beyond.Get());
+	    colGuard[k].Init( col[k]);
+	  }
+	ps.nPts = 2;
+      }
+    else
+      ps.nPts = n;
+    DType cTy = CatType( col[0]->Type(), col[1]->Type());
+    for( int k = 0; k < 2; ++k)
+      if( col[k]->Type() != cTy)
+	{
+	  col[k] = col[k]->Convert2( cTy, BaseGDL::COPY);
+	  colGuard[k].reset( col[k]);
+	}
+    ps.var[0] = col[0];
+    ps.var[1] = col[1];
+
+    Guard<BaseGDL> bs( Cat2( bin1, bin2));
+    Guard<BaseGDL> mn( Cat2( lim[0][0], lim[1][0]));
+    Guard<BaseGDL> mx( Cat2( lim[0][1], lim[1][1]));
+
+    DLongGDL* res = HistND( e, ps, mn.Get(), mx.Get(), bs.Get(), NULL, NULL);
+    // always [nbins1, nbins2], also for nbins2 = 1
+    SizeT nb0 = res->Dim( 0);
+    res->SetDim( dimension( nb0, res->N_Elements() / nb0));
+    return res;
+  }
+
+} // namespace lib
@@ -0,0 +1,44 @@
+/***************************************************************************
+                          binning.hpp  -  UNIQ, VALUE_LOCATE, HISTOGRAM, HIST_ND, HIST_2D
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef BINNING_HPP_
+#define BINNING_HPP_
+
+namespace lib {
+
+  BaseGDL* uniq_fun( EnvT* e);
+  BaseGDL* value_locate_fun( EnvT* e);
+  BaseGDL* hist_nd_fun( EnvT* e);
+  BaseGDL* hist_2d_fun( EnvT* e);
+
+  // counts of the values of 'h' in [0, nBins-1] as
+  // HISTOGRAM(h, MIN=0, MAX=nBins-1, REVERSE_INDICES=ri) would return them;
+  // 'ri' (if not NULL) receives the reverse indices
+  DLongGDL* BinCount( const DLong* h, SizeT n, SizeT nBins, DLongGDL** ri);
+
+  // HISTOGRAM (histogram_fun): the minimum and maximum of the (real) data,
+  // skipping NaN if omitNaN; false if an infinite value was encountered
+  bool HistogramDataRange( BaseGDL* p0, bool omitNaN, DDouble& minVal, DDouble& maxVal);
+
+  // counts of p0 (values up to maxVal) in the nBins uniform bins of [a, b)
+  // (and the reverse indices, if 'ri' is not NULL); dataMin and dataMax
+  // are the range of the data as returned by HistogramDataRange
+  DLongGDL* HistogramCount( BaseGDL* p0, DDouble a, DDouble b, SizeT nBins,
+			    DDouble dataMin, DDouble dataMax, DDouble maxVal, DLongGDL** ri);
+
+}
+
+#endif
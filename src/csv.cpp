@@ -0,0 +1,732 @@
+/***************************************************************************
+                          csv.cpp  -  delimited text files
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "includefirst.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "datatypes.hpp"
+#include "dstructgdl.hpp"
+#include "envt.hpp"
+#include "objects.hpp"
+#include "str.hpp"
+#include "ofmt.hpp"
+#include "csv.hpp"
+
+namespace {
+
+  // below this the lines of a file are found by one thread
+  const SizeT minParallelBytes = 1 << 20;
+
+  // a text file in memory: line k is text[ Begin( k), End( k)), without
+  // its '\n' and a '\r' before it (as READF reads it)
+  class TextLines
+  {
+    std::string text;
+    std::vector<SizeT> ends; // of each line: the position of its '\n'
+
+    // ends[] of text[ b, e) from ends[ ix] on
+    void FillEnds( SizeT b, SizeT e, SizeT ix)
+    {
+      const char* buf = text.data();
+      const char* p = buf + b;
+      const char* pEnd = buf + e;
+      while( p < pEnd)
+	{
+	  const char* nl = static_cast<const char*>( memchr( p, '\n', pEnd - p));
+	  if( nl == NULL) break;
+	  ends[ ix++] = nl - buf;
+	  p = nl + 1;
+	}
+    }
+
+    static SizeT CountLineEnds( const char* p, const char* pEnd)
+    {
+      SizeT n = 0;
+      while( p < pEnd)
+	{
+	  const char* nl = static_cast<const char*>( memchr( p, '\n', pEnd - p));
+	  if( nl == NULL) break;
+	  ++n;
+	  p = nl + 1;
+	}
+      return n;
+    }
+
+  public:
+    // false if 'fileName' cannot be read
+    bool Read( const std::string& fileName)
+    {
+      struct stat st;
+      if( stat( fileName.c_str(), &st) != 0 || S_ISDIR( st.st_mode) ||
+	  access( fileName.c_str(), R_OK) != 0)
+	return false;
+      FILE* fd = fopen( fileName.c_str(), "rb");
+      if( fd == NULL) return false;
+      text.clear();
+      if( S_ISREG( st.st_mode)) text.reserve( st.st_size);
+      char buf[ 64 * 1024];
+      SizeT count;
+      while( (count = fread( buf, 1, sizeof( buf), fd)) > 0)
+	text.append( buf, count);
+      fclose( fd);
+
+      // the byte ranges of the threads are searched for line ends in
+      // parallel: first counting them, then storing their positions.
+      // Quotes cannot hide a line end: as READF, a record never
+      // continues on the next line
+      SizeT n = text.size();
+      int nChunks = (CpuTPOOL_NTHREADS > 1 && n >= minParallelBytes) ? CpuTPOOL_NTHREADS : 1;
+      std::vector<SizeT> chunkStart( nChunks + 1, 0);
+      const char* b = text.data();
+#pragma omp parallel for num_threads( nChunks) if( nChunks > 1)
+      for( int c = 0; c < nChunks; ++c)
+	chunkStart[ c + 1] = CountLineEnds( b + n * c / nChunks, b + n * (c + 1) / nChunks);
+      for( int c = 0; c < nChunks; ++c)
+	chunkStart[ c + 1] += chunkStart[ c];
+
+      bool unterminated = (n > 0 && text[ n - 1] != '\n');
+      ends.resize( chunkStart[ nChunks] + (unterminated ? 1 : 0));
+#pragma omp parallel for num_threads( nChunks) if( nChunks > 1)
+      for( int c = 0; c < nChunks; ++c)
+	FillEnds( n * c / nChunks, n * (c + 1) / nChunks, chunkStart[ c]);
+      if( unterminated) ends.back() = n;
+      return true;
+    }
+
+    SizeT N() const { return ends.size();}
+
+    const char* Begin( SizeT k) const
+    {
+      return text.data() + ((k == 0) ? 0 : ends[ k - 1] + 1);
+    }
+
+    const char* End( SizeT k) const
+    {
+      const char* e = text.data() + ends[ k];
+      if( e > Begin( k) && e[ -1] == '\r') --e;
+      return e;
+    }
+
+    // only blanks and tabs (empty after STRTRIM)
+    bool Blank( SizeT k) const
+    {
+      for( const char* p = Begin( k); p < End( k); ++p)
+	if( *p != ' ' && *p != '\t') return false;
+      return true;
+    }
+  };
+
+  // [b, e) without leading and trailing blanks and tabs (STRTRIM( s, 2))
+  inline void Trim( const char*& b, const char*& e)
+  {
+    while( b < e && (*b == ' ' || *b == '\t')) ++b;
+    while( e > b && (e[ -1] == ' ' || e[ -1] == '\t')) --e;
+  }
+
+  // splits [b, e) at 'sep' into 'fields' (reusing its strings), returns
+  // the number of fields. A separator inside double quotes is part of the
+  // field, a doubled quote inside quotes is a quote, the other quotes are
+  // removed (the former split_csv_line of read_csv.pro)
+  SizeT SplitCSVLine( const char* b, const char* e, char sep, std::vector<std::string>& fields)
+  {
+    SizeT n = 0;
+    if( fields.empty()) fields.resize( 1);
+    fields[ 0].clear();
+    bool inside = false;
+    for( const char* p = b; p < e; ++p)
+      {
+	if( *p == '"')
+	  {
+	    if( !inside)
+	      inside = true;
+	    else if( p + 1 < e)
+	      {
+		if( p[ 1] == '"')
+		  {
+		    fields[ n] += '"';
+		    ++p;
+		  }
+		else
+		  inside = false;
+	      }
+	  }
+	else if( *p == sep && !inside)
+	  {
+	    if( ++n == fields.size()) fields.resize( n + 1);
+	    fields[ n].clear();
+	  }
+	else
+	  fields[ n] += *p;
+      }
+    return n + 1;
+  }
+
+  inline bool IsDigit( char c) { return c >= '0' && c <= '9';}
+
+  // '^[+-]?[0-9]*[.]?[0-9]*[DdE]?[+-]?[0-9]*$': what read_csv.pro took for
+  // a floating point number
+  bool FloatLike( const char* p, const char* e)
+  {
+    if( p < e && (*p == '+' || *p == '-')) ++p;
+    while( p < e && IsDigit( *p)) ++p;
+    if( p < e && *p == '.') ++p;
+    while( p < e && IsDigit( *p)) ++p;
+    if( p < e && (*p == 'D' || *p == 'd' || *p == 'E')) ++p;
+    if( p < e && (*p == '+' || *p == '-')) ++p;
+    while( p < e && IsDigit( *p)) ++p;
+    return p == e;
+  }
+
+  // '^[+-]?[0-9]+$'
+  bool IntegerLike( const char* p, const char* e)
+  {
+    if( p < e && (*p == '+' || *p == '-')) ++p;
+    if( p == e) return false;
+    while( p < e && IsDigit( *p)) ++p;
+    return p == e;
+  }
+
+  DType CSVType( const std::string& name)
+  {
+    std::string t = StrUpCase( name);
+    StrTrim( t);
+    if( t == "BYTE") return GDL_BYTE;
+    if( t == "INT") return GDL_INT;
+    if( t == "LONG") return GDL_LONG;
+    if( t == "FLOAT") return GDL_FLOAT;
+    if( t == "DOUBLE") return GDL_DOUBLE;
+    if( t == "UINT") return GDL_UINT;
+    if( t == "ULONG") return GDL_ULONG;
+    if( t == "LONG64") return GDL_LONG64;
+    if( t == "ULONG64") return GDL_ULONG64;
+    if( t == "STRING" || t == "DATE" || t == "TIME" || t == "DATETIME") return GDL_STRING;
+    return GDL_UNDEF;
+  }
+
+  // WRITE_CSV writes rows of blockRows lines per buffer, one buffer per thread
+  const SizeT blockRows = 1 << 14;
+
+  // one column of WRITE_CSV: its element i is data[ offset + i * stride]
+  struct CSVColumn
+  {
+    BaseGDL* data;
+    SizeT offset;
+    SizeT stride;
+  };
+
+  template <typename T>
+  inline void AppendSigned( std::string& out, T val)
+  {
+    if( val < 0)
+      {
+	out += '-';
+	FmtDigits( out, 0ULL - static_cast<unsigned long long>( val), 10, false);
+      }
+    else
+      FmtDigits( out, static_cast<unsigned long long>( val), 10, false);
+  }
+
+  // '"' + s + '"', with the quotes in s doubled
+  inline void AppendQuoted( std::string& out, const std::string& s)
+  {
+    out += '"';
+    for( SizeT i = 0; i < s.size(); ++i)
+      {
+	if( s[ i] == '"') out += '"';
+	out += s[ i];
+      }
+    out += '"';
+  }
+
+  template <typename T>
+  inline void AppendComplex( std::string& out, const T& c)
+  {
+    out += "\"(";
+    FmtGeneral( out, c.real(), 6, false, false);
+    out += ',';
+    FmtGeneral( out, c.imag(), 6, false, false);
+    out += ")\"";
+  }
+
+  // data[ ix] as write_csv.pro wrote it: STRING() of the value, complex
+  // values and strings in quotes (the blanks are removed later)
+  void AppendCSVValue( std::string& out, BaseGDL* data, SizeT ix)
+  {
+    switch( data->Type()) {
+    case GDL_BYTE:
+      {
+	// STRING() of a byte is its character
+	DByte b = (*static_cast<DByteGDL*>( data))[ ix];
+	if( b != 0) out += static_cast<char>( b);
+	break;
+      }
+    case GDL_INT: AppendSigned( out, (*static_cast<DIntGDL*>( data))[ ix]); break;
+    case GDL_UINT: AppendSigned( out, (*static_cast<DUIntGDL*>( data))[ ix]); break;
+    case GDL_LONG: AppendSigned( out, (*static_cast<DLongGDL*>( data))[ ix]); break;
+    case GDL_ULONG: AppendSigned( out, (*static_cast<DULongGDL*>( data))[ ix]); break;
+    case GDL_LONG64: AppendSigned( out, (*static_cast<DLong64GDL*>( data))[ ix]); break;
+    case GDL_ULONG64: AppendSigned( out, (*static_cast<DULong64GDL*>( data))[ ix]); break;
+    case GDL_FLOAT: AppendAuto( out, (*static_cast<DFloatGDL*>( data))[ ix], 13, 6); break;
+    case GDL_DOUBLE: AppendAuto( out, (*static_cast<DDoubleGDL*>( data))[ ix], 16, 8); break;
+    case GDL_COMPLEX: AppendComplex( out, (*static_cast<DComplexGDL*>( data))[ ix]); break;
+    case GDL_COMPLEXDBL: AppendComplex( out, (*static_cast<DComplexDblGDL*>( data))[ ix]); break;
+    case GDL_STRING: AppendQuoted( out, (*static_cast<DStringGDL*>( data))[ ix]); break;
+    default: break; // checked before
+    }
+  }
+
+  // STRCOMPRESS( out[ start:*], /REMOVE_ALL)
+  inline void RemoveBlanks( std::string& out, SizeT start)
+  {
+    SizeT d = start;
+    for( SizeT i = start; i < out.size(); ++i)
+      if( out[ i] != ' ' && out[ i] != '\t') out[ d++] = out[ i];
+    out.resize( d);
+  }
+
+  void AppendCSVRow( std::string& out, const std::vector<CSVColumn>& cols, SizeT row)
+  {
+    SizeT start = out.size();
+    for( SizeT c = 0; c < cols.size(); ++c)
+      {
+	if( c > 0) out += ',';
+	AppendCSVValue( out, cols[ c].data, cols[ c].offset + row * cols[ c].stride);
+      }
+    RemoveBlanks( out, start);
+    out += '\n';
+  }
+
+} // namespace
+
+namespace lib {
+
+  // READ_CSV: the lines of the file are found in parallel, the records
+  // are split into the columns in parallel, and each column is converted
+  // at once (in parallel, by Convert2) to the type its values suggest
+  BaseGDL* read_csv_fun( EnvT* e)
+  {
+    e->NParam( 1);
+    DString fileName;
+    e->AssureStringScalarPar( 0, fileName);
+    WordExp( fileName);
+
+    static int countIx = e->KeywordIx( "COUNT");
+    static int headerIx = e->KeywordIx( "HEADER");
+    static int missingIx = e->KeywordIx( "MISSING_VALUE");
+    static int nTableHeaderIx = e->KeywordIx( "N_TABLE_HEADER");
+    static int numRecordsIx = e->KeywordIx( "NUM_RECORDS");
+    static int recordStartIx = e->KeywordIx( "RECORD_START");
+    static int separatorIx = e->KeywordIx( "SEPARATOR");
+    static int tableHeaderIx = e->KeywordIx( "TABLE_HEADER");
+    static int typesIx = e->KeywordIx( "TYPES");
+
+    e->SetKW( countIx, new DLongGDL( 0));
+    e->SetKW( headerIx, new DStringGDL( ""));
+    e->SetKW( tableHeaderIx, new DStringGDL( ""));
+
+    DLong nSkip = 0, numRec = 0, startRec = 0;
+    e->AssureLongScalarKWIfPresent( nTableHeaderIx, nSkip);
+    e->AssureLongScalarKWIfPresent( numRecordsIx, numRec);
+    e->AssureLongScalarKWIfPresent( recordStartIx, startRec);
+    if( nSkip < 0) nSkip = 0;
+    if( startRec < 0) startRec = 0;
+
+    char sep = ',';
+    DStringGDL* sepKW = e->IfDefGetKWAs<DStringGDL>( separatorIx);
+    if( sepKW != NULL)
+      {
+	sep = (*sepKW)[ 0].empty() ? '\0' : (*sepKW)[ 0][ 0];
+	if( sep == '"') e->Throw( "separator must not be double quote.");
+      }
+
+    TextLines lines;
+    if( !lines.Read( fileName)) return new DLongGDL( 0);
+
+    SizeT nLines = lines.N();
+    if( nLines <= static_cast<SizeT>( startRec) + nSkip) return new DLongGDL( 0);
+
+    std::vector<std::string> fields;
+
+    // the first field of each table header line
+    SizeT ix = startRec;
+    if( nSkip > 0)
+      {
+	DStringGDL* tableHeader = new DStringGDL( dimension( nSkip), BaseGDL::NOZERO);
+	for( DLong i = 0; i < nSkip; ++i, ++ix)
+	  {
+	    SplitCSVLine( lines.Begin( ix), lines.End( ix), sep, fields);
+	    (*tableHeader)[ i] = fields[ 0];
+	  }
+	if( nSkip == 1)
+	  {
+	    e->SetKW( tableHeaderIx, new DStringGDL( (*tableHeader)[ 0]));
+	    delete tableHeader;
+	  }
+	else
+	  e->SetKW( tableHeaderIx, tableHeader);
+      }
+
+    // the first non blank line is the column header, it must be followed
+    // by at least one line
+    for( ;; ++ix)
+      {
+	if( ix + 1 >= nLines) return new DLongGDL( 0);
+	if( !lines.Blank( ix)) break;
+      }
+    SizeT nCols = SplitCSVLine( lines.Begin( ix), lines.End( ix), sep, fields);
+    DStringGDL* header = new DStringGDL( dimension( nCols), BaseGDL::NOZERO);
+    Guard<DStringGDL> headerGuard( header);
+    for( SizeT c = 0; c < nCols; ++c)
+      {
+	(*header)[ c] = fields[ c];
+	StrTrim( (*header)[ c]);
+      }
+
+    // the records: the non blank lines (the first numRec ones)
+    SizeT first = ix + 1;
+    std::vector<char> isBlank( nLines - first);
+    SizeT nRest = isBlank.size();
+    bool parallelLines = (CpuTPOOL_NTHREADS > 1 && nRest >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nRest));
+#pragma omp parallel for if( parallelLines)
+    for( OMPInt i = 0; i < nRest; ++i)
+      isBlank[ i] = lines.Blank( first + i);
+    std::vector<SizeT> records;
+    records.reserve( nRest);
+    for( SizeT i = 0; i < nRest; ++i)
+      {
+	if( isBlank[ i]) continue;
+	records.push_back( first + i);
+	if( numRec > 0 && records.size() >= static_cast<SizeT>( numRec)) break;
+      }
+    SizeT nRec = records.size();
+    if( nRec == 0) return new DLongGDL( 0);
+
+    std::vector<BaseGDL*> data;
+    StackGuard<std::vector<BaseGDL*> > dataGuard( data);
+    std::vector<DStringGDL*> cols( nCols);
+    for( SizeT c = 0; c < nCols; ++c)
+      {
+	cols[ c] = new DStringGDL( dimension( nRec));
+	data.push_back( cols[ c]);
+      }
+
+    // split the records; a column is LONG if all its non empty values
+    // look like integers, DOUBLE if they look like floating point numbers,
+    // STRING otherwise (and if it has no values at all)
+    std::vector<char> anyValue( nCols, 0), notFloat( nCols, 0), notInteger( nCols, 0);
+    bool parallelRecords = (CpuTPOOL_NTHREADS > 1 && nRec >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nRec));
+#pragma omp parallel if( parallelRecords)
+    {
+      std::vector<std::string> recFields;
+      std::vector<char> tAnyValue( nCols, 0), tNotFloat( nCols, 0), tNotInteger( nCols, 0);
+#pragma omp for
+      for( OMPInt r = 0; r < nRec; ++r)
+	{
+	  SizeT k = records[ r];
+	  SizeT nF = SplitCSVLine( lines.Begin( k), lines.End( k), sep, recFields);
+	  if( nF > nCols) nF = nCols;
+	  for( SizeT c = 0; c < nF; ++c)
+	    {
+	      const char* b = recFields[ c].data();
+	      const char* fEnd = b + recFields[ c].size();
+	      Trim( b, fEnd);
+	      if( b == fEnd) continue;
+	      (*cols[ c])[ r].assign( b, fEnd - b);
+	      tAnyValue[ c] = 1;
+	      if( tNotFloat[ c]) continue;
+	      if( !FloatLike( b, fEnd))
+		tNotFloat[ c] = 1;
+	      else if( !tNotInteger[ c] && !IntegerLike( b, fEnd))
+		tNotInteger[ c] = 1;
+	    }
+	}
+#pragma omp critical
+      for( SizeT c = 0; c < nCols; ++c)
+	{
+	  anyValue[ c] |= tAnyValue[ c];
+	  notFloat[ c] |= tNotFloat[ c];
+	  notInteger[ c] |= tNotInteger[ c];
+	}
+    }
+
+    std::vector<DType> colType( nCols);
+    for( SizeT c = 0; c < nCols; ++c)
+      colType[ c] = (!anyValue[ c] || notFloat[ c]) ? GDL_STRING :
+	(notInteger[ c] ? GDL_DOUBLE : GDL_LONG);
+
+    DStringGDL* types = e->IfDefGetKWAs<DStringGDL>( typesIx);
+    if( types != NULL)
+      {
+	SizeT nTypes = std::min<SizeT>( types->N_Elements(), nCols);
+	for( SizeT c = 0; c < nTypes; ++c)
+	  {
+	    DType t = CSVType( (*types)[ c]);
+	    if( t != GDL_UNDEF) colType[ c] = t;
+	  }
+      }
+
+    BaseGDL* missing = e->GetKW( missingIx);
+    if( missing != NULL && missing->N_Elements() == 0) missing = NULL;
+
+    bool allStrings = true;
+    for( SizeT c = 0; c < nCols; ++c)
+      {
+	std::vector<SizeT> empty;
+	if( missing != NULL)
+	  for( SizeT r = 0; r < nRec; ++r)
+	    if( (*cols[ c])[ r].empty()) empty.push_back( r);
+
+	if( colType[ c] != GDL_STRING)
+	  {
+	    BaseGDL* conv = cols[ c]->Convert2( colType[ c], BaseGDL::COPY);
+	    delete data[ c];
+	    data[ c] = conv;
+	    cols[ c] = NULL;
+	    allStrings = false;
+	  }
+
+	if( !empty.empty())
+	  {
+	    BaseGDL* m0 = missing->NewIx( 0);
+	    Guard<BaseGDL> m0Guard( m0);
+	    BaseGDL* m = m0->Convert2( data[ c]->Type(), BaseGDL::COPY_BYTE_AS_INT);
+	    Guard<BaseGDL> mGuard( m);
+	    for( SizeT i = 0; i < empty.size(); ++i)
+	      data[ c]->AssignAtIx( empty[ i], m);
+	  }
+      }
+
+    // a table of strings only has no header: it is its first line
+    if( allStrings)
+      for( SizeT c = 0; c < nCols; ++c)
+	{
+	  DStringGDL* withHeader = new DStringGDL( dimension( nRec + 1), BaseGDL::NOZERO);
+	  (*withHeader)[ 0] = (*header)[ c];
+	  for( SizeT r = 0; r < nRec; ++r)
+	    (*withHeader)[ r + 1].swap( (*cols[ c])[ r]);
+	  delete data[ c];
+	  data[ c] = cols[ c] = withHeader;
+	  (*header)[ c] = "";
+	}
+
+    DStructDesc* desc = new DStructDesc( "$truct");
+    DStructGDL* res = new DStructGDL( desc);
+    Guard<DStructGDL> resGuard( res);
+    for( SizeT c = 0; c < nCols; ++c)
+      res->NewTag( "FIELD" + i2s( c + 1), data[ c]);
+    data.clear(); // owned by res now
+
+    e->SetKW( countIx, new DLongGDL( nRec));
+    e->SetKW( headerIx, headerGuard.release());
+    return resGuard.release();
+  }
+
+  // GDL_SPLIT_COLUMNS( lines, delimiter [, nCol]): a STRARR( nCol,
+  // N_ELEMENTS( lines)) whose row i is STRSPLIT( lines[ i], delimiter,
+  // /EXTRACT), padded with empty strings. Without nCol it is the most
+  // fields in a line, with it a line must not have more.
+  BaseGDL* gdl_split_columns_fun( EnvT* e)
+  {
+    SizeT nParam = e->NParam( 2);
+    DStringGDL* text = e->GetParAs<DStringGDL>( 0);
+    DString delimiter;
+    e->AssureStringScalarPar( 1, delimiter);
+
+    bool isDelimiter[ 256] = { false };
+    for( SizeT i = 0; i < delimiter.size(); ++i)
+      isDelimiter[ static_cast<unsigned char>( delimiter[ i])] = true;
+
+    SizeT nLines = text->N_Elements();
+    // the (start, length) of the fields of each line
+    std::vector<std::vector<std::pair<SizeT, SizeT> > > fields( nLines);
+    bool parallelize = (CpuTPOOL_NTHREADS > 1 && nLines >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nLines));
+#pragma omp parallel for if( parallelize)
+    for( OMPInt i = 0; i < nLines; ++i)
+      {
+	const std::string& s = (*text)[ i];
+	SizeT len = s.size();
+	SizeT p = 0;
+	for( ;;)
+	  {
+	    while( p < len && isDelimiter[ static_cast<unsigned char>( s[ p])]) ++p;
+	    if( p == len) break;
+	    SizeT start = p;
+	    while( p < len && !isDelimiter[ static_cast<unsigned char>( s[ p])]) ++p;
+	    fields[ i].push_back( std::make_pair( start, p - start));
+	  }
+      }
+
+    SizeT nCol = 1; // a line of delimiters only is one empty field
+    for( SizeT i = 0; i < nLines; ++i)
+      if( fields[ i].size() > nCol) nCol = fields[ i].size();
+    if( nParam > 2)
+      {
+	DLong n;
+	e->AssureLongScalarPar( 2, n);
+	if( n < 1) e->Throw( "Number of columns must be positive: " + e->GetParString( 2));
+	if( nCol > static_cast<SizeT>( n))
+	  e->Throw( "A line has more than " + i2s( n) + " fields.");
+	nCol = n;
+      }
+
+    dimension dim( nCol, nLines);
+    dim.Purge();
+    DStringGDL* res = new DStringGDL( dim);
+#pragma omp parallel for if( parallelize)
+    for( OMPInt i = 0; i < nLines; ++i)
+      {
+	const std::string& s = (*text)[ i];
+	for( SizeT j = 0; j < fields[ i].size(); ++j)
+	  (*res)[ i * nCol + j] = s.substr( fields[ i][ j].first, fields[ i][ j].second);
+      }
+    return res;
+  }
+
+  // WRITE_CSV: the rows are formatted in parallel, blockRows rows into
+  // each buffer, and the buffers are written in order
+  void write_csv_pro( EnvT* e)
+  {
+    SizeT nParam = e->NParam();
+    if( nParam <= 1) e->Throw( "Incorrect number of arguments.");
+    BaseGDL* fileP = e->GetParDefined( 0);
+    if( fileP->Type() != GDL_STRING) e->Throw( "Filename must be a string.");
+    DString fileName = (*static_cast<DStringGDL*>( fileP))[ 0];
+    WordExp( fileName);
+
+    static int headerIx = e->KeywordIx( "HEADER");
+    static int tableHeaderIx = e->KeywordIx( "TABLE_HEADER");
+
+    BaseGDL* p1 = e->GetParDefined( 1);
+    bool isStruct = (p1->Type() == GDL_STRUCT);
+    bool isArray = (p1->Rank() == 2);
+    if( (isStruct || isArray) && nParam > 2) e->Throw( "Too many parameters.");
+
+    std::vector<CSVColumn> cols;
+    std::vector<BaseGDL*> gathered; // columns of a structure array
+    StackGuard<std::vector<BaseGDL*> > gatheredGuard( gathered);
+    std::vector<std::string> names; // the header line of a structure
+    SizeT nRows;
+    if( isStruct)
+      {
+	DStructGDL* s = static_cast<DStructGDL*>( p1);
+	SizeT nTags = s->Desc()->NTags();
+	SizeT nEl = s->N_Elements();
+	// a structure array: its tag t is the concatenation of all
+	// elements' tags t, as s.(t)
+	nRows = s->GetTag( 0)->N_Elements() * nEl;
+	for( SizeT t = 0; t < nTags; ++t)
+	  {
+	    names.push_back( s->Desc()->TagName( t));
+	    BaseGDL* tag = s->GetTag( t);
+	    SizeT tagN = tag->N_Elements();
+	    if( tagN * nEl < nRows)
+	      e->Throw( "Data fields must all have the same number of elements.");
+	    if( nEl > 1)
+	      {
+		tag = s->GetTag( t, 0)->New( dimension( tagN * nEl), BaseGDL::NOZERO);
+		gathered.push_back( tag);
+		for( SizeT i = 0; i < nEl; ++i)
+		  tag->InsertAt( i * tagN, s->GetTag( t, i), NULL);
+	      }
+	    CSVColumn col = { tag, 0, 1 };
+	    cols.push_back( col);
+	  }
+      }
+    else if( isArray)
+      {
+	SizeT nCols = p1->Dim( 0);
+	nRows = p1->Dim( 1);
+	for( SizeT c = 0; c < nCols; ++c)
+	  {
+	    CSVColumn col = { p1, c, nCols };
+	    cols.push_back( col);
+	  }
+      }
+    else
+      {
+	nRows = p1->N_Elements();
+	for( SizeT p = 1; p < nParam; ++p)
+	  {
+	    BaseGDL* par = e->GetParDefined( p);
+	    if( par->N_Elements() != nRows)
+	      e->Throw( "Data fields must all have the same number of elements.");
+	    CSVColumn col = { par, 0, 1 };
+	    cols.push_back( col);
+	  }
+      }
+    for( SizeT c = 0; c < cols.size(); ++c)
+      {
+	DType t = cols[ c].data->Type();
+	if( t == GDL_STRUCT || t == GDL_PTR || t == GDL_OBJ || t == GDL_UNDEF)
+	  e->Throw( "Cannot convert to this type.");
+      }
+
+    DStringGDL* header = e->IfDefGetKWAs<DStringGDL>( headerIx);
+    if( header != NULL && header->N_Elements() != cols.size())
+      e->Throw( "HEADER must have one element per column.");
+    DStringGDL* tableHeader = e->IfDefGetKWAs<DStringGDL>( tableHeaderIx);
+
+    FILE* fd = fopen( fileName.c_str(), "wb");
+    if( fd == NULL)
+      e->Throw( "Error opening file. File: " + fileName);
+
+    std::string head;
+    if( tableHeader != NULL)
+      for( SizeT i = 0; i < tableHeader->N_Elements(); ++i)
+	head += (*tableHeader)[ i] + '\n';
+    if( header != NULL || isStruct)
+      {
+	for( SizeT c = 0; c < cols.size(); ++c)
+	  {
+	    if( c > 0) head += ',';
+	    AppendQuoted( head, (header != NULL) ? (*header)[ c] : names[ c]);
+	  }
+	if( header == NULL) RemoveBlanks( head, 0);
+	head += '\n';
+      }
+    bool ok = (fwrite( head.data(), 1, head.size(), fd) == head.size());
+
+    SizeT nBlocks = (nRows + blockRows - 1) / blockRows;
+    SizeT nCells = nRows * cols.size();
+    int nThreads = (CpuTPOOL_NTHREADS > 1 && nCells >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCells)) ? CpuTPOOL_NTHREADS : 1;
+    std::vector<std::string> buffers( nThreads);
+    for( SizeT b0 = 0; ok && b0 < nBlocks; b0 += nThreads)
+      {
+	OMPInt nB = std::min<SizeT>( nThreads, nBlocks - b0);
+#pragma omp parallel for num_threads( nThreads) if( nThreads > 1)
+	for( OMPInt b = 0; b < nB; ++b)
+	  {
+	    std::string& buf = buffers[ b];
+	    buf.clear();
+	    SizeT rEnd = std::min<SizeT>( (b0 + b + 1) * blockRows, nRows);
+	    for( SizeT r = (b0 + b) * blockRows; r < rEnd; ++r)
+	      AppendCSVRow( buf, cols, r);
+	  }
+	for( OMPInt b = 0; ok && b < nB; ++b)
+	  ok = (fwrite( buffers[ b].data(), 1, buffers[ b].size(), fd) == buffers[ b].size());
+      }
+    if( fclose( fd) != 0) ok = false;
+    if( !ok) e->Throw( "Error writing file. File: " + fileName);
+  }
+
+} // namespace
@@ -0,0 +1,30 @@
+/***************************************************************************
+                          csv.hpp  -  delimited text files
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef CSV_HPP_
+#define CSV_HPP_
+
+namespace lib {
+
+  BaseGDL* read_csv_fun( EnvT* e);
+  void write_csv_pro( EnvT* e);
+
+  // the splitting of READ_ASCII
+  BaseGDL* gdl_split_columns_fun( EnvT* e);
+
+} // namespace
+
+#endif
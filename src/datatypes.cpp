@@ -327,7 +327,7 @@ template<class Sp> Data_<Sp>::Data_(const dimension& dim_, BaseGDL::InitType iT,
   if (iT == BaseGDL::NOZERO) return;  //very frequent
   else if (iT == BaseGDL::ZERO) { //rather frequent
     SizeT sz = dd.size();
-#pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     {
 #pragma omp for
       for (SizeT i = 0; i < sz; ++i) {
@@ -338,7 +338,7 @@ template<class Sp> Data_<Sp>::Data_(const dimension& dim_, BaseGDL::InitType iT,
   else if (iT == BaseGDL::INDGEN) { //less frequent
     SizeT sz = dd.size();
     if (off==0 && inc==1) { 
-      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
       {
         #pragma omp for
         for (SizeT i = 0; i < sz; ++i) {
@@ -346,7 +346,7 @@ template<class Sp> Data_<Sp>::Data_(const dimension& dim_, BaseGDL::InitType iT,
         }
       }
     } else {
-      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
       {
         #pragma omp for
         for (SizeT i = 0; i < sz; ++i) {
@@ -364,7 +364,7 @@ template<> Data_<SpDFloat>::Data_(const dimension& dim_, BaseGDL::InitType iT, D
   if (iT == BaseGDL::NOZERO) return;  //very frequent
   else if (iT == BaseGDL::ZERO) { //rather frequent
     SizeT sz = dd.size();
-#pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     {
 #pragma omp for
       for (SizeT i = 0; i < sz; ++i) {
@@ -375,7 +375,7 @@ template<> Data_<SpDFloat>::Data_(const dimension& dim_, BaseGDL::InitType iT, D
   else if (iT == BaseGDL::INDGEN) { //less frequent
     SizeT sz = dd.size();
     if (off==0 && inc==1) { 
-      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
       {
         #pragma omp for
         for (SizeT i = 0; i < sz; ++i) {
@@ -385,7 +385,7 @@ template<> Data_<SpDFloat>::Data_(const dimension& dim_, BaseGDL::InitType iT, D
     } else {
       DFloat f_off=off;
       DFloat f_inc=inc;
-      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
       {
         #pragma omp for
         for (SizeT i = 0; i < sz; ++i) {
@@ -403,7 +403,7 @@ template<> Data_<SpDComplex>::Data_(const dimension& dim_, BaseGDL::InitType iT,
   if (iT == BaseGDL::NOZERO) return;  //very frequent
   else if (iT == BaseGDL::ZERO) { //rather frequent
     SizeT sz = dd.size();
-#pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     {
 #pragma omp for
       for (SizeT i = 0; i < sz; ++i) {
@@ -414,7 +414,7 @@ template<> Data_<SpDComplex>::Data_(const dimension& dim_, BaseGDL::InitType iT,
   else if (iT == BaseGDL::INDGEN) { //less frequent
     SizeT sz = dd.size();
     if (off==0 && inc==1) { 
-      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
       {
         #pragma omp for
         for (SizeT i = 0; i < sz; ++i) {
@@ -424,7 +424,7 @@ template<> Data_<SpDComplex>::Data_(const dimension& dim_, BaseGDL::InitType iT,
     } else {
       DFloat f_off=off;
       DFloat f_inc=inc;
-      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+      #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
       {
         #pragma omp for
         for (SizeT i = 0; i < sz; ++i) {
@@ -454,7 +454,7 @@ template<> Data_<SpDPtr>::Data_(const dimension& dim_,  BaseGDL::InitType iT, DD
   if( iT != BaseGDL::NOALLOC && iT != BaseGDL::NOZERO)
     {
       SizeT sz = dd.size();
-    #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+    #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
 	{
 	#pragma omp for
       for( SizeT i=0; i<sz; ++i)
@@ -476,7 +476,7 @@ template<> Data_<SpDObj>::Data_(const dimension& dim_, BaseGDL::InitType iT, DDo
   if( iT != BaseGDL::NOALLOC && iT != BaseGDL::NOZERO)
     {
       SizeT sz = dd.size();
-    #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+    #pragma omp parallel if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
 	{
 	#pragma omp for
       for( SizeT i=0; i<sz; i++)
@@ -497,7 +497,7 @@ template<class Sp>
 Data_<Sp>::Data_(const Data_& d_) : Sp(d_.dim), dd(this->dim.NDimElements(), false) {
   this->dim.Purge(); //useful?
   SizeT sz = dd.size();
-#pragma omp parallel if (CpuTPOOL_NTHREADS > 1 && sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel if (CpuTPOOL_NTHREADS > 1 && sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
   {
 #pragma omp for
     for (SizeT i = 0; i < sz; i++) {
@@ -556,7 +556,7 @@ BaseGDL* Data_<SpDFloat>::Log()
       (*n)[ 0] = log( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for( SizeT i=0; i<nEl; ++i) (*n)[ i] = log( (*this)[ i]);
   return n;
 }
@@ -570,7 +570,7 @@ BaseGDL* Data_<SpDDouble>::Log()
       (*n)[ 0] = log( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i)  (*n)[ i] = log( (*this)[ i]);
   return n;
 }
@@ -584,7 +584,7 @@ BaseGDL* Data_<SpDComplex>::Log()
       (*n)[ 0] = log( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*n)[ i] = log( (*this)[ i]);
   return n;
 }
@@ -598,7 +598,7 @@ BaseGDL* Data_<SpDComplexDbl>::Log()
       (*n)[ 0] = log( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*n)[ i] = log( (*this)[ i]);
   return n;
 }
@@ -624,7 +624,7 @@ BaseGDL* Data_<SpDFloat>::LogThis()
       (*this)[ 0] = log( (*this)[ 0]);
       return this;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*this)[ i] = log( (*this)[ i]);
   return this;
 }
@@ -637,7 +637,7 @@ BaseGDL* Data_<SpDDouble>::LogThis()
       (*this)[ 0] = log( (*this)[ 0]);
       return this;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*this)[ i] = log( (*this)[ i]);
   return this;
 }
@@ -650,7 +650,7 @@ BaseGDL* Data_<SpDComplex>::LogThis()
       (*this)[ 0] = log( (*this)[ 0]);
       return this;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*this)[ i] = log( (*this)[ i]);
   return this;
 }
@@ -663,7 +663,7 @@ BaseGDL* Data_<SpDComplexDbl>::LogThis()
       (*this)[ 0] = log( (*this)[ 0]);
       return this;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*this)[ i] = log( (*this)[ i]);
   return this;
 }
@@ -686,7 +686,7 @@ BaseGDL* Data_<SpDFloat>::Log10()
       (*n)[ 0] = log10( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*n)[ i] = log10( (*this)[ i]);
   return n;
 }
@@ -700,7 +700,7 @@ BaseGDL* Data_<SpDDouble>::Log10()
       (*n)[ 0] = log10( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*n)[ i] = log10( (*this)[ i]);
   return n;
 }
@@ -714,7 +714,7 @@ BaseGDL* Data_<SpDComplex>::Log10()
       (*n)[ 0] = log10( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*n)[ i] = log10( (*this)[ i]);
   return n;
 }
@@ -728,7 +728,7 @@ BaseGDL* Data_<SpDComplexDbl>::Log10()
       (*n)[ 0] = log10( (*this)[ 0]);
       return n;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i) (*n)[ i] = log10( (*this)[ i]);
   return n;
 }
@@ -754,7 +754,7 @@ BaseGDL* Data_<SpDFloat>::Log10This()
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i)
       (*this)[ i] = log10( (*this)[ i]);
 #else
@@ -774,7 +774,7 @@ BaseGDL* Data_<SpDDouble>::Log10This()
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i)
       (*this)[ i] = log10( (*this)[ i]);
 #else
@@ -794,7 +794,7 @@ BaseGDL* Data_<SpDComplex>::Log10This()
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i)
       (*this)[ i] = log10( (*this)[ i]);
 #else
@@ -814,7 +814,7 @@ BaseGDL* Data_<SpDComplexDbl>::Log10This()
       return this;
     }
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for( SizeT i=0; i<nEl; ++i)
       (*this)[ i] = log10( (*this)[ i]);
 #else
@@ -1285,7 +1285,7 @@ BaseGDL* Data_<Sp>::Transpose( DUInt* perm) {
   SizeT nElem = dd.size();
   long chunksize = nElem;
   long nchunk = 1;
-  if (nElem > CpuTPOOL_MIN_ELTS) { //no use start parallel threading for small numbers.
+  if (nElem > CpuTPOOL_MIN_ELTS_ARITH) { //no use start parallel threading for small numbers.
     chunksize = nElem / ((CpuTPOOL_NTHREADS > 32) ? 32 : CpuTPOOL_NTHREADS);
     nchunk = nElem / chunksize;
     if (chunksize * nchunk < nElem) ++nchunk;
@@ -1352,7 +1352,7 @@ void Data_<Sp>::Reverse(DLong dim) {
   SizeT revStride = this->dim.Stride(dim);
   SizeT outerStride = this->dim.Stride(dim + 1);
   SizeT revLimit = this->dim[dim] * revStride;
-#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
+#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
   {
 #pragma omp for
     for (SizeT o = 0; o < nEl; o += outerStride) {
@@ -1380,7 +1380,7 @@ BaseGDL* Data_<Sp>::DupReverse(DLong dim) {
   SizeT revStride = this->dim.Stride(dim);
   SizeT outerStride = this->dim.Stride(dim + 1);
   SizeT revLimit = this->dim[dim] * revStride;
-#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
+#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
   {
 #pragma omp for
     for (SizeT o = 0; o < nEl; o += outerStride) {
@@ -1408,7 +1408,7 @@ BaseGDL* Data_<SpDPtr>::DupReverse( DLong dim) {
   SizeT revStride = this->dim.Stride(dim);
   SizeT outerStride = this->dim.Stride(dim + 1);
   SizeT revLimit = this->dim[dim] * revStride;
-#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
+#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
   {
 #pragma omp for
     for (SizeT o = 0; o < nEl; o += outerStride) {
@@ -1436,7 +1436,7 @@ BaseGDL* Data_<SpDObj>::DupReverse(DLong dim) {
   SizeT revStride = this->dim.Stride(dim);
   SizeT outerStride = this->dim.Stride(dim + 1);
   SizeT revLimit = this->dim[dim] * revStride;
-#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
+#pragma omp parallel //if ((nEl/outerStride)*revStride >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= (nEl/outerStride)*revStride))
   {
 #pragma omp for
     for (SizeT o = 0; o < nEl; o += outerStride) {
@@ -1551,7 +1551,7 @@ typename Data_<Sp>::Ty Data_<Sp>::Sum() const
   Ty s= dd[ 0];
   SizeT nEl = dd.size();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared( s)
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared( s)
     {
 #pragma omp for reduction(+:s)
       for( SizeT i=1; i<nEl; ++i)
@@ -1580,7 +1580,7 @@ Data_<SpDComplexDbl>::Ty Data_<SpDComplexDbl>::Sum() const
   DDouble si= dd[ 0].imag();
   SizeT nEl = dd.size();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared( sr,si)
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared( sr,si)
     {
 #pragma omp for reduction(+:si,sr)
   for( SizeT i=1; i<nEl; ++i)
@@ -1598,7 +1598,7 @@ Data_<SpDComplex>::Ty Data_<SpDComplex>::Sum() const
   DFloat si= dd[ 0].imag();
   SizeT nEl = dd.size();
   TRACEOMP( __FILE__, __LINE__)
-#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared( sr,si)
+#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) shared( sr,si)
     {
 #pragma omp for reduction(+:si,sr)
   for( SizeT i=1; i<nEl; ++i)
@@ -1791,7 +1791,7 @@ template< class Sp>
 void Data_<Sp>::Clear() 
 { 
   SizeT nEl = dd.size(); 
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for( SizeT i = 0; i<nEl; ++i) (*this)[ i] = Sp::zero;
@@ -1810,7 +1810,7 @@ void Data_<Sp>::Construct()
   {
   SizeT nEl = dd.size(); 
   //  for( SizeT i = 0; i<nEl; ++i) new (&(*this)[ i]) Ty;
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for( SizeT i = 0; i<nEl; ++i) new (&(dd[ i])) Ty;
@@ -1821,7 +1821,7 @@ void Data_<SpDPtr>::Construct()
 {
   SizeT nEl = dd.size(); 
   //  for( SizeT i = 0; i<nEl; ++i) new (&(*this)[ i]) Ty;
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for( SizeT i = 0; i<nEl; ++i) dd[ i] = 0;
@@ -1831,7 +1831,7 @@ void Data_<SpDObj>::Construct()
 {
   SizeT nEl = dd.size(); 
   //  for( SizeT i = 0; i<nEl; ++i) new (&(*this)[ i]) Ty;
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for( SizeT i = 0; i<nEl; ++i) dd[ i] = 0;
@@ -1873,7 +1873,7 @@ void Data_<Sp>::ConstructTo0()
   if( Sp::IS_POD)
   {
   SizeT nEl = dd.size(); 
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for( SizeT i = 0; i<nEl; ++i) (*this)[ i] = Sp::zero;
@@ -1881,7 +1881,7 @@ void Data_<Sp>::ConstructTo0()
   else
   {
   SizeT nEl = dd.size(); 
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for( SizeT i = 0; i<nEl; ++i) new (&(*this)[ i]) Ty( Sp::zero);
@@ -1923,7 +1923,7 @@ void Data_<Sp>::Destruct()
   if( !Sp::IS_POD)
   {
   SizeT nEl = dd.size(); 
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for( SizeT i = 0; i<nEl; ++i) 
@@ -1996,7 +1996,7 @@ Data_<Sp>* Data_<Sp>::New( const dimension& dim_, BaseGDL::InitType noZero) cons
     {
       Data_* res =  new Data_(dim_, BaseGDL::NOZERO);
       SizeT nEl = res->dd.size();
-      /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+      /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
 	{
 	#pragma omp for*/
       for( SizeT i=0; i<nEl; ++i) (*res)[ i] = (*this)[ 0]; // set all to scalar
@@ -2038,7 +2038,7 @@ template<> SizeT Data_<SpDString>::NBytes() const
 {
   SizeT nEl = dd.size();
   SizeT nB = 0;
-  #pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) reduction(+:nB)
+  #pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl)) reduction(+:nB)
   for( SizeT i=0; i<nEl; ++i)  nB += (*this)[i].size();
   return nB;
 }
@@ -3080,7 +3080,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn, ArrayIndexListT* ixList, SizeT offset)
 	{
 	  SizeT nCp=Data_::N_Elements();
 
-	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	    {
 	    #pragma omp for*/
 	  for( int c=0; c<nCp; ++c)
@@ -3092,7 +3092,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn, ArrayIndexListT* ixList, SizeT offset)
 	  SizeT nCp=ixList->N_Elements();
 	  
 	  AllIxBaseT* allIx = ixList->BuildIx();
-	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	    {
 	    #pragma omp for*/
 	  (*this)[ allIx->InitSeqAccess()]=scalar;
@@ -3114,7 +3114,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn, ArrayIndexListT* ixList, SizeT offset)
 	    else
 	      throw GDLException("Source expression contains not enough elements.");
 	  }
-	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	    {
 	    #pragma omp for*/
 	  for( int c=0; c<nCp; ++c)
@@ -3143,7 +3143,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn, ArrayIndexListT* ixList, SizeT offset)
 				       " source expression.");
 		  
 		  AllIxBaseT* allIx = ixList->BuildIx();
-		  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+		  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 		    {
 		    #pragma omp for*/
 		  (*this)[ allIx->InitSeqAccess()]=(*src)[0];
@@ -3158,7 +3158,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn, ArrayIndexListT* ixList, SizeT offset)
 				       " source expression.");
 		  
 		  AllIxBaseT* allIx = ixList->BuildIx();
-		  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+		  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 		    {
 		    #pragma omp for*/
 		  (*this)[ allIx->InitSeqAccess()]=(*src)[offset];
@@ -3193,7 +3193,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn, ArrayIndexListT* ixList)
 	  Ty scalar=(*src)[0];
 	  AllIxBaseT* allIx = ixList->BuildIx();
 	  (*this)[ allIx->InitSeqAccess()]=scalar;
-	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	    {
 	    #pragma omp for*/
 	  for( int c=1; c<nCp; ++c)
@@ -3221,7 +3221,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn, ArrayIndexListT* ixList)
 	  
 	  AllIxBaseT* allIx = ixList->BuildIx();
 	  (*this)[ allIx->InitSeqAccess()]=(*src)[0];
-	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+	  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	    {
 	    #pragma omp for*/
 	  for( int c=1; c<nCp; ++c)
@@ -3247,7 +3247,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn)
       SizeT nCp=Data_::N_Elements();
       
       
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       for( int c=0; c<nCp; ++c)
@@ -3265,7 +3265,7 @@ void Data_<Sp>::AssignAt( BaseGDL* srcIn)
       // if (non-indexed) src is smaller -> just copy its number of elements
       if( nCp > srcElem) nCp=srcElem;
       
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       for( int c=0; c<nCp; ++c)
@@ -3292,7 +3292,7 @@ void Data_<Sp>::DecAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
 
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()]--;
@@ -3316,7 +3316,7 @@ void Data_<Sp>::IncAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()]++;
@@ -3342,7 +3342,7 @@ void Data_<SpDFloat>::DecAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
 
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] -= 1.0f;
@@ -3367,7 +3367,7 @@ void Data_<SpDFloat>::IncAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] += 1.0f;
@@ -3392,7 +3392,7 @@ void Data_<SpDDouble>::DecAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] -= 1.0;
@@ -3417,7 +3417,7 @@ void Data_<SpDDouble>::IncAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] += 1.0f;
@@ -3435,7 +3435,7 @@ void Data_<SpDComplex>::DecAt( ArrayIndexListT* ixList)
 
       SizeT nCp=Data_::N_Elements();
       
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       for( int c=0; c<nCp; ++c)
@@ -3446,7 +3446,7 @@ void Data_<SpDComplex>::DecAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] -= 1.0;
@@ -3465,7 +3465,7 @@ void Data_<SpDComplex>::IncAt( ArrayIndexListT* ixList)
 
       SizeT nCp=Data_::N_Elements();
       
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       for( int c=0; c<nCp; ++c)
@@ -3476,7 +3476,7 @@ void Data_<SpDComplex>::IncAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] += 1.0;
@@ -3495,7 +3495,7 @@ void Data_<SpDComplexDbl>::DecAt( ArrayIndexListT* ixList)
 
       SizeT nCp=Data_::N_Elements();
       
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       for( int c=0; c<nCp; ++c)
@@ -3506,7 +3506,7 @@ void Data_<SpDComplexDbl>::DecAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] -= 1.0;
@@ -3525,7 +3525,7 @@ void Data_<SpDComplexDbl>::IncAt( ArrayIndexListT* ixList)
 
       SizeT nCp=Data_::N_Elements();
       
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       for( int c=0; c<nCp; ++c)
@@ -3536,7 +3536,7 @@ void Data_<SpDComplexDbl>::IncAt( ArrayIndexListT* ixList)
       SizeT nCp=ixList->N_Elements();
       
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ allIx->InitSeqAccess()] += 1.0;
@@ -3591,7 +3591,7 @@ void Data_<Sp>::InsertAt( SizeT offset, BaseGDL* srcIn,
     {
       SizeT nCp=src->N_Elements();
 
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       for( int c=0; c<nCp; ++c)
@@ -3602,7 +3602,7 @@ void Data_<Sp>::InsertAt( SizeT offset, BaseGDL* srcIn,
       SizeT nCp=ixList->N_Elements();
 
       AllIxBaseT* allIx = ixList->BuildIx();
-      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+      /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
 	{
 	#pragma omp for*/
       (*this)[ offset]=(*src)[ allIx->InitSeqAccess()];
@@ -3698,7 +3698,7 @@ Data_<Sp>* Data_<Sp>::Index( ArrayIndexListT* ixList)
     }
   //   else
   //   {
-  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
     {
     #pragma omp for*/
   (*res)[0]=(*this)[ allIx->InitSeqAccess()];
@@ -3850,7 +3850,7 @@ void Data_<Sp>::CatInsert (const Data_* srcArr, const SizeT atDim, SizeT& at)
   
 #ifdef _OPENMP
 //GD: speed up by using indexing that permit parallel and collapse. 
-#pragma omp parallel for collapse(2) if (len*nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= len*nCp))
+#pragma omp parallel for collapse(2) if (len*nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= len*nCp))
     for (OMPInt c = 0; c < nCp; ++c)
       {
         //            // copy one segment
@@ -4080,7 +4080,7 @@ T* Rebin1( T* src,
 	      }
       
 	  SizeT resEl = res->N_Elements();
-	  /*#pragma omp parallel if (resEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= resEl))
+	  /*#pragma omp parallel if (resEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= resEl))
 	    {
 	    #pragma omp for*/
 	  for( int r=0; r < resEl; ++r)
@@ -4560,7 +4560,7 @@ void Data_<Sp>::Assign( BaseGDL* src, SizeT nEl)
   {
     srcT = static_cast<Data_*>( src);
   }
-  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+  /*#pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for*/
   for(long k=0; k < nEl; ++k)
@@ -4584,7 +4584,7 @@ Data_<Sp>* Data_<Sp>::NewIx( AllIxBaseT* ix, const dimension* dIn)
 {
   SizeT nCp = ix->size();
   Data_* res=Data_::New( *dIn, BaseGDL::NOZERO);
-  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
     {
     #pragma omp for*/
   for( int c=0; c<nCp; ++c)
@@ -4597,7 +4597,7 @@ Data_<Sp>* Data_<Sp>::NewIxFrom( SizeT s)
 {
   SizeT nCp = dd.size() - s;
   Data_* res=Data_::New( dimension( nCp), BaseGDL::NOZERO);
-  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
     {
     #pragma omp for*/
   for( int c=0; c<nCp; ++c)
@@ -4610,7 +4610,7 @@ Data_<Sp>* Data_<Sp>::NewIxFrom( SizeT s, SizeT e)
 {
   SizeT nCp = e - s + 1;
   Data_* res=Data_::New( dimension( nCp), BaseGDL::NOZERO);
-  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
+  /*#pragma omp parallel if (nCp >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nCp))
     {
     #pragma omp for*/
   for( int c=0; c<nCp; ++c)
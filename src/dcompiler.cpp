@@ -307,8 +307,13 @@ void DCompiler::EndFun() // inserts in funList
   else
   {
     (*searchList).push_back(static_cast<DFun*>(pro));
-    // sort list again, however item should be inserted at good position in fact (more tricky but would save sort time). TODO.
-   sort( libFunList.begin(), libFunList.end(), CompLibFunName());
+    // the function index picks the appended entry up on its next lookup.
+    // libFunList is only out of order after DLMs were added to it
+    if( !is_sorted( libFunList.begin(), libFunList.end(), CompLibFunName()))
+      {
+	sort( libFunList.begin(), libFunList.end(), CompLibFunName());
+	InvalidateLibFunIndex();
+      }
    WarnAboutObsoleteRoutine(pro->ObjectName());
   }
 
@@ -32,6 +32,7 @@
 
 
 #include "ofmt.hpp"
+#include "fmtnum.hpp" // ScanLong
 #include "gdljournal.hpp"
 #include "list.hpp"
 #include "hash.hpp"
@@ -141,6 +142,51 @@ const string ReadElement(istream& is)
 //   return retStr;
 }
 
+// ReadElement() for the elements of an array: the same tokens, taken
+// straight from the stream buffer (no sentry per character, no string
+// per element)
+class ElementScanner
+{
+  istream&   is;
+  streambuf* sb;
+  string     buf;
+
+public:
+  explicit ElementScanner( istream& is_): is( is_), sb( is_.rdbuf())
+  {
+    // as the sentry of is.get() does (e.g. a prompt before reading stdin)
+    if( is.tie() != NULL) is.tie()->flush();
+  }
+
+  const char* Next()
+  {
+    const int eof = istream::traits_type::eof();
+
+    if( is.eof())
+      throw GDLIOException( "End of file encountered. "+
+			  StreamInfo( &is));
+
+    int c = sb->sgetc();
+    while( c == ' ' || c == '\t' || c == '\n' || c == '\r')
+      c = sb->snextc();
+    if( c == eof)
+      {
+	is.setstate( ios_base::eofbit | ios_base::failbit);
+	throw GDLIOException( "End of file encountered. "+
+			    StreamInfo( &is));
+      }
+
+    buf.clear();
+    do {
+      buf.push_back( static_cast<char>( c));
+      c = sb->snextc();
+    } while( c != eof && c != '\n' && c != ' ' && c != '\t');
+    if( c == '\n') sb->sbumpc();
+
+    return buf.c_str();
+  }
+};
+
 // no skip of WS
 const string ReadComplexElement(istream& is)
 {
@@ -236,18 +282,23 @@ istream& operator>>(istream& i, Data_<Sp>& data_)
   long int nTrans =  data_.dd.size();
   SizeT assignIx = 0;
 
+  ElementScanner scanner( i);
   while( nTrans > 0)
     {
-      const string segment = ReadElement( i);
-
-      const char* cStart=segment.c_str();
-      char* cEnd;
-      data_[ assignIx] = strtol( cStart, &cEnd, 10);
-      if( cEnd == cStart)
+      const char* cStart=scanner.Next();
+      long val;
+      const char* fastEnd;
+      if( !ScanLong( cStart, val, &fastEnd))
 	{
-	  data_[ assignIx]= -1;
-	  ThrowGDLException("Input conversion error.");
+	  char* cEnd;
+	  val = strtol( cStart, &cEnd, 10);
+	  if( cEnd == cStart)
+	    {
+	      data_[ assignIx]= -1;
+	      ThrowGDLException("Input conversion error.");
+	    }
 	}
+      data_[ assignIx] = val;
 	  
       assignIx++;
       nTrans--;
@@ -256,17 +307,17 @@ istream& operator>>(istream& i, Data_<Sp>& data_)
   return i;
 }
 
-// float : uses StrToD (character D in string)
+// float : uses StrToD (character D in string, common cases without strtod)
 template<> 
 istream& operator>>(istream& i, Data_<SpDFloat>& data_) 
 {
   long int nTrans =  data_.dd.size();
   SizeT assignIx = 0;
 
+  ElementScanner scanner( i);
   while( nTrans > 0)
     {
-      const string segment = ReadElement( i);
-      const char* cStart=segment.c_str();
+      const char* cStart=scanner.Next();
       char* cEnd;
       data_[ assignIx] = StrToD( cStart, &cEnd);
       if( cEnd == cStart)
@@ -288,10 +339,10 @@ istream& operator>>(istream& i, Data_<SpDDouble>& data_)
   long int nTrans =  data_.dd.size();
   SizeT assignIx = 0;
 
+  ElementScanner scanner( i);
   while( nTrans > 0)
     {
-      const string segment = ReadElement( i);
-      const char* cStart=segment.c_str();
+      const char* cStart=scanner.Next();
       char* cEnd;
       data_[ assignIx] = StrToD( cStart, &cEnd);
       if( cEnd == cStart)
@@ -574,6 +625,129 @@ istream& operator>>(istream& i, DStructGDL& data_)
 // end input *********************************************************
 
 // the default output functions
+
+// The default output of numeric arrays goes through one buffer, as the
+// formatted output (OutFormatted() in ofmt.cpp): the elements, which all
+// have the same width, are formatted block by block (in parallel for large
+// arrays), then the lines are assembled with the breaks CheckNL and InsNL
+// would insert and written with os.write()
+static const SizeT defaultOutBlockSize = 1 << 20;
+static const SizeT defaultOutFlushSize = 1 << 16;
+
+template <typename T>
+class DefaultIntegerFormatter {
+  int width;
+public:
+  DefaultIntegerFormatter( int w): width( w) {}
+  SizeT Width() const { return width; }
+  // as ostream << setw( width) << val
+  void operator()( std::string& out, const T& val) const {
+    std::string::size_type start = out.size();
+    if( val < 0) {
+      out += '-';
+      FmtDigits( out, 0ULL - static_cast<unsigned long long>( val), 10, false);
+    } else
+      FmtDigits( out, static_cast<unsigned long long>( val), 10, false);
+    FmtFit( out, start, width, false, false);
+  }
+};
+
+template <typename T>
+class DefaultFloatFormatter {
+  int width, prec;
+public:
+  DefaultFloatFormatter( int w, int p): width( w), prec( p) {}
+  SizeT Width() const { return width; }
+  void operator()( std::string& out, const T& val) const {
+    AppendAuto( out, val, width, prec, 0);
+  }
+};
+
+template <typename T>
+class DefaultComplexFormatter {
+  int width, prec;
+public:
+  DefaultComplexFormatter( int w, int p): width( w), prec( p) {}
+  SizeT Width() const { return 2*width+3; }
+  // as ostream << AsComplex<T>
+  void operator()( std::string& out, const T& val) const {
+    out += '(';
+    AppendAuto( out, val.real(), width, prec, 0);
+    out += ',';
+    AppendAuto( out, val.imag(), width, prec, 0);
+    out += ')';
+  }
+};
+
+template <typename T, typename Formatter>
+static void OutDefault( ostream& o, const T* data, SizeT nElem, SizeT d0, SizeT d1,
+			SizeT w, SizeT* actPosPtr, const Formatter& fmt)
+{
+  const SizeT width = fmt.Width();
+  const SizeT blockLen = d0 * d1; // a '\n' more after each one but the last
+
+  GDLStream* journal = lib::get_journal();
+  const bool toJournal = (journal != NULL && journal->OStream().rdbuf() == o.rdbuf());
+  SizeT actPos = (actPosPtr != NULL) ? *actPosPtr : 0;
+
+  int nChunks = 1;
+  if( CpuTPOOL_NTHREADS > 1 && nElem >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElem))
+    nChunks = CpuTPOOL_NTHREADS;
+  std::vector<std::string> fields( nChunks);
+  std::string out;
+  out.reserve( defaultOutFlushSize + 2 * width + 64);
+
+  SizeT eIx = 0; // linear counter
+  for( SizeT b = 0; b < nElem; b += defaultOutBlockSize)
+    {
+      SizeT nB = std::min( defaultOutBlockSize, nElem - b);
+      const T* blk = data + b;
+#pragma omp parallel for num_threads(nChunks) if (nChunks > 1)
+      for( int c = 0; c < nChunks; ++c)
+	{
+	  SizeT from = nB * c / nChunks;
+	  SizeT to = nB * (c + 1) / nChunks;
+	  std::string& f = fields[ c];
+	  f.clear();
+	  f.reserve( (to - from) * width);
+	  for( SizeT i = from; i < to; ++i) fmt( f, blk[ i]);
+	}
+      for( int c = 0; c < nChunks; ++c)
+	{
+	  const std::string& f = fields[ c];
+	  for( SizeT fIx = 0; fIx < f.size(); fIx += width)
+	    {
+	      // CheckNL
+	      if( actPosPtr != NULL)
+		{
+		  if( (actPos + width) > w && actPos > 0)
+		    {
+		      out += '\n';
+		      actPos = 0;
+		    }
+		  if( actPos == 0 && toJournal) out += lib::JOURNALCOMMENT;
+		  actPos += width;
+		}
+	      out.append( f, fIx, width);
+	      ++eIx;
+	      // InsNL
+	      if( eIx % d0 == 0)
+		{
+		  out += '\n';
+		  actPos = 0;
+		  if( eIx % blockLen == 0 && eIx < nElem) out += '\n';
+		}
+	      if( out.size() >= defaultOutFlushSize)
+		{
+		  o.write( out.data(), out.size());
+		  out.clear();
+		}
+	    }
+	}
+    }
+  o.write( out.data(), out.size());
+  if( actPosPtr != NULL) *actPosPtr = actPos;
+}
 template<class Sp> 
 ostream& Data_<Sp>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr) 
 {
@@ -589,33 +763,13 @@ ostream& Data_<Sp>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem / this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, 8) << setw(8) << (*this)[eIx++];
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, 8) << setw(8) << (*this)[eIx++];
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultIntegerFormatter<Ty>( 8));
   return o;
 }
 
@@ -635,33 +789,13 @@ ostream& Data_<SpDLong>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem / this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, 12) << setw(12) << (*this)[eIx++];
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, 12) << setw(12) << (*this)[eIx++];
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultIntegerFormatter<Ty>( 12));
   return o;
 }
 
@@ -681,33 +815,13 @@ ostream& Data_<SpDULong>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, 12) << setw(12) << (*this)[eIx++];
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, 12) << setw(12) << (*this)[eIx++];
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultIntegerFormatter<Ty>( 12));
   return o;
 }
 
@@ -727,33 +841,13 @@ ostream& Data_<SpDLong64>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, 22) << setw(22) << (*this)[eIx++];
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, 22) << setw(22) << (*this)[eIx++];
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultIntegerFormatter<Ty>( 22));
   return o;
 }
 
@@ -773,33 +867,13 @@ ostream& Data_<SpDULong64>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, 22) << setw(22) << (*this)[eIx++];
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, 22) << setw(22) << (*this)[eIx++];
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultIntegerFormatter<Ty>( 22));
   return o;
 }
 
@@ -997,39 +1071,13 @@ ostream& Data_<SpDFloat>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    {
-	      o << CheckNL( w, actPosPtr, width);
-	      OutAuto( o, (*this)[eIx++], width, prec, 0);
-	    }
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	{
-	  o << CheckNL( w, actPosPtr, width); 
-	  OutAuto( o, (*this)[eIx++], width, prec, 0);
-	}
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultFloatFormatter<Ty>( width, prec));
   return o;
 }
 // double
@@ -1052,39 +1100,13 @@ ostream& Data_<SpDDouble>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    {
-	      o << CheckNL( w, actPosPtr, width); 
-	      OutAuto( o, (*this)[eIx++], width, prec, 0);
-	    }
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	{
-	  o << CheckNL( w, actPosPtr, width); 
-	  OutAuto( o, (*this)[eIx++], width, prec, 0);
-	}
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultFloatFormatter<Ty>( width, prec));
   return o;
 }
 
@@ -1107,33 +1129,13 @@ ostream& Data_<SpDComplex>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, 2*width+3) << AsComplex< DComplex>( (*this)[eIx++], width, prec, fill);
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, 2*width+3) << AsComplex< DComplex>( (*this)[eIx++], width, prec, fill);
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultComplexFormatter<Ty>( width, prec));
   return o;
 }
 template<> 
@@ -1155,33 +1157,13 @@ ostream& Data_<SpDComplexDbl>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, 2*width+3) << AsComplex< DComplexDbl>( (*this)[eIx++], width, prec, fill);
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, 2*width+3) << AsComplex< DComplexDbl>( (*this)[eIx++], width, prec, fill);
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultComplexFormatter<Ty>( width, prec));
   return o;
 }
 
@@ -1203,33 +1185,13 @@ ostream& Data_<SpDByte>::ToStream(ostream& o, SizeT w, SizeT* actPosPtr)
       return o;
     }
 
-  SizeT nLoop=nElem/this->dim.Stride(2);
-  SizeT eIx=0; // linear counter
   SizeT d0=this->Dim(0); 
   SizeT d1=this->Dim(1);
 
   // d0 cannot be 0
   if( d1 == 0) d1 = 1;
 
-  for( SizeT l=1; l<nLoop; l++)
-    {
-      for( SizeT i1=0; i1<d1; i1++)
-	{
-	  for( SizeT i0=0; i0<d0; i0++)
-	    o << CheckNL( w, actPosPtr, width) << setw(width) << static_cast<int>((*this)[eIx++]);
-	  InsNL( o, actPosPtr);
-	}
-      InsNL( o, actPosPtr);
-    }
-
-  // last block (no '\n' at the end)
-  for( SizeT i1=0; i1<d1; i1++)
-    {
-      for( SizeT i0=0; i0<d0; i0++)
-	o << CheckNL( w, actPosPtr, width) << setw(width) << static_cast<int>((*this)[eIx++]);
-      //      if( (i1+1) < d1) InsNL( o, actPosPtr);
-      InsNL( o, actPosPtr);
-    }
+  OutDefault( o, &(*this)[0], nElem, d0, d1, w, actPosPtr, DefaultIntegerFormatter<Ty>( width));
   return o;
 }
 
@@ -27,12 +27,16 @@
 //#include <wordexp.h>
 
 #include "dnodefactory.hpp"
+#include "astcache.hpp"
 #include "str.hpp"
 #include "envt.hpp"
 #include "dinterpreter.hpp"
 #include "gdljournal.hpp"
 #include "gdleventhandler.hpp"
 #include "basic_pro_jmg.hpp"
+#include "list.hpp"
+#include "gdlbufferpool.hpp"
+#include "gdlregex.hpp"
 
 #ifdef USE_MPI
 #include "mpi.h"
@@ -604,8 +608,11 @@ bool GDLInterpreter::CompileFile(const string& f, const string& untilPro, bool s
   ifstream in(f.c_str());
   if( !in) return false; // maybe throw exception here
   
-  RefDNode theAST;
+  // unchanged file parsed by a previous session?
+  RefDNode theAST = ASTCache::Load( f, untilPro, searchForPro);
+  if( !theAST) {
   try {  
+    ASTCache::IsFunLog isFunLog;
     GDLLexer   lexer(in, f, GDLParser::NONE, untilPro, searchForPro);
     GDLParser& parser=lexer.Parser();
     
@@ -619,6 +626,9 @@ bool GDLInterpreter::CompileFile(const string& f, const string& untilPro, bool s
 	cout << "No parser output generated." << endl;
 	return false;
       }	
+
+    // before the tree parser modifies the AST
+    ASTCache::Store( f, untilPro, searchForPro, isFunLog, theAST);
   }
   catch( GDLException& e)
     {
@@ -630,6 +640,7 @@ bool GDLInterpreter::CompileFile(const string& f, const string& untilPro, bool s
       cerr << "Lexer/Parser exception: " <<  e.getMessage() << endl;
       return false;
     }
+  }
 
 #ifdef GDL_DEBUG
   cout << "Parser output:" << endl;
@@ -1015,6 +1026,9 @@ DInterpreter::CommandCode DInterpreter::ExecuteLine( istream* in, SizeT lineOffs
 {
   string line = (in != NULL) ? ::GetLine(in) : GetLine();
 
+  // files created by the previous lines are found
+  NewPathListingPass();
+
   // cout << "ExecuteLine: " << line << endl;
 
   string firstChar = line.substr(0,1);
@@ -1777,6 +1791,9 @@ RetCode DInterpreter::InterpreterLoop(const string& startup,
       } else {
         DInterpreter::CommandCode ret = ExecuteLine();
 
+        // back at the prompt: do not keep large buffers while idle
+        BufferPool::Release();
+
         // stop steppig when at main level
         stepCount = 0;
         debugMode = DEBUG_CLEAR;
@@ -1811,10 +1828,14 @@ RetCode DInterpreter::InterpreterLoop(const string& startup,
 
         ResetObjects();
         ResetHeap();
+        ResetLISTNodeIndex();
+        BufferPool::Release();
+        RegexCache::Release();
         if (fullResetCmd) {
           lib::ResetDLLs();
           PurgeContainer(libFunList);
           PurgeContainer(libProList);
+          InvalidateRoutineIndex();
         }
         // initially done in InitGDL()
         // initializations
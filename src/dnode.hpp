@@ -388,6 +388,7 @@ private:
   friend class ProgNode;
   friend class DCompiler;
   friend class GDLTreeParser;
+  friend class ASTCacheIO;
 
 // private:
 //   // forbid usage of these
@@ -73,8 +73,14 @@ void DStructGDL::operator delete( void *ptr)
 	UNLOCK_MUTEXNEWDELETE
 }
 
+// hash.cpp: native key index of HASH tables
+void DropHashKeyIndex( DStructGDL* hashTable);
+
 DStructGDL::~DStructGDL() 
 {  
+  if( Desc() == structDesc::GDL_HASHTABLEENTRY)
+    DropHashKeyIndex( this);
+
   if( dd.size() == 0)
     {
       SizeT nTags = NTags();
@@ -0,0 +1,456 @@
+/***************************************************************************
+                          exprfusion.cpp  -  fused evaluation of elementwise expressions
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "includefirst.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+#include "exprfusion.hpp"
+#include "prognodeexpr.hpp"
+#include "datatypes.hpp"
+#include "gdlexception.hpp"
+#include "math_fun.hpp"
+#include "str.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+  // below this, the plain evaluation is as fast
+  const SizeT fuseMinElts = 4096;
+
+  // elements per tile: the tile buffers of one thread stay in cache
+  const SizeT fuseTile = 1024;
+
+  struct FusedFun
+  {
+    LibFunDirect       fun;
+    FusedExpr::OpCode  op;
+  };
+
+  const FusedFun fusedFuns[] = {
+    { lib::sin_fun,    FusedExpr::SIN},
+    { lib::cos_fun,    FusedExpr::COS},
+    { lib::tan_fun,    FusedExpr::TAN},
+    { lib::exp_fun,    FusedExpr::EXP},
+    { lib::alog_fun,   FusedExpr::ALOG},
+    { lib::alog10_fun, FusedExpr::ALOG10},
+    { lib::sqrt_fun,   FusedExpr::SQRT},
+    { lib::abs_fun,    FusedExpr::ABS},
+  };
+
+  bool Transcendental( FusedExpr::OpCode op)
+  {
+    return op >= FusedExpr::SIN && op <= FusedExpr::SQRT;
+  }
+
+  // an operand on the evaluation stack: either a scalar or a pointer to
+  // the current tile (of a leaf array or of a tile buffer)
+  template< typename T>
+  struct Operand
+  {
+    const T* p;
+    T        s;
+    bool     scalar;
+  };
+
+  // the results must be bitwise identical to those of basic_op*.cpp,
+  // math_fun.cpp and datatypes.cpp (e.g. ALOG of a FLOAT goes through
+  // the double log() there)
+  template< typename T>
+  inline T Apply( FusedExpr::OpCode op, T a)
+  {
+    switch( op)
+      {
+      case FusedExpr::NEG:    return -a;
+      case FusedExpr::SIN:    return std::sin( a);
+      case FusedExpr::COS:    return std::cos( a);
+      case FusedExpr::TAN:    return std::tan( a);
+      case FusedExpr::EXP:    return std::exp( a);
+      case FusedExpr::ALOG:   return log( static_cast<double>( a));
+      case FusedExpr::ALOG10: return log10( static_cast<double>( a));
+      case FusedExpr::SQRT:   return std::sqrt( a);
+      case FusedExpr::ABS:    return std::abs( a);
+      default:                assert( false); return a;
+      }
+  }
+
+  template< typename T, typename OP>
+  void Binary( Operand<T>& a, const Operand<T>& b, T* dst, SizeT n, OP op)
+  {
+    if( a.scalar && b.scalar)
+      {
+	a.s = op( a.s, b.s);
+	return;
+      }
+    if( a.scalar)
+      {
+	const T s = a.s; const T* pb = b.p;
+	for( SizeT i = 0; i < n; ++i) dst[ i] = op( s, pb[ i]);
+      }
+    else if( b.scalar)
+      {
+	const T* pa = a.p; const T s = b.s;
+	for( SizeT i = 0; i < n; ++i) dst[ i] = op( pa[ i], s);
+      }
+    else
+      {
+	const T* pa = a.p; const T* pb = b.p;
+	for( SizeT i = 0; i < n; ++i) dst[ i] = op( pa[ i], pb[ i]);
+      }
+    a.p = dst;
+    a.scalar = false;
+  }
+
+  // one loop per function, so that the switch is not inside the loop
+  template< typename T, FusedExpr::OpCode OP>
+  void UnaryLoop( const T* src, T* dst, SizeT n)
+  {
+    for( SizeT i = 0; i < n; ++i) dst[ i] = Apply<T>( OP, src[ i]);
+  }
+
+  template< typename T>
+  void Unary( FusedExpr::OpCode op, Operand<T>& a, T* dst, SizeT n)
+  {
+    if( a.scalar)
+      {
+	a.s = Apply<T>( op, a.s);
+	return;
+      }
+    switch( op)
+      {
+      case FusedExpr::NEG:    UnaryLoop<T, FusedExpr::NEG>( a.p, dst, n); break;
+      case FusedExpr::SIN:    UnaryLoop<T, FusedExpr::SIN>( a.p, dst, n); break;
+      case FusedExpr::COS:    UnaryLoop<T, FusedExpr::COS>( a.p, dst, n); break;
+      case FusedExpr::TAN:    UnaryLoop<T, FusedExpr::TAN>( a.p, dst, n); break;
+      case FusedExpr::EXP:    UnaryLoop<T, FusedExpr::EXP>( a.p, dst, n); break;
+      case FusedExpr::ALOG:   UnaryLoop<T, FusedExpr::ALOG>( a.p, dst, n); break;
+      case FusedExpr::ALOG10: UnaryLoop<T, FusedExpr::ALOG10>( a.p, dst, n); break;
+      case FusedExpr::SQRT:   UnaryLoop<T, FusedExpr::SQRT>( a.p, dst, n); break;
+      case FusedExpr::ABS:    UnaryLoop<T, FusedExpr::ABS>( a.p, dst, n); break;
+      default: assert( false);
+      }
+    a.p = dst;
+    a.scalar = false;
+  }
+
+  template< typename T> struct Plus  { T operator()( T a, T b) const { return a + b;}};
+  template< typename T> struct Minus { T operator()( T a, T b) const { return a - b;}};
+  template< typename T> struct Times { T operator()( T a, T b) const { return a * b;}};
+  template< typename T> struct Slash { T operator()( T a, T b) const { return a / b;}};
+
+  // arr[ k] is NULL for scalar leaves, whose value is in scal[ k]
+  template< typename T>
+  void Run( const vector<FusedExpr::Instr>& prog, int maxDepth,
+	    const vector<const T*>& arr, const vector<T>& scal,
+	    T* out, SizeT nEl, bool parallel)
+  {
+    const OMPInt nTiles = (nEl + fuseTile - 1) / fuseTile;
+    const SizeT nInstr = prog.size();
+
+#pragma omp parallel if (parallel)
+    {
+      // one tile buffer per stack level
+      vector<T> buf( maxDepth * fuseTile);
+      vector< Operand<T> > stack( maxDepth);
+
+#pragma omp for
+      for( OMPInt t = 0; t < nTiles; ++t)
+	{
+	  const SizeT start = t * fuseTile;
+	  const SizeT n = std::min( fuseTile, nEl - start);
+	  int sp = 0;
+	  for( SizeT ix = 0; ix < nInstr; ++ix)
+	    {
+	      const FusedExpr::Instr& in = prog[ ix];
+	      if( in.op == FusedExpr::LEAF)
+		{
+		  Operand<T>& o = stack[ sp++];
+		  if( arr[ in.leaf] == NULL)
+		    {
+		      o.s = scal[ in.leaf];
+		      o.scalar = true;
+		    }
+		  else
+		    {
+		      o.p = arr[ in.leaf] + start;
+		      o.scalar = false;
+		    }
+		  continue;
+		}
+	      bool binary = (in.op == FusedExpr::ADD || in.op == FusedExpr::SUB ||
+			     in.op == FusedExpr::MUL || in.op == FusedExpr::DIV);
+	      if( binary) --sp;
+	      // the result replaces the (first) argument on the stack,
+	      // the last instruction writes directly into the result
+	      T* dst = (ix + 1 == nInstr) ? out + start : &buf[ (sp - 1) * fuseTile];
+	      switch( in.op)
+		{
+		case FusedExpr::ADD:
+		case FusedExpr::SUB:
+		case FusedExpr::MUL:
+		case FusedExpr::DIV:
+		  {
+		    Operand<T>& a = stack[ sp - 1];
+		    if( in.op == FusedExpr::ADD)
+		      Binary( a, stack[ sp], dst, n, Plus<T>());
+		    else if( in.op == FusedExpr::SUB)
+		      Binary( a, stack[ sp], dst, n, Minus<T>());
+		    else if( in.op == FusedExpr::MUL)
+		      Binary( a, stack[ sp], dst, n, Times<T>());
+		    else
+		      Binary( a, stack[ sp], dst, n, Slash<T>());
+		    break;
+		  }
+		default:
+		  Unary( in.op, stack[ sp - 1], dst, n);
+		}
+	    }
+	  assert( sp == 1 && !stack[ 0].scalar);
+	}
+    }
+  }
+
+  template< typename T>
+  BaseGDL* Evaluate( const vector<FusedExpr::Instr>& prog, int maxDepth,
+		     const vector<BaseGDL*>& val, const dimension& dim,
+		     SizeT nEl, bool transcendental)
+  {
+    typedef typename T::Ty Ty;
+    const DType t = T::t;
+
+    const SizeT nLeaves = val.size();
+    vector<const Ty*> arr( nLeaves, NULL);
+    vector<Ty> scal( nLeaves, Ty( 0));
+    vector<BaseGDL*> converted;
+    try {
+      for( SizeT k = 0; k < nLeaves; ++k)
+	{
+	  BaseGDL* v = val[ k];
+	  if( v->Type() != t)
+	    {
+	      v = v->Convert2( t, BaseGDL::COPY);
+	      converted.push_back( v);
+	    }
+	  if( v->StrictScalar())
+	    scal[ k] = (*static_cast<T*>( v))[ 0];
+	  else
+	    arr[ k] = &(*static_cast<T*>( v))[ 0];
+	}
+
+      T* res = new T( dim, BaseGDL::NOZERO);
+      const DLong64 minElts = transcendental ? CpuTPOOL_MIN_ELTS_TRANSC : CpuTPOOL_MIN_ELTS_ARITH;
+      bool parallel = (nEl >= minElts && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl));
+      Run<Ty>( prog, maxDepth, arr, scal, &(*res)[ 0], nEl, parallel);
+
+      for( SizeT c = 0; c < converted.size(); ++c) GDLDelete( converted[ c]);
+      return res;
+    }
+    catch( ...)
+      {
+	for( SizeT c = 0; c < converted.size(); ++c) GDLDelete( converted[ c]);
+	throw;
+      }
+  }
+
+} // namespace
+
+namespace {
+  int fusionEnabled = -1; // environment not read yet
+}
+
+bool FusedExpr::Enabled()
+{
+  if( fusionEnabled < 0)
+    fusionEnabled = GetEnvString( "GDL_EXPR_FUSION").length() > 0 ? 1 : 0;
+  return fusionEnabled != 0;
+}
+
+void FusedExpr::SetEnabled( bool enable)
+{
+  fusionEnabled = enable ? 1 : 0;
+}
+
+bool FusedExpr::Compile( ProgNodeP n, vector<FUSEDEXPRNode*>& inner)
+{
+  if( FUSEDEXPRNode* f = dynamic_cast<FUSEDEXPRNode*>( n))
+    {
+      inner.push_back( f);
+      return Compile( f->getFirstChild(), inner);
+    }
+
+  Instr in;
+  in.leaf = -1;
+
+  switch( n->getType())
+    {
+    case GDLTokenTypes::VAR:
+    case GDLTokenTypes::VARPTR:
+    case GDLTokenTypes::SYSVAR:
+    case GDLTokenTypes::CONSTANT:
+      in.op = LEAF;
+      in.leaf = leaves.size();
+      leaves.push_back( n);
+      prog.push_back( in);
+      return true;
+    }
+
+  if( dynamic_cast<PLUSNode*>( n) || dynamic_cast<PLUSNCNode*>( n) ||
+      dynamic_cast<PLUSNC12Node*>( n))
+    in.op = ADD;
+  else if( dynamic_cast<MINUSNode*>( n) || dynamic_cast<MINUSNCNode*>( n) ||
+	   dynamic_cast<MINUSNC12Node*>( n))
+    in.op = SUB;
+  else if( dynamic_cast<ASTERIXNode*>( n) || dynamic_cast<ASTERIXNCNode*>( n) ||
+	   dynamic_cast<ASTERIXNC12Node*>( n))
+    in.op = MUL;
+  else if( dynamic_cast<SLASHNode*>( n) || dynamic_cast<SLASHNCNode*>( n) ||
+	   dynamic_cast<SLASHNC12Node*>( n))
+    in.op = DIV;
+  else if( dynamic_cast<UMINUSNode*>( n))
+    {
+      if( !Compile( n->getFirstChild(), inner)) return false;
+      in.op = NEG;
+      prog.push_back( in);
+      return true;
+    }
+  else if( FCALL_LIB_DIRECTNode* fc = dynamic_cast<FCALL_LIB_DIRECTNode*>( n))
+    {
+      const SizeT nFuns = sizeof( fusedFuns) / sizeof( fusedFuns[ 0]);
+      SizeT f = 0;
+      while( f < nFuns && fusedFuns[ f].fun != fc->FunDirect()) ++f;
+      if( f == nFuns) return false;
+
+      // the single parameter (direct functions do not take keywords)
+      ProgNodeP par = fc->getFirstChild();
+      if( par == NULL || par->getNextSibling() != NULL) return false;
+      if( !Compile( par->getFirstChild(), inner)) return false;
+      in.op = fusedFuns[ f].op;
+      if( Transcendental( in.op)) transcendental = true;
+      prog.push_back( in);
+      return true;
+    }
+  else
+    return false;
+
+  ProgNodeP op1 = n->getFirstChild();
+  if( !Compile( op1, inner) || !Compile( op1->getNextSibling(), inner))
+    return false;
+  prog.push_back( in);
+  return true;
+}
+
+ProgNodeP FusedExpr::Wrap( ProgNodeP expr)
+{
+  FusedExpr* fused = new FusedExpr;
+  vector<FUSEDEXPRNode*> inner;
+  if( !fused->Compile( expr, inner) || fused->prog.size() - fused->leaves.size() < 2)
+    {
+      delete fused;
+      return expr;
+    }
+
+  int depth = 0;
+  for( SizeT i = 0; i < fused->prog.size(); ++i)
+    {
+      OpCode op = fused->prog[ i].op;
+      if( op == LEAF)
+	++depth;
+      else if( op == ADD || op == SUB || op == MUL || op == DIV)
+	--depth;
+      fused->maxDepth = std::max( fused->maxDepth, depth);
+    }
+
+  // the whole expression is now evaluated here
+  for( SizeT i = 0; i < inner.size(); ++i) inner[ i]->Deactivate();
+
+  return new FUSEDEXPRNode( expr, fused);
+}
+
+BaseGDL* FusedExpr::Eval()
+{
+  const SizeT nLeaves = leaves.size();
+  vector<BaseGDL*> val( nLeaves);
+  try {
+    for( SizeT k = 0; k < nLeaves; ++k)
+      {
+	val[ k] = leaves[ k]->EvalNC();
+	if( val[ k] == NULL) return NULL;
+      }
+  }
+  catch( GDLException&)
+    {
+      // the plain evaluation reports the error
+      return NULL;
+    }
+
+  // conformable arrays: the result takes the dimension of the first one
+  const dimension* dim = NULL;
+  SizeT nEl = 0;
+  for( SizeT k = 0; k < nLeaves; ++k)
+    {
+      DType t = val[ k]->Type();
+      if( !RealType( t)) return NULL;
+      if( val[ k]->StrictScalar()) continue;
+      if( dim == NULL)
+	{
+	  dim = &val[ k]->Dim();
+	  nEl = val[ k]->N_Elements();
+	}
+      else if( val[ k]->N_Elements() != nEl)
+	return NULL;
+    }
+  if( dim == NULL || nEl < fuseMinElts) return NULL;
+
+  // type propagation as in the operator nodes: every operation must
+  // yield the type of the whole expression, so that each leaf is
+  // converted exactly once (where the plain evaluation converts it)
+  vector<DType> types( maxDepth);
+  vector<DType> opTypes;
+  opTypes.reserve( prog.size());
+  int sp = 0;
+  for( SizeT i = 0; i < prog.size(); ++i)
+    {
+      const Instr& in = prog[ i];
+      if( in.op == LEAF)
+	{
+	  types[ sp++] = val[ in.leaf]->Type();
+	  continue;
+	}
+      if( in.op == ADD || in.op == SUB || in.op == MUL || in.op == DIV)
+	{
+	  --sp;
+	  DType a = types[ sp - 1];
+	  DType b = types[ sp];
+	  types[ sp - 1] = (DTypeOrder[ a] >= DTypeOrder[ b]) ? a : b;
+	}
+      // the functions and unary minus keep the type of their argument
+      if( !FloatType( types[ sp - 1])) return NULL;
+      opTypes.push_back( types[ sp - 1]);
+    }
+  const DType resTy = types[ 0];
+  for( SizeT i = 0; i < opTypes.size(); ++i)
+    if( opTypes[ i] != resTy) return NULL;
+
+  if( resTy == GDL_FLOAT)
+    return Evaluate<DFloatGDL>( prog, maxDepth, val, *dim, nEl, transcendental);
+  return Evaluate<DDoubleGDL>( prog, maxDepth, val, *dim, nEl, transcendental);
+}
@@ -0,0 +1,78 @@
+/***************************************************************************
+                          exprfusion.hpp  -  fused evaluation of elementwise expressions
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef EXPRFUSION_HPP_
+#define EXPRFUSION_HPP_
+
+#include <vector>
+
+#include "typedefs.hpp"
+
+class BaseGDL;
+class ProgNode;
+typedef ProgNode* ProgNodeP;
+class FUSEDEXPRNode;
+
+// An expression tree made only of +, -, *, /, unary minus and the
+// intrinsics SIN, COS, TAN, EXP, ALOG, ALOG10, SQRT and ABS, with
+// variables, system variables and constants as leaves, is compiled into
+// a small postfix program.
+// If at run time all operands are conformable FLOAT or DOUBLE arrays (or
+// scalars/integers which the usual type promotion converts to that type
+// at their first use), the program is run in one tiled (and, above the
+// !CPU thresholds, OpenMP parallel) loop writing into a single result,
+// instead of allocating a full size temporary per node.
+// Otherwise the original tree is evaluated as before.
+// The fused program is always compiled, but only used while fusion is
+// enabled: by CPU, EXPR_FUSION=1 (GDL extension) or, as the initial
+// setting, by the environment variable GDL_EXPR_FUSION.
+class FusedExpr
+{
+public:
+  enum OpCode { LEAF, NEG, ADD, SUB, MUL, DIV,
+		SIN, COS, TAN, EXP, ALOG, ALOG10, SQRT, ABS };
+
+  struct Instr
+  {
+    OpCode op;
+    int    leaf; // for LEAF: index into leaves
+  };
+
+private:
+  std::vector<Instr>     prog;
+  std::vector<ProgNodeP> leaves;
+  int                    maxDepth;
+  bool                   transcendental; // for the OpenMP threshold
+
+  FusedExpr(): maxDepth( 0), transcendental( false) {}
+
+  // appends 'n' to the program, fails for nodes which cannot be fused
+  bool Compile( ProgNodeP n, std::vector<FUSEDEXPRNode*>& inner);
+
+public:
+  static bool Enabled();
+  static void SetEnabled( bool enable);
+
+  // returns 'expr' or (if 'expr' has at least two fusable operations) a
+  // FUSEDEXPRNode replacing it
+  static ProgNodeP Wrap( ProgNodeP expr);
+
+  // NULL if the operands do not qualify (the caller then evaluates the
+  // original tree)
+  BaseGDL* Eval();
+};
+
+#endif
@@ -2051,6 +2051,56 @@ static void PathSearch( FileListT& fileList,  const DString& pathSpec,
     return res;
   }
 
+// FILE_LINES: LF, CR and CRLF end a line; a last line without end of line also counts
+// (and an empty file has one line).
+static const SizeT fileLinesBufSize = 4 * 1024 * 1024;
+
+// counts the line ends in buf[0..n-1], 'last' is the last character seen before
+static void CountLineEnds( const char* buf, SizeT n, SizeT& lines, char& last)
+{
+  if( n == 0) return;
+  // branch free, the compiler vectorizes these loops
+  SizeT nl = 0, cr = 0;
+  for( SizeT i = 0; i < n; ++i) {
+    nl += (buf[i] == '\n');
+    cr += (buf[i] == '\r');
+  }
+  SizeT crlf = 0;
+  if( cr > 0 || last == '\r') {
+    if( last == '\r' && buf[0] == '\n') ++crlf;
+    for( SizeT i = 1; i < n; ++i) crlf += (buf[i-1] == '\r') & (buf[i] == '\n');
+  }
+  lines += nl + cr - crlf;
+  last = buf[n-1];
+}
+
+// -1 if the file cannot be opened
+static DLong64 FileLines( const std::string& fname, bool compressed, char* buf)
+{
+  SizeT lines = 0;
+  char last = 0;
+  if( compressed) {
+    gzFile gfd = gzopen( fname.c_str(), "r");
+    if( gfd == NULL) return -1;
+#if ZLIB_VERNUM >= 0x1240
+    gzbuffer( gfd, 256 * 1024);
+#endif
+    int count;
+    while( (count = gzread( gfd, buf, fileLinesBufSize)) > 0)
+      CountLineEnds( buf, count, lines, last);
+    gzclose( gfd);
+  } else {
+    FILE* fd = fopen( fname.c_str(), "rb");
+    if( fd == NULL) return -1;
+    SizeT count;
+    while( (count = fread( buf, 1, fileLinesBufSize, fd)) > 0)
+      CountLineEnds( buf, count, lines, last);
+    fclose( fd);
+  }
+  if( last != '\n' && last != '\r') lines++;
+  return lines;
+}
+
   BaseGDL* file_lines( EnvT* e) {
     SizeT nParam = e->NParam(1); //, "FILE_LINES");
     DStringGDL* p0S = e->GetParAs<DStringGDL>(0); //, "FILE_LINES");
@@ -2064,72 +2114,32 @@ static void PathSearch( FileListT& fileList,  const DString& pathSpec,
     static int noExpIx = e->KeywordIx("NOEXPAND_PATH");
     bool noExp = e->KeywordSet(noExpIx);
     
-    DLongGDL* res = new DLongGDL( p0S->Dim(), BaseGDL::NOZERO);
-
-
-
-    if (compressed) {
-      char newinput, lastchar = 0;
-      SizeT lines;
-              gzFile gfd = NULL;
-        for (SizeT i = 0; i < nEl; ++i) {
-        std::string fname = (*p0S)[i];
-
-        if (!noExp) WordExp(fname);
-
-        if ((gfd = gzopen(fname.c_str(), "r")) == NULL) {
-          e->Throw("Could not open file for reading "); // + p0[i]);
-        }
-        lines = 0;
-        while (gzread(gfd, &newinput, 1) == 1) {
-          if (newinput == '\n') {
-            lines++;
-            if (lastchar == '\r') lines--;
-          } else if (newinput == '\r') lines++;
-          lastchar = newinput;
-        }
-        gzclose(gfd);
-        if (lastchar != '\n' && lastchar != '\r') lines++;
-
-        (*res)[ i] = lines;
-      }
-    } else { //
-      char* newinput=(char*) malloc(BUFSIZ);
-      char lastchar = 0;
-      SizeT lines;
-              FILE* fd = NULL;
-        for (SizeT i = 0; i < nEl; ++i) {
-        std::string fname = (*p0S)[i];
-
-        if (!noExp) WordExp(fname);
-
-        if ((fd = fopen(fname.c_str(), "r")) == NULL) {
-          e->Throw("Could not open file for reading "); // + p0[i]);
-        }
-        lines = 0;
-        int count=0;
-        count=fread(newinput, 1, BUFSIZ, fd);
-        while (count != 0) {
-          for (int i = 0; i < count; ++i) {
-            if (newinput[i] == '\n') {
-              lines++;
-              if (lastchar == '\r') lines--;
-            } else if (newinput[i] == '\r') lines++;
-
-            lastchar = newinput[i];
-          }
-          count = fread(newinput, 1, BUFSIZ, fd);
-        }
-
-        fclose(fd);
-        if (lastchar != '\n' && lastchar != '\r') lines++;
+    std::vector<std::string> fnames( nEl);
+    for (SizeT i = 0; i < nEl; ++i) {
+      fnames[i] = (*p0S)[i];
+      if (!noExp) WordExp(fnames[i]);
+    }
 
-        (*res)[ i] = lines;
-      }
-      free(newinput);
+    // several files are counted concurrently
+    std::vector<DLong64> lines( nEl);
+    int nThreads = (nEl > 1 && CpuTPOOL_NTHREADS > 1) ? std::min<SizeT>( nEl, CpuTPOOL_NTHREADS) : 1;
+#pragma omp parallel num_threads( nThreads)
+    {
+      char* buf = (char*) malloc( fileLinesBufSize);
+#pragma omp for schedule( dynamic)
+      for (OMPInt i = 0; i < nEl; ++i)
+        lines[i] = (buf == NULL) ? -2 : FileLines( fnames[i], compressed, buf);
+      free( buf);
     }
 
-    return res;
+    DLongGDL* res = new DLongGDL( p0S->Dim(), BaseGDL::NOZERO);
+    Guard<DLongGDL> resGuard( res);
+    for (SizeT i = 0; i < nEl; ++i) {
+      if (lines[i] == -2) e->Throw("Unable to allocate memory");
+      if (lines[i] < 0) e->Throw("Could not open file for reading "); // + p0[i]);
+      (*res)[ i] = lines[i];
+    }
+    return resGuard.release();
   }
 
 
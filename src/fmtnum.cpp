@@ -0,0 +1,302 @@
+/***************************************************************************
+                          fmtnum.cpp  -  number to text conversion and back
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <cstdio>
+#include <cmath>
+
+#include "fmtnum.hpp"
+
+namespace {
+
+  // exactly representable as double
+  const double pow10tab[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  const unsigned long long ipow10tab[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL
+  };
+
+  const char digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+  // val*10^prec is scaled with a single rounding: below this its error is
+  // < 1.2e-4, so rounding it to an integer gives the digits printf gives
+  // (from the exact binary value) unless it is near a tie
+  const double maxScaled = 1e12;
+  const double tieMargin = 1e-3;
+
+  // at least minDigits decimal digits of val
+  inline void AppendDecimal( std::string& out, unsigned long long val, int minDigits)
+  {
+    char buf[ 24];
+    char* p = buf + sizeof( buf);
+    while( val >= 100)
+      {
+	const char* dp = digitPairs + 2 * (val % 100);
+	val /= 100;
+	*--p = dp[ 1];
+	*--p = dp[ 0];
+      }
+    if( val >= 10)
+      {
+	const char* dp = digitPairs + 2 * val;
+	*--p = dp[ 1];
+	*--p = dp[ 0];
+      }
+    else
+      *--p = static_cast<char>( '0' + val);
+    int n = static_cast<int>( buf + sizeof( buf) - p);
+    if( n < minDigits) out.append( minDigits - n, '0');
+    out.append( p, n);
+  }
+
+  // round x (>= 0) to an integer if that can be done safely
+  inline bool RoundScaled( double x, unsigned long long& n)
+  {
+    if( !(x < maxScaled)) return false;
+    double fl = std::floor( x);
+    double fr = x - fl;
+    if( std::fabs( fr - 0.5) <= tieMargin) return false;
+    n = static_cast<unsigned long long>( fl) + (fr > 0.5 ? 1 : 0);
+    return true;
+  }
+
+  void AppendPrintf( std::string& out, const char* fmt, int prec, double val)
+  {
+    char buf[ 64];
+    int n = std::snprintf( buf, sizeof( buf), fmt, prec, val);
+    if( n < 0) return;
+    if( n < static_cast<int>( sizeof( buf)))
+      {
+	out.append( buf, n);
+	return;
+      }
+    // e.g. F400.300 or 1e300 in F format
+    std::string::size_type start = out.size();
+    out.resize( start + n + 1);
+    std::snprintf( &out[ start], n + 1, fmt, prec, val);
+    out.resize( start + n);
+  }
+}
+
+void FmtFixed( std::string& out, double val, int prec, bool showPos)
+{
+  if( prec < 0) prec = 6; // as the iostreams do
+  unsigned long long n;
+  if( prec <= 11 && RoundScaled( std::fabs( val) * pow10tab[ prec], n))
+    {
+      if( std::signbit( val)) out += '-';
+      else if( showPos) out += '+';
+      unsigned long long p10 = ipow10tab[ prec];
+      AppendDecimal( out, n / p10, 1);
+      if( prec > 0)
+	{
+	  out += '.';
+	  AppendDecimal( out, n % p10, prec);
+	}
+      return;
+    }
+  AppendPrintf( out, showPos ? "%+.*f" : "%.*f", prec, val);
+}
+
+void FmtScientific( std::string& out, double val, int prec, bool showPos, bool upper)
+{
+  if( prec < 0) prec = 6;
+  double a = std::fabs( val);
+  if( prec <= 10 && std::isfinite( a))
+    {
+      int e = 0;
+      unsigned long long n = 0;
+      bool ok = (a == 0.0);
+      if( !ok)
+	{
+	  e = static_cast<int>( std::floor( std::log10( a)));
+	  // log10 might be off by one near powers of ten
+	  for( int tries = 0; tries < 2; ++tries)
+	    {
+	      int k = prec - e;
+	      if( k > 22 || k < -22) break;
+	      double x = (k >= 0) ? a * pow10tab[ k] : a / pow10tab[ -k];
+	      if( x < pow10tab[ prec]) { --e; continue;}
+	      if( x >= pow10tab[ prec + 1]) { ++e; continue;}
+	      ok = RoundScaled( x, n);
+	      break;
+	    }
+	  if( ok && n == ipow10tab[ prec + 1])
+	    {
+	      n = ipow10tab[ prec];
+	      ++e;
+	    }
+	}
+      if( ok)
+	{
+	  if( std::signbit( val)) out += '-';
+	  else if( showPos) out += '+';
+	  unsigned long long p10 = ipow10tab[ prec];
+	  out += static_cast<char>( '0' + n / p10);
+	  if( prec > 0)
+	    {
+	      out += '.';
+	      AppendDecimal( out, n % p10, prec);
+	    }
+	  out += upper ? 'E' : 'e';
+	  out += (e < 0) ? '-' : '+';
+	  AppendDecimal( out, (e < 0) ? -e : e, 2);
+	  return;
+	}
+    }
+  const char* fmt = upper ? (showPos ? "%+.*E" : "%.*E") : (showPos ? "%+.*e" : "%.*e");
+  AppendPrintf( out, fmt, prec, val);
+}
+
+void FmtGeneral( std::string& out, double val, int prec, bool showPos, bool upper)
+{
+  if( prec < 0) prec = 6;
+  const char* fmt = upper ? (showPos ? "%+.*G" : "%.*G") : (showPos ? "%+.*g" : "%.*g");
+  AppendPrintf( out, fmt, prec, val);
+}
+
+void FmtDigits( std::string& out, unsigned long long val, int base, bool upper)
+{
+  if( base == 10)
+    {
+      AppendDecimal( out, val, 1);
+      return;
+    }
+  const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+  const int shift = (base == 8) ? 3 : 4;
+  const unsigned long long mask = base - 1;
+  char buf[ 24];
+  char* p = buf + sizeof( buf);
+  do {
+    *--p = digits[ val & mask];
+    val >>= shift;
+  } while( val != 0);
+  out.append( p, buf + sizeof( buf) - p);
+}
+
+void FmtFit( std::string& out, std::string::size_type start, int w, bool left, bool zeroFill)
+{
+  std::string::size_type len = out.size() - start;
+  if( w < 0 || len > static_cast<std::string::size_type>( w))
+    {
+      out.resize( start);
+      if( w > 0) out.append( w, '*');
+      return;
+    }
+  std::string::size_type fill = w - len;
+  if( fill == 0) return;
+  if( left)
+    out.append( fill, ' ');
+  else if( zeroFill && len > 0 && (out[ start] == '-' || out[ start] == '+'))
+    out.insert( start + 1, fill, '0'); // no "00-1.00"
+  else
+    out.insert( start, fill, zeroFill ? '0' : ' ');
+}
+
+bool ScanDouble( const char* s, double& val, const char** end, bool dExponent)
+{
+  const char* p = s;
+  bool neg = false;
+  if( *p == '-' || *p == '+') neg = (*p++ == '-');
+
+  // hex floats, inf, nan, leading whitespace: strtod
+  if( *p == '0' && (p[ 1] == 'x' || p[ 1] == 'X')) return false;
+
+  unsigned long long m = 0;
+  int nDigits = 0; // significant ones
+  int exp10 = 0;
+  bool any = false;
+  for( ; *p >= '0' && *p <= '9'; ++p)
+    {
+      any = true;
+      if( m == 0 && *p == '0') continue;
+      if( ++nDigits > 15) return false;
+      m = m * 10 + (*p - '0');
+    }
+  if( *p == '.')
+    {
+      for( ++p; *p >= '0' && *p <= '9'; ++p)
+	{
+	  any = true;
+	  --exp10;
+	  if( m == 0 && *p == '0') continue;
+	  if( ++nDigits > 15) return false;
+	  m = m * 10 + (*p - '0');
+	}
+    }
+  if( !any) return false;
+
+  if( *p == 'e' || *p == 'E' || (dExponent && (*p == 'd' || *p == 'D')))
+    {
+      const char* q = p + 1;
+      bool eNeg = false;
+      if( *q == '-' || *q == '+') eNeg = (*q++ == '-');
+      if( *q >= '0' && *q <= '9')
+	{
+	  int e = 0;
+	  for( ; *q >= '0' && *q <= '9'; ++q)
+	    {
+	      if( e > 10000) return false;
+	      e = e * 10 + (*q - '0');
+	    }
+	  exp10 += eNeg ? -e : e;
+	  p = q;
+	}
+      // else: "1.5e" is 1.5 followed by 'e'
+    }
+
+  double v = static_cast<double>( m); // exact (< 10^15)
+  if( m != 0)
+    {
+      if( exp10 > 22 || exp10 < -22) return false;
+      // one correctly rounded operation: the value strtod returns
+      v = (exp10 >= 0) ? v * pow10tab[ exp10] : v / pow10tab[ -exp10];
+    }
+  val = neg ? -v : v;
+  *end = p;
+  return true;
+}
+
+bool ScanLong( const char* s, long& val, const char** end)
+{
+  const char* p = s;
+  bool neg = false;
+  if( *p == '-' || *p == '+') neg = (*p++ == '-');
+  const char* digits = p;
+  unsigned long long v = 0;
+  for( ; *p >= '0' && *p <= '9'; ++p)
+    {
+      if( p - digits >= 18) return false; // might overflow
+      v = v * 10 + (*p - '0');
+    }
+  if( p == digits) return false; // strtol decides (whitespace, error)
+  val = neg ? -static_cast<long>( v) : static_cast<long>( v);
+  *end = p;
+  return true;
+}
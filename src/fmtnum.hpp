@@ -0,0 +1,58 @@
+/***************************************************************************
+                          fmtnum.hpp  -  number to text conversion and back
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FMTNUM_HPP_
+#define FMTNUM_HPP_
+
+#include <string>
+
+// The conversions used by formatted and default output. Each one appends
+// to 'out' exactly the characters printf (and hence an ostream with the
+// corresponding manipulators) produces, but without the ostringstream,
+// locale and temporary strings per number.
+// Fixed and scientific notation are done with integer arithmetic whenever
+// the rounding of val*10^n cannot change the printed digits (which is
+// the case for nearly all values), with snprintf otherwise.
+
+// printf( "%.*f", prec, val), "%+.*f" if showPos
+void FmtFixed( std::string& out, double val, int prec, bool showPos);
+
+// printf( "%.*e", prec, val), "%.*E" if upper
+void FmtScientific( std::string& out, double val, int prec, bool showPos, bool upper);
+
+// printf( "%.*g", prec, val), "%.*G" if upper
+void FmtGeneral( std::string& out, double val, int prec, bool showPos, bool upper);
+
+// the digits of val in base 8, 10 or 16 (upper: 'A'-'F')
+void FmtDigits( std::string& out, unsigned long long val, int base, bool upper);
+
+// out[ start, end) right justified in a field of w characters (filled
+// with '0' after the sign if zeroFill), or left justified, or w '*' if
+// it is longer than w
+void FmtFit( std::string& out, std::string::size_type start, int w, bool left, bool zeroFill);
+
+// The other direction, for the input of many numbers: the common cases
+// (up to 15 significant digits and exponents up to 22, which are exact
+// in double arithmetic) without strtod. Both return false if they cannot
+// decide: the caller has to use strtod/strtol then.
+
+// as strtod( s, end) (with 'd', 'D' exponents as well if dExponent)
+bool ScanDouble( const char* s, double& val, const char** end, bool dExponent);
+
+// as strtol( s, end, 10)
+bool ScanLong( const char* s, long& val, const char** end);
+
+#endif
@@ -0,0 +1,326 @@
+/***************************************************************************
+                          fmtprogram.cpp  -  formatted output without tree walking
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "includefirst.hpp"
+
+#include <sstream>
+#include <memory>
+#include <cassert>
+
+#include "envt.hpp"
+#include "gdljournal.hpp"
+#include "fmtprogram.hpp"
+
+bool FMTProgram::Add( RefFMTNode fmt)
+{
+  SizeT g = ops.size();
+  Op group = { FORMAT, fmt->getRep(), -1, -1, 0, 0, std::string() };
+  ops.push_back( group);
+
+  for( RefFMTNode t = static_cast<RefFMTNode>( fmt->getFirstChild());
+       t != static_cast<RefFMTNode>( antlr::nullAST);
+       t = static_cast<RefFMTNode>( t->getNextSibling()))
+    {
+      int type = t->getType();
+      switch( type) {
+      case FORMAT:
+	if( !Add( t)) return false;
+	break;
+      case SLASH:
+      case TERM: case NONL: case Q: case T:
+      case STRING: case TL: case TR: case X:
+      case A: case F: case E: case SE: case G: case SG:
+      case I: case O: case B: case Z: case ZZ:
+	{
+	  Op op = { type, t->getRep(), t->getW(), t->getD(), t->getCode(), 0, std::string() };
+	  if( type == E || type == G) op.code |= FMTNode::fmtUPPER; // FMTOut: setUpper()
+	  if( type == STRING) op.text = t->getText();
+	  ops.push_back( op);
+	  break;
+	}
+      default: // C() calendar formats
+	return false;
+      }
+    }
+
+  Op end = { END, 0, 0, 0, 0, 0, std::string() };
+  ops.push_back( end);
+  ops[ g].next = ops.size();
+  return true;
+}
+
+FMTProgram* FMTProgram::Compile( RefFMTNode fmt)
+{
+  if( fmt == static_cast<RefFMTNode>( antlr::nullAST) || fmt->getType() != FORMAT)
+    return NULL;
+
+  FMTProgram* program = new FMTProgram();
+  if( !program->Add( fmt))
+    {
+      delete program;
+      return NULL;
+    }
+  // the (no) siblings of the outermost format
+  Op end = { END, 0, 0, 0, 0, 0, std::string() };
+  program->ops.push_back( end);
+  return program;
+}
+
+// the state of FMTOut, the rules of format.out.g (q: Slash, f: Item) as functions over the
+// index of an element in FMTProgram::ops (each returns the index after
+// the element, as _retTree)
+class FMTProgramOut: public FMTTokenTypes
+{
+  const std::vector<FMTProgram::Op>& ops;
+
+  std::ostream* os;
+  EnvT*    e;
+  SizeT   nextParIx;
+  SizeT   valIx;
+
+  bool termFlag;
+  bool nonlFlag;
+
+  SizeT   nParam;
+  BaseGDL* actPar;
+  SizeT nElements;
+
+  SizeT reversionAnker;
+
+  void NextPar()
+  {
+    valIx = 0;
+    if( nextParIx < nParam)
+      {
+	actPar = e->GetPar( nextParIx);
+	if( actPar != NULL)
+	  nElements = actPar->ToTransfer();
+	else
+	  nElements = 0;
+      }
+    else
+      {
+	actPar = NULL;
+	nElements = 0;
+      }
+    nextParIx++;
+  }
+
+  void NextVal( SizeT n=1)
+  {
+    valIx += n;
+    if( valIx >= nElements)
+      NextPar();
+  }
+
+  SizeT Slash( SizeT t)
+  {
+    if( ops[ t].type != SLASH) return t;
+
+    // only one newline to journal file
+    GDLStream* j = lib::get_journal();
+    if( j != NULL && j->OStream().rdbuf() == os->rdbuf())
+      (*os) << '\n' << lib::JOURNALCOMMENT;
+    else
+      for( int r=ops[ t].rep; r > 0; r--) (*os) << '\n';
+    return t + 1;
+  }
+
+  SizeT Format( SizeT g)
+  {
+    reversionAnker = g;
+
+    SizeT blk = g + 1;
+    for( int r = ops[ g].rep; r > 0; r--)
+      {
+	SizeT t = Slash( blk);
+	for (;;)
+	  {
+	    int type = ops[ t].type;
+	    if( type == FMTProgram::END) break;
+	    if( type != STRING && actPar == NULL && termFlag) break;
+	    t = Slash( Item( t));
+	  }
+	// end of one repetition
+	if( actPar == NULL && termFlag) break;
+      }
+    return ops[ g].next;
+  }
+
+  void FormatReversion( SizeT g)
+  {
+    SizeT t = Slash( Format( g));
+    while( ops[ t].type != FMTProgram::END)
+      {
+	t = Item( t);
+	if( actPar == NULL) break;
+	t = Slash( t);
+      }
+  }
+
+  SizeT Item( SizeT t)
+  {
+    const FMTProgram::Op& op = ops[ t];
+    switch( op.type) {
+    case FORMAT:
+      return Format( t);
+    case TERM:
+      termFlag = true;
+      break;
+    case NONL:
+      nonlFlag = true;
+      break;
+    case Q: // ignored on output
+      break;
+    case T:
+      assert( op.w >= 1);
+      os->seekp( op.w-1, std::ios_base::beg);
+      break;
+    case STRING:
+      (*os) << op.text;
+      break;
+    case TL:
+      {
+	SizeT actP  = os->tellp();
+	int    tlVal = op.w;
+	if( tlVal > actP)
+	  os->seekp( 0);
+	else
+	  os->seekp( actP - tlVal);
+	break;
+      }
+    case TR:
+      for( int i=op.w; i>0; --i)
+	(*os) << " ";
+      break;
+    case X:
+      for( int r=op.w; r > 0; r--) (*os) << ' ';
+      break;
+    case A:
+      {
+	if( actPar == NULL) break;
+	int r = op.rep;
+	do {
+	  SizeT tCount = actPar->OFmtA( os, valIx, r, op.w, op.code);
+	  r -= tCount;
+	  NextVal( tCount);
+	  if( actPar == NULL) break;
+	} while( r>0);
+	break;
+      }
+    case F: case SE: case E: case SG: case G:
+      {
+	if( actPar == NULL) break;
+	BaseGDL::IOMode oM = (op.type == F) ? BaseGDL::FIXED :
+	  ((op.type == SE || op.type == E) ? BaseGDL::SCIENTIFIC : BaseGDL::AUTO);
+	int r = op.rep;
+	do {
+	  SizeT tCount = actPar->OFmtF( os, valIx, r, op.w, op.d, op.code, oM);
+	  r -= tCount;
+	  NextVal( tCount);
+	  if( actPar == NULL) break;
+	} while( r>0);
+	break;
+      }
+    case I: case O: case B: case Z: case ZZ:
+      {
+	if( actPar == NULL) break;
+	BaseGDL::IOMode oM = (op.type == I) ? BaseGDL::DEC :
+	  (op.type == O) ? BaseGDL::OCT :
+	  (op.type == B) ? BaseGDL::BIN :
+	  (op.type == Z) ? BaseGDL::HEX : BaseGDL::HEXL;
+	int r = op.rep;
+	do {
+	  SizeT tCount = actPar->OFmtI( os, valIx, r, op.w, op.d, op.code, oM);
+	  r -= tCount;
+	  NextVal( tCount);
+	  if( actPar == NULL) break;
+	} while( r>0);
+	break;
+      }
+    }
+    return t + 1;
+  }
+
+public:
+  FMTProgramOut( const FMTProgram& program, std::ostream* os_, EnvT* e_, int parOffset)
+    : ops( program.ops), os(os_), e( e_), nextParIx( parOffset),
+      valIx(0), termFlag(false), nonlFlag(false), nElements(0), reversionAnker(0)
+  {
+    std::ostringstream* osLocal;
+    std::unique_ptr<std::ostream> osLocalGuard;
+    if( os_->rdbuf() == std::cout.rdbuf())
+      {
+	// e.g. print, 1, f='(A)'
+	osLocal = new std::ostringstream();
+	osLocalGuard.reset( osLocal);
+	os = osLocal;
+      }
+    else
+      {
+	// e.g. print, string(1, f='(A)')
+	os = os_;
+      }
+
+    nParam = e->NParam();
+
+    NextPar();
+
+    GDLStream* j = lib::get_journal();
+
+    if( j != NULL && j->OStream().rdbuf() == os->rdbuf())
+      (*os) << lib::JOURNALCOMMENT;
+
+    Format( 0);
+
+    SizeT nextParIxComp = nextParIx;
+    SizeT valIxComp = valIx;
+
+    // format reversion
+    while( actPar != NULL)
+      {
+	(*os) << '\n';
+
+	if( j != NULL && j->OStream().rdbuf() == os->rdbuf())
+	  (*os) << lib::JOURNALCOMMENT;
+
+	FormatReversion( reversionAnker);
+
+	if( (nextParIx == nextParIxComp) && (valIx == valIxComp))
+	  throw GDLException("Infinite format loop detected.");
+      }
+
+    os->seekp( 0, std::ios_base::end);
+
+    if( !nonlFlag)
+      {
+	(*os) << '\n';
+      }
+    (*os) << std::flush;
+
+    if( os_->rdbuf() == std::cout.rdbuf())
+      {
+	os = os_;
+	(*os) << osLocal->str();
+	(*os) << std::flush;
+      }
+  }
+};
+
+void FMTProgram::Out( std::ostream* os, EnvT* e, int parOffset) const
+{
+  FMTProgramOut out( *this, os, e, parOffset);
+}
@@ -0,0 +1,66 @@
+/***************************************************************************
+                          fmtprogram.hpp  -  formatted output without tree walking
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FMTPROGRAM_HPP_
+#define FMTPROGRAM_HPP_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "fmtnode.hpp"
+
+class EnvT;
+class BaseGDL;
+
+// A FORMAT AST (of GetFMTAST) flattened into an array: each group is its
+// FORMAT entry followed by its elements and an END entry. Executing it
+// does exactly what FMTOut does with the tree (same reversion, same
+// termination), but without the ANTLR tree walking for every item.
+class FMTProgram: public FMTTokenTypes
+{
+public:
+  // NULL if 'fmt' contains something only FMTOut handles (C() calendar
+  // formats)
+  static FMTProgram* Compile( RefFMTNode fmt);
+
+  // as FMTOut( fmt, os, e, parOffset)
+  void Out( std::ostream* os, EnvT* e, int parOffset) const;
+
+private:
+  enum { END = -1 };
+
+  struct Op
+  {
+    int type;
+    int rep;
+    int w;
+    int d;
+    int code;
+    SizeT next;       // FORMAT: after its END
+    std::string text; // STRING
+  };
+
+  std::vector<Op> ops;
+
+  FMTProgram() {}
+
+  bool Add( RefFMTNode fmt);
+
+  friend class FMTProgramOut;
+};
+
+#endif
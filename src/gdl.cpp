@@ -114,6 +114,16 @@ void InitOpenMP() {
     omp_set_num_threads(CpuTPOOL_NTHREADS);
   }
   //  cout << CpuTPOOL_NTHREADS <<endl;
+
+  // tune the per operation class thresholds to this machine
+  if (GetEnvString("GDL_TPOOL_CALIBRATE").length() > 0) {
+    CalibrateTPoolThresholds();
+    DStructGDL* cpu = SysVar::Cpu();
+    static unsigned ARITHTag = cpu->Desc()->TagIndex( "TPOOL_MIN_ELTS_ARITH");
+    static unsigned TRANSCTag = cpu->Desc()->TagIndex( "TPOOL_MIN_ELTS_TRANSC");
+    (*static_cast<DLong64GDL*>( cpu->GetTag( ARITHTag, 0)))[0] = CpuTPOOL_MIN_ELTS_ARITH;
+    (*static_cast<DLong64GDL*>( cpu->GetTag( TRANSCTag, 0)))[0] = CpuTPOOL_MIN_ELTS_TRANSC;
+  }
 #endif
 }
 
@@ -268,6 +278,15 @@ int main(int argc, char *argv[])
       cerr << "                     Using this option may render some historical widgets unworkable (as they are based on fixed sizes)." << endl;
       cerr << "  --no-dSFMT         Tells GDL not to use double precision SIMD oriented Fast Mersenne Twister(dSFMT) for random doubles." << endl;
       cerr << "                     Also disable by setting the environment variable GDL_NO_DSFMT to a non-null value." << endl;
+      cerr << "  Set the environment variable GDL_COMPILE_CACHE to a writable directory to keep the parsed .pro files" << endl;
+      cerr << "  there and skip reparsing unchanged files in later sessions." << endl;
+      cerr << "  Set the environment variable GDL_EXPR_FUSION to a non-null value to evaluate large FLOAT/DOUBLE expressions" << endl;
+      cerr << "  of +, -, *, / and SIN, COS, TAN, EXP, ALOG, ALOG10, SQRT, ABS in a single pass without temporaries" << endl;
+      cerr << "  (see also CPU, EXPR_FUSION=)." << endl;
+      cerr << "  Set the environment variable GDL_BUFFER_POOL to the number of MB of freed large array buffers kept" << endl;
+      cerr << "  for reuse until the next prompt (default 0: disabled; see also CPU, BUFFER_POOL=, MEMORY(/POOL_HITS))." << endl;
+      cerr << "  Set the environment variable GDL_TPOOL_CALIBRATE to a non-null value to time threaded against serial" << endl;
+      cerr << "  operations at startup and set !CPU.TPOOL_MIN_ELTS_ARITH/_TRANSC accordingly (see also CPU, /CALIBRATE)." << endl;
 #ifdef _WIN32
       cerr << "  --posix (Windows only): paths will be posix paths (experimental)." << endl;
 #endif
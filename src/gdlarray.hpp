@@ -24,6 +24,8 @@
 //#define GDLARRAY_DEBUG
 #undef GDLARRAY_DEBUG
 
+#include "gdlbufferpool.hpp"
+
 // for complex (of POD)
 const bool TreatPODComplexAsPOD = true;
 
@@ -55,7 +57,7 @@ private:
     else
     {
       Ty* b = reinterpret_cast<Ty*>(scalarBuf);
-#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))      
+#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))      
       for( int i = 0; i<sz; ++i) new (&(b[ i])) Ty();
       return b;
     }
@@ -81,7 +83,7 @@ private:
 // Normally, Everything should be allocated using gdlAlignedMalloc with the 'good' alignment, not only in the USE_EIGEN case.
 // Unfortunately gdlAlignedMalloc uses Eigen::internal::alogned_malloc at the moment. Todo Next.
 #ifdef USE_EIGEN
-   if (IsPOD) return (Ty*) gdlAlignedMalloc(s*sizeof(Ty)); else return Eigen::internal::aligned_new<Ty>( s);
+   if (IsPOD) return (Ty*) BufferPool::Alloc(s*sizeof(Ty)); else return Eigen::internal::aligned_new<Ty>( s);
 #else
     return new Ty[ s];
 #endif
@@ -97,7 +99,7 @@ public:
   if( IsPOD)
     {
 #ifdef USE_EIGEN  
-    if ( buf != reinterpret_cast<Ty*>(scalarBuf)) gdlAlignedFree(buf);
+    if ( buf != reinterpret_cast<Ty*>(scalarBuf)) BufferPool::Free(buf, sz*sizeof(Ty)); // large buffers are kept for reuse
 //	Eigen::internal::aligned_delete( buf, sz);
 #else
     if( buf != reinterpret_cast<Ty*>(scalarBuf)) 
@@ -124,7 +126,7 @@ public:
       try {
 	buf = (cp.size() > smallArraySize) ? New(cp.size()) /*new Ty[ cp.size()]*/ : InitScalar();
       } catch (std::bad_alloc&) { ThrowGDLException("Array requires more memory than available"); }
-#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
       for( SizeT i=0; i<sz; ++i)	buf[ i] = cp.buf[ i];
   }
 
@@ -140,7 +142,7 @@ public:
     try {
 	    buf = (s > smallArraySize) ? New(s) /*T[ s]*/ : InitScalar();
     } catch (std::bad_alloc&) { ThrowGDLException("Array requires more memory than available"); }
-#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     for( SizeT i=0; i<sz; ++i) buf[ i] = val;
   }
   
@@ -149,7 +151,7 @@ public:
       try {
 	buf = (s > smallArraySize) ? New(s) /*new Ty[ s]*/: InitScalar();
       } catch (std::bad_alloc&) { ThrowGDLException("Array requires more memory than available"); }
-#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz)) 
+#pragma omp parallel for if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz)) 
       for( SizeT i=0; i<sz; ++i)	buf[ i] = arr[ i];
   }
 
@@ -203,7 +205,7 @@ void InitFrom( const GDLArray& right )
   }
   else
   {
-#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     for ( SizeT i=0; i<sz; ++i )
 	buf[ i] = right.buf[ i];
   }    
@@ -219,7 +221,7 @@ GDLArray& operator= ( const GDLArray& right )
   }
   else
   {
-#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     for ( SizeT i=0; i<sz; ++i )
       buf[ i] = right.buf[ i];
   }
@@ -228,14 +230,14 @@ GDLArray& operator= ( const GDLArray& right )
 
   GDLArray& operator+=( const GDLArray& right) throw()
   {
-#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     for( SizeT i=0; i<sz; ++i)
       buf[ i] += right.buf[ i];
     return *this;
   }
   GDLArray& operator-=( const GDLArray& right) throw()
   {
-#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     for( SizeT i=0; i<sz; ++i)
       buf[ i] -= right.buf[ i];
     return *this;
@@ -243,14 +245,14 @@ GDLArray& operator= ( const GDLArray& right )
 
   GDLArray& operator+=( const T& right) throw()
   {
-#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     for( SizeT i=0; i<sz; ++i)
       buf[ i] += right;
     return *this;
   }
   GDLArray& operator-=( const T& right) throw()
   {
-#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
+#pragma omp parallel for   if (sz >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= sz))
     for( SizeT i=0; i<sz; ++i)
       buf[ i] -= right;
     return *this;
@@ -0,0 +1,129 @@
+/***************************************************************************
+                          gdlbufferpool.cpp  -  reuse of large array buffers
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "includefirst.hpp"
+
+#include <map>
+#include <cstdlib>
+
+#include "gdlbufferpool.hpp"
+#include "str.hpp"
+
+namespace {
+
+  typedef std::multimap<std::size_t, void*> PoolMap;
+  typedef std::map<void*, std::pair<void (*)( void*), void*> > AdoptedMap;
+
+  PoolMap     pool;        // size in bytes -> free buffer
+  AdoptedMap  adopted;     // foreign buffer -> release function, its argument
+  std::size_t cached = 0;  // bytes in pool
+  std::size_t hits   = 0;
+  std::size_t misses = 0;
+
+  std::size_t maxCached = 0;
+  bool maxCachedSet = false;
+
+  std::size_t MaxCached()
+  {
+    if( !maxCachedSet)
+      {
+	std::string env = GetEnvString( "GDL_BUFFER_POOL");
+	long mb = env.length() > 0 ? std::strtol( env.c_str(), NULL, 10) : 0;
+	maxCached = (mb > 0) ? static_cast<std::size_t>( mb) << 20 : 0;
+	maxCachedSet = true;
+      }
+    return maxCached;
+  }
+}
+
+// buffers can be allocated and freed inside OpenMP regions
+void* BufferPool::AllocLarge( std::size_t bytes)
+{
+  if( MaxCached() == 0) return gdlAlignedMalloc( bytes);
+
+  void* p = NULL;
+#pragma omp critical(gdl_buffer_pool)
+  {
+    PoolMap::iterator it = pool.find( bytes);
+    if( it != pool.end())
+      {
+	p = it->second;
+	pool.erase( it);
+	cached -= bytes;
+	++hits;
+      }
+    else
+      ++misses;
+  }
+  if( p == NULL) p = gdlAlignedMalloc( bytes);
+  return p;
+}
+
+void BufferPool::FreeLarge( void* p, std::size_t bytes)
+{
+  bool kept = false;
+  AdoptedMap::mapped_type release( NULL, NULL);
+#pragma omp critical(gdl_buffer_pool)
+  {
+    AdoptedMap::iterator a = adopted.empty() ? adopted.end() : adopted.find( p);
+    if( a != adopted.end())
+      {
+	release = a->second;
+	adopted.erase( a);
+	kept = true;
+      }
+    else if( cached + bytes <= MaxCached())
+      {
+	pool.insert( PoolMap::value_type( bytes, p));
+	cached += bytes;
+	kept = true;
+      }
+  }
+  if( release.first != NULL) release.first( release.second);
+  else if( !kept) gdlAlignedFree( p);
+}
+
+void BufferPool::Adopt( void* p, void (*release)( void*), void* ctx)
+{
+#pragma omp critical(gdl_buffer_pool)
+  adopted[ p] = AdoptedMap::mapped_type( release, ctx);
+}
+
+void BufferPool::Release()
+{
+  PoolMap drop;
+#pragma omp critical(gdl_buffer_pool)
+  {
+    drop.swap( pool);
+    cached = 0;
+  }
+  for( PoolMap::iterator it = drop.begin(); it != drop.end(); ++it)
+    gdlAlignedFree( it->second);
+}
+
+// not while buffers are allocated in parallel (only by CPU)
+void BufferPool::SetMaxCached( std::size_t bytes)
+{
+  maxCached = bytes;
+  maxCachedSet = true;
+  if( cached > maxCached) Release();
+}
+
+std::size_t BufferPool::GetMaxCached() { return MaxCached(); }
+
+std::size_t BufferPool::GetHits() { return hits; }
+std::size_t BufferPool::GetMisses() { return misses; }
+std::size_t BufferPool::GetCached() { return cached; }
@@ -0,0 +1,73 @@
+/***************************************************************************
+                          gdlbufferpool.hpp  -  reuse of large array buffers
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef GDLBUFFERPOOL_HPP_
+#define GDLBUFFERPOOL_HPP_
+
+#include "includefirst.hpp"
+
+// Large (POD) array buffers are obtained from the system with mmap and
+// given back with munmap on every allocation/deallocation. Expressions
+// like 'tmp = a*b+c' in a loop therefore page fault through a fresh
+// temporary in every iteration.
+// Freed buffers of at least minBytes are kept here and handed out again
+// for a request of exactly the same size (a loop repeats the same sizes).
+// The pool is off by default: it is enabled by CPU, BUFFER_POOL=<MB> or
+// the environment variable GDL_BUFFER_POOL (in MB) which bound the memory
+// kept. It is emptied whenever the interpreter returns to the prompt and
+// at .RESET.
+// Buffers are allocated with gdlAlignedMalloc, so a buffer in the pool may
+// have been allocated elsewhere (e.g. WHERE) and handed to a GDLArray.
+class BufferPool
+{
+public:
+  static const std::size_t minBytes = 256 * 1024;
+
+  static void* Alloc( std::size_t bytes)
+  {
+    if( bytes < minBytes) return gdlAlignedMalloc( bytes);
+    return AllocLarge( bytes);
+  }
+
+  // 'bytes' must not exceed the allocated size of 'p' (NULL is allowed)
+  static void Free( void* p, std::size_t bytes)
+  {
+    if( bytes < minBytes || p == NULL) gdlAlignedFree( p);
+    else FreeLarge( p, bytes);
+  }
+
+  // frees all cached buffers
+  static void Release();
+
+  // bound of the memory kept, 0 disables the pool
+  static void SetMaxCached( std::size_t bytes);
+  static std::size_t GetMaxCached();
+
+  // 'p' (of at least minBytes, not from gdlAlignedMalloc) is used as the
+  // buffer of a GDLArray, e.g. the data of an adopted NumPy array: when the
+  // GDLArray frees it, release( ctx) is called instead
+  static void Adopt( void* p, void (*release)( void*), void* ctx);
+
+  static std::size_t GetHits();
+  static std::size_t GetMisses();
+  static std::size_t GetCached();
+
+private:
+  static void* AllocLarge( std::size_t bytes);
+  static void  FreeLarge( void* p, std::size_t bytes);
+};
+
+#endif
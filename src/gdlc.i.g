@@ -57,6 +57,8 @@ header {
 #include "gdljournal.hpp"
 #include "nullgdl.hpp"
 
+void ForgetLISTNodeIndex( DStructGDL* self); // list.cpp
+
 //class ProgNode;
 //typedef ProgNode* ProgNodeP;
 
@@ -235,8 +237,8 @@ public:
     typedef RefHeap<BaseGDL> RefBaseGDL;
     typedef RefHeap<DStructGDL> RefDStructGDL;
 
-    typedef std::map<SizeT, RefBaseGDL> HeapT;
-    typedef std::map<SizeT, RefDStructGDL> ObjHeapT;
+    typedef HeapTable<BaseGDL> HeapT;
+    typedef HeapTable<DStructGDL> ObjHeapT;
 
 protected:
 //     typedef std::map<SizeT, BaseGDL*> HeapT;
@@ -284,23 +286,25 @@ public:
     {
         SizeT tmpIx=heapIx;
         for( SizeT i=0; i<n; i++)
-        objHeap.insert( objHeap.end(),
-            std::pair<SizeT, RefDStructGDL>( heapIx++, (DStructGDL*)var));
+        objHeap.insert( heapIx++, var);
         return tmpIx;
     }
     SizeT NewHeap( SizeT n=1, BaseGDL* var=NULL)
     {
         SizeT tmpIx=heapIx;
         for( SizeT i=0; i<n; i++)
-        heap.insert( heap.end(),
-            std::pair<SizeT, RefBaseGDL>( heapIx++, var));
+        heap.insert( heapIx++, var);
         return tmpIx;
     }
     static void FreeObjHeapDirect( DObj id, ObjHeapT::iterator it)
     {
         BaseGDL* del = (*it).second.get();
         objHeap.erase( id); 
-        if (!NullGDL::IsNULLorNullGDL(del)) delete del; //avoid destroying !NULL
+        if (!NullGDL::IsNULLorNullGDL(del))
+        {
+            ForgetLISTNodeIndex( static_cast<DStructGDL*>( del));
+            delete del; //avoid destroying !NULL
+        }
     }
     static void FreeObjHeap( DObj id)
     {
@@ -680,11 +684,12 @@ std::cout << add << " + <ObjHeapVar" << id << ">" << std::endl;
         SizeT nEl = heap.size();
         if( nEl == 0) return new DPtrGDL( 0);
         DPtrGDL* ret = new DPtrGDL( dimension( &nEl, 1), BaseGDL::NOZERO);
-        SizeT i=0;
-        for( HeapT::iterator it=heap.begin(); it != heap.end(); ++it)
+        std::vector<SizeT> ids;
+        heap.SortedIDs( ids);
+        for( SizeT i=0; i<nEl; ++i)
         {
-            IncRef( it->first);
-            (*ret)[ i++] = it->first;
+            IncRef( ids[ i]);
+            (*ret)[ i] = ids[ i];
         }
         return ret;
     }
@@ -694,12 +699,8 @@ std::cout << add << " + <ObjHeapVar" << id << ">" << std::endl;
     {
         SizeT nEl = heap.size();
         if( nEl == 0) return new std::vector<DPtr>();
-        std::vector<DPtr>* ret = new std::vector<DPtr>( nEl);
-        SizeT i=0;
-        for( HeapT::iterator it=heap.begin(); it != heap.end(); ++it)
-        {
-            (*ret)[ i++] = it->first;
-        }
+        std::vector<DPtr>* ret = new std::vector<DPtr>();
+        heap.SortedIDs( *ret);
         return ret;
     }
 
@@ -728,11 +729,12 @@ std::cout << add << " + <ObjHeapVar" << id << ">" << std::endl;
         SizeT nEl = objHeap.size();
         if( nEl == 0) return new DObjGDL( 0);
         DObjGDL* ret = new DObjGDL( dimension( &nEl, 1), BaseGDL::NOZERO);
-        SizeT i=0;
-        for( ObjHeapT::iterator it=objHeap.begin(); it != objHeap.end(); ++it)
+        std::vector<SizeT> ids;
+        objHeap.SortedIDs( ids);
+        for( SizeT i=0; i<nEl; ++i)
         {
-            IncRefObj( it->first);
-            (*ret)[ i++] = it->first;
+            IncRefObj( ids[ i]);
+            (*ret)[ i] = ids[ i];
         }
         return ret;
     }
@@ -742,12 +744,8 @@ std::cout << add << " + <ObjHeapVar" << id << ">" << std::endl;
     {
         SizeT nEl = objHeap.size();
         if( nEl == 0) return new std::vector<DObj>();
-        std::vector<DObj>* ret = new std::vector<DObj>( nEl);
-        SizeT i=0;
-        for( ObjHeapT::iterator it=objHeap.begin(); it != objHeap.end(); ++it)
-        {
-            (*ret)[ i++] = it->first;
-        }
+        std::vector<DObj>* ret = new std::vector<DObj>();
+        objHeap.SortedIDs( *ret);
         return ret;
     }
 
@@ -757,15 +755,17 @@ std::cout << add << " + <ObjHeapVar" << id << ">" << std::endl;
         for( HeapT::iterator it=heap.begin(); it != heap.end(); ++it)
         {
            BaseGDL* del = (*it).second.get();
+           (*it).second.get() = NULL;
            if (!NullGDL::IsNULLorNullGDL(del)) delete del; //avoid destroying !NULL
-           heap.erase( it->first); 
         }
+        heap.clear();
         for( ObjHeapT::iterator it=objHeap.begin(); it != objHeap.end(); ++it)
         {
            BaseGDL* del = (*it).second.get();
+           (*it).second.get() = NULL;
            if (!NullGDL::IsNULLorNullGDL(del)) delete del; //avoid destroying !NULL
-           heap.erase( it->first);
         }
+        objHeap.clear();
 // The counters are reset for easier human readability.
        heapIx = 1;
     }
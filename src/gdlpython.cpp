@@ -72,19 +72,42 @@ void PythonEnd()
   //Py_Finalize();
 }
 
+// release function of NumPy arrays adopted by GDL (see BufferPool::Adopt)
+static void ReleasePyArray( void* array)
+{
+  PyGILState_STATE gil = PyGILState_Ensure();
+  Py_DECREF( static_cast<PyObject*>( array));
+  PyGILState_Release( gil);
+}
+
+// 'array' is a new (contiguous) reference. If 'adopt', the GDL array uses
+// the data of a large, aligned array of native byte order without copying
+// them (and keeps the reference until it is freed).
 template< typename T>
-T* NewFromPyArrayObject( const dimension& dim, PyArrayObject *array)
+T* NewFromPyArrayObject( const dimension& dim, PyArrayObject *array, bool adopt)
 {
+  SizeT nBytes = dim.NDimElements() * sizeof( typename T::Ty);
+#ifdef USE_EIGEN
+  // GDLArray hands its buffers to BufferPool::Free() only with Eigen
+  if( adopt && nBytes >= BufferPool::minBytes &&
+      PyArray_ISALIGNED( array) && PyArray_ISNOTSWAPPED( array) &&
+      PyArray_ISWRITEABLE( array) &&
+      (reinterpret_cast<std::size_t>( PyArray_DATA( array)) % 16) == 0)
+    {
+      T* res = new T( dim, BaseGDL::NOALLOC);
+      res->SetBuffer( PyArray_DATA( array));
+      res->SetBufferSize( dim.NDimElements());
+      BufferPool::Adopt( PyArray_DATA( array), ReleasePyArray, array);
+      return res;
+    }
+#endif
   T* res = new T( dim, BaseGDL::NOZERO);
-  SizeT nEl = res->N_Elements();
-  typename T::Ty* dPtr = 
-    reinterpret_cast<typename T::Ty*>( PyArray_DATA(array));
-  for( SizeT i=0; i<nEl; ++i) (*res)[i] = dPtr[i];
+  memcpy( res->DataAddr(), PyArray_DATA( array), nBytes);
   Py_DECREF(array); // must be decremented
   return res;
 }
 
-BaseGDL* FromPython( PyObject* pyObj)
+BaseGDL* FromPython( PyObject* pyObj, bool adopt)
 {
   if( !PyArray_Check( pyObj))
     {
@@ -150,23 +173,27 @@ BaseGDL* FromPython( PyObject* pyObj)
   switch( PyArray_DTYPE(array)->type_num)
     {
     case NPY_UINT8:   //GDL_BYTE
-      return NewFromPyArrayObject< DByteGDL>( dim, array);
+      return NewFromPyArrayObject< DByteGDL>( dim, array, adopt);
     case NPY_INT16:   //GDL_INT
-      return NewFromPyArrayObject< DIntGDL>( dim, array);
+      return NewFromPyArrayObject< DIntGDL>( dim, array, adopt);
     case NPY_INT32:     //GDL_LONG	
-      return NewFromPyArrayObject< DLongGDL>( dim, array);
+      return NewFromPyArrayObject< DLongGDL>( dim, array, adopt);
     case NPY_FLOAT32:   //GDL_FLOAT	
-      return NewFromPyArrayObject< DFloatGDL>( dim, array);
+      return NewFromPyArrayObject< DFloatGDL>( dim, array, adopt);
     case NPY_FLOAT64:  //GDL_DOUBLE	
-      return NewFromPyArrayObject< DDoubleGDL>( dim, array);
+      return NewFromPyArrayObject< DDoubleGDL>( dim, array, adopt);
     case NPY_COMPLEX64:  //GDL_COMPLEX	
-      return NewFromPyArrayObject< DComplexGDL>( dim, array);
+      return NewFromPyArrayObject< DComplexGDL>( dim, array, adopt);
     case NPY_COMPLEX128: //GDL_COMPLEXDBL	
-      return NewFromPyArrayObject< DComplexDblGDL>( dim, array);
+      return NewFromPyArrayObject< DComplexDblGDL>( dim, array, adopt);
     case NPY_UINT16:         //GDL_UINT*
-      return NewFromPyArrayObject< DUIntGDL>( dim, array);
+      return NewFromPyArrayObject< DUIntGDL>( dim, array, adopt);
     case NPY_UINT32:         //GDL_ULONG*
-      return NewFromPyArrayObject< DULongGDL>( dim, array);
+      return NewFromPyArrayObject< DULongGDL>( dim, array, adopt);
+    case NPY_INT64:          //GDL_LONG64*
+      return NewFromPyArrayObject< DLong64GDL>( dim, array, adopt);
+    case NPY_UINT64:         //GDL_ULONG64*
+      return NewFromPyArrayObject< DULong64GDL>( dim, array, adopt);
     default:
       Py_DECREF(array); // must be decremented
       throw GDLException( "FromPython: Unknown array type.") ;
@@ -304,8 +331,12 @@ namespace lib {
       }
     else
       {
+	// NOCOPY: a large array result is used in place (GDL keeps a
+	// reference to it), the caller must not modify it from python then
+	static int nocopyIx = e->KeywordIx( "NOCOPY");
+	bool adopt = e->KeywordSet( nocopyIx);
 	try {
-	  res = FromPython( pResult);
+	  res = FromPython( pResult, adopt);
 	  Py_DECREF(pResult);
 	}
 	catch(...)
@@ -25,7 +25,8 @@ std::nullptr_t PythonInit();
 void PythonInit();
 #endif
 void PythonEnd();
-BaseGDL* FromPython( PyObject* pyObj);
+// 'adopt': large numeric arrays may keep the NumPy data (no copy)
+BaseGDL* FromPython( PyObject* pyObj, bool adopt = false);
 
 namespace lib {
 
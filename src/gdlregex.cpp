@@ -0,0 +1,98 @@
+/***************************************************************************
+                          gdlregex.cpp  -  compiled regular expressions
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "includefirst.hpp"
+
+#include <list>
+#include <map>
+
+#include "gdlregex.hpp"
+
+#define MAX_REGEXPERR_LENGTH 80
+
+namespace {
+
+  typedef std::pair<std::string, int> RegexKey; // pattern, cflags
+  typedef std::list<std::pair<RegexKey, CompiledRegex*> > RegexList;
+
+  RegexList lru; // most recently used first
+  std::map<RegexKey, RegexList::iterator> regexIndex;
+}
+
+CompiledRegex::~CompiledRegex()
+{
+  for( SizeT i = 0; i < copies.size(); ++i)
+    regfree( &copies[ i]);
+}
+
+const CompiledRegex* RegexCache::Get( const std::string& pattern, int cflags,
+				      SizeT nThreads, std::string& errMsg)
+{
+#ifdef USE_TRE
+  nThreads = 1; // TRE's regexec does not lock
+#endif
+  if( nThreads < 1) nThreads = 1;
+
+  RegexKey key( pattern, cflags);
+  CompiledRegex* re;
+  std::map<RegexKey, RegexList::iterator>::iterator it = regexIndex.find( key);
+  if( it != regexIndex.end())
+    {
+      lru.splice( lru.begin(), lru, it->second);
+      re = it->second->second;
+    }
+  else
+    {
+      re = new CompiledRegex();
+      regex_t regexp;
+      int compRes = regcomp( &regexp, pattern.c_str(), cflags);
+      if( compRes)
+	{
+	  char err_msg[MAX_REGEXPERR_LENGTH];
+	  regerror( compRes, &regexp, err_msg, MAX_REGEXPERR_LENGTH);
+	  errMsg = err_msg;
+	  delete re;
+	  return NULL;
+	}
+      re->copies.push_back( regexp);
+
+      if( lru.size() >= maxEntries)
+	{
+	  regexIndex.erase( lru.back().first);
+	  delete lru.back().second;
+	  lru.pop_back();
+	}
+      lru.push_front( RegexList::value_type( key, re));
+      regexIndex[ key] = lru.begin();
+    }
+
+  // a valid pattern compiles again
+  while( re->copies.size() < nThreads)
+    {
+      regex_t regexp;
+      regcomp( &regexp, pattern.c_str(), cflags);
+      re->copies.push_back( regexp);
+    }
+  return re;
+}
+
+void RegexCache::Release()
+{
+  for( RegexList::iterator it = lru.begin(); it != lru.end(); ++it)
+    delete it->second;
+  lru.clear();
+  regexIndex.clear();
+}
@@ -0,0 +1,79 @@
+/***************************************************************************
+                          gdlregex.hpp  -  compiled regular expressions
+                             -------------------
+    begin                : October 2026
+    copyright            : (C) 2026 by GDL development team
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef GDLREGEX_HPP_
+#define GDLREGEX_HPP_
+
+#include "includefirst.hpp"
+
+#include <string>
+#include <vector>
+
+#include "typedefs.hpp"
+
+// POSIX extended regular expressions: the C library's regcomp/regexec,
+// or TRE (-DTRE=ON), which implements the same POSIX semantics
+// (leftmost longest match, same subexpressions) faster and without the
+// lock glibc's regexec takes on a shared regex_t
+#ifdef USE_TRE
+#include <tre/regex.h>
+#else
+#include <regex.h>
+#endif
+
+// the compiled copies of one regular expression: one per thread, unless
+// the regex library can match with a shared regex_t in parallel
+class CompiledRegex
+{
+  std::vector<regex_t> copies;
+
+  CompiledRegex() {}
+  CompiledRegex( const CompiledRegex&);
+  CompiledRegex& operator=( const CompiledRegex&);
+  ~CompiledRegex();
+
+  friend class RegexCache;
+
+public:
+
+  // the regex_t to be used by thread 'thread'
+  const regex_t* Thread( int thread) const
+  {
+    return &copies[ copies.size() == 1 ? 0 : thread];
+  }
+
+  SizeT NSubExpr() const { return copies[ 0].re_nsub + 1; }
+};
+
+// STREGEX, STRTOK, STRSPLIT, ... in loops use the same few patterns over
+// and over: the last maxEntries compiled ones are kept (LRU).
+// To be used by the interpreter thread only (outside of parallel regions).
+class RegexCache
+{
+public:
+  static const SizeT maxEntries = 64;
+
+  // 'pattern' compiled with regcomp flags 'cflags' for (at least) 'nThreads'
+  // threads, valid until the next maxEntries-1 calls at least.
+  // NULL if 'pattern' is invalid: 'errMsg' holds the regerror message then
+  static const CompiledRegex* Get( const std::string& pattern, int cflags,
+				   SizeT nThreads, std::string& errMsg);
+
+  // drops all compiled regular expressions
+  static void Release();
+};
+
+#endif
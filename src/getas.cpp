@@ -31,7 +31,7 @@
 
 
 #include "real2int.hpp"
-#include "ofmt.hpp" // OutAuto
+#include "ofmt.hpp" // AppendAuto
 
 #include <iomanip>
 
@@ -46,17 +46,17 @@ using namespace std;
 // for double -> string
 inline string double2string( DDouble d)      
 {
-  std::ostringstream os;
-  OutAuto( os, d, 16, 8, ' ');
-  return os.str();
+  std::string s;
+  AppendAuto( s, d, 16, 8, ' ');
+  return s;
 }
 
 // for float -> string
 inline string float2string( DFloat f)      
 {
-  std::ostringstream os;
-  OutAuto( os, f, 13, 6, ' ');
-  return os.str();
+  std::string s;
+  AppendAuto( s, f, 13, 6, ' ');
+  return s;
 }
 
 
@@ -27,13 +27,39 @@
 #include "FMTLexer.hpp"
 #include "FMTParser.hpp"
 
+#include "getfmtast.hpp"
+#include "fmtprogram.hpp"
+
 #include <antlr/ASTFactory.hpp>
 
+#include <list>
+#include <map>
+
 using namespace std;
 
 antlr::ASTFactory FMTNodeFactory("FMTNode",FMTNode::factory);
 
-RefFMTNode GetFMTAST( DString fmtString)
+namespace {
+
+  // the parsed format strings, most recently used first
+  struct FMTCacheEntry
+  {
+    RefFMTNode  ast;
+    FMTProgram* program;
+    bool        compiled; // program is set (might be NULL)
+  };
+
+  typedef std::list<std::pair<DString, FMTCacheEntry> > FMTCacheList;
+
+  const SizeT maxFMTCache = 64;
+
+  FMTCacheList fmtCache;
+  std::map<DString, FMTCacheList::iterator> fmtCacheIndex;
+
+  bool fmtCacheEnabled = true;
+}
+
+static RefFMTNode ParseFMT( const DString& fmtString)
 {
   istringstream istr(fmtString); //+"\n");
 
@@ -87,3 +113,47 @@ RefFMTNode GetFMTAST( DString fmtString)
 
   return fmtAST;
 }
+
+void SetFMTCacheEnabled( bool enabled)
+{
+  fmtCacheEnabled = enabled;
+}
+
+// a loop like 'for i=0,n-1 do s[i]=STRING(x[i], FORMAT=fmt)' uses the
+// same format string over and over: do not parse it again
+RefFMTNode GetFMTAST( DString fmtString, const FMTProgram** program)
+{
+  if( !fmtCacheEnabled)
+    {
+      if( program != NULL) *program = NULL;
+      return ParseFMT( fmtString);
+    }
+
+  std::map<DString, FMTCacheList::iterator>::iterator it = fmtCacheIndex.find( fmtString);
+  if( it != fmtCacheIndex.end())
+    fmtCache.splice( fmtCache.begin(), fmtCache, it->second);
+  else
+    {
+      FMTCacheEntry entry = { ParseFMT( fmtString), NULL, false };
+      if( fmtCache.size() >= maxFMTCache)
+	{
+	  delete fmtCache.back().second.program;
+	  fmtCacheIndex.erase( fmtCache.back().first);
+	  fmtCache.pop_back();
+	}
+      fmtCache.push_front( FMTCacheList::value_type( fmtString, entry));
+      fmtCacheIndex[ fmtString] = fmtCache.begin();
+    }
+
+  FMTCacheEntry& entry = fmtCache.front().second;
+  if( program != NULL)
+    {
+      if( !entry.compiled)
+	{
+	  entry.program = FMTProgram::Compile( entry.ast);
+	  entry.compiled = true;
+	}
+      *program = entry.program;
+    }
+  return entry.ast;
+}
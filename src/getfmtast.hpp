@@ -26,6 +26,16 @@
 
 extern antlr::ASTFactory FMTNodeFactory;
 
-RefFMTNode GetFMTAST( DString fmtString);
+class FMTProgram;
+
+// the AST of a format string (cached, the last 64 are kept);
+// '*program' (if 'program' is not NULL) is set to its FMTProgram (NULL if
+// it can only be executed by FMTOut), valid until the next call
+RefFMTNode GetFMTAST( DString fmtString, const FMTProgram** program = NULL);
+
+// CPU, FORMAT_CACHE=0 (GDL extension): no cache and no FMTProgram, each
+// format string is parsed on every use and output goes through FMTOut
+// (the reference the cached path is tested against)
+void SetFMTCacheEnabled( bool enabled);
 
 #endif
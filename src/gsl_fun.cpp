@@ -29,6 +29,7 @@
 #include "envt.hpp"
 #include "basic_fun.hpp"
 #include "gsl_fun.hpp"
+#include "binning.hpp"
 #include "dinterpreter.hpp"
 
 #ifdef _MSC_VER
@@ -49,7 +50,6 @@
 #include <gsl/gsl_fft_complex_float.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
-#include <gsl/gsl_histogram.h>
 #include <gsl/gsl_multimin.h>
 
 // newton/broyden
@@ -1267,27 +1267,17 @@ namespace lib {
   }
 #endif
 
-  // Alain C., 26 February 2013
-  // this is a temporary workaround of an in accuracy in the GSL (up to 1.15)
-  // when working on 64b version and integer bin size ...
-  // GDL bug report 618683
-  // http://sourceforge.net/tracker/?func=detail&aid=3602623&group_id=97659&atid=618683
-  // GSL bug report thread 
-  // http://lists.gnu.org/archive/html/bug-gsl/2013-02/msg00006.html
-
-  static void gdl_make_uniform (gsl_histogram * h, size_t n, double xmin, double xmax)
-  {
-    size_t i;
-    for (i = 0; i <= n; i++)
-      h->range[i] = xmin +  (double) i * (xmax-xmin)/((double) n);
-  }
+  // HISTOGRAM: the counting is done by HistogramCount (binning.cpp).
+  // Its bins are those set up for gsl_histogram before, corrected as in
+  // Alain C.'s workaround of 26 February 2013 (GDL bug report 618683) for
+  // an inaccuracy of the GSL (up to 1.15) with integer bin sizes:
+  // range[i] = xmin + (double) i * (xmax-xmin)/((double) n)
 
 
   BaseGDL* histogram_fun( EnvT* e)
   {
     double a;
     double b;
-    DULong nri;
 
     SizeT nParam=e->NParam(1);
 
@@ -1296,11 +1286,19 @@ namespace lib {
     if (p0->Rank() == 0) 
       e->Throw( "Expression must be an array in this context: " + e->GetParString(0));
 
-    SizeT nEl = p0->N_Elements();
-
     if( p0->Type() == GDL_COMPLEX || p0->Type() == GDL_COMPLEXDBL)
       e->Throw( "Complex expression not allowed in this context: "
 		+e->GetParString(0));
+
+    // the counting handles the integer and floating point types, the
+    // rest (STRING) is histogrammed as DOUBLE
+    Guard<BaseGDL> p0Guard;
+    if( p0->Type() == GDL_STRING)
+      {
+	p0 = p0->Convert2( GDL_DOUBLE, BaseGDL::COPY);
+	p0Guard.Reset( p0);
+      }
+
     static int binsizeIx=e->KeywordIx("BINSIZE");
     BaseGDL* binsizeKW = e->GetKW(binsizeIx);
     DDouble bsize = 1.0;
@@ -1330,43 +1328,13 @@ namespace lib {
     if( binsizeKW != NULL && nbinsKW != NULL && maxKW != NULL)
       e->Throw( "Conflicting keywords.");
 
-    DDoubleGDL *p0D;
-    Guard<BaseGDL> guard;
-    if( p0->Type() != GDL_DOUBLE)
-      {
-	p0D = static_cast<DDoubleGDL*>(p0->Convert2( GDL_DOUBLE, BaseGDL::COPY));
-	guard.Init( p0D);
-      }
-    else
-      {
-	p0D = static_cast<DDoubleGDL*>(p0);
-      }
     // get min max
-    // use MinMax here when NAN will be supported
-
     DDouble minVal, maxVal;
 
     static int nanIx=e->KeywordIx("NAN");
-    if( e->KeywordSet(nanIx)) {
-      DLong minEl, maxEl;
-      p0D->MinMax( &minEl, &maxEl, NULL, NULL, true);
-      minVal=(*p0D)[minEl];
-      maxVal=(*p0D)[maxEl];
-    } else {
-      minVal = (*p0D)[0];
-      maxVal = minVal;
-      for( SizeT i=1; i<nEl; ++i) {
-	if (!isfinite((*p0D)[i])) {
-	  if (!isnan((*p0D)[i])) {
-	    e->Throw("Array has too many elements (Infinite value encoutered).");
-	  };
-	}
-	if ((*p0D)[i] < minVal) 
-	  minVal = (*p0D)[i];
-	else if ((*p0D)[i] > maxVal) 
-	  maxVal = (*p0D)[i];
-      }
-    }
+    if( !HistogramDataRange( p0, e->KeywordSet(nanIx), minVal, maxVal))
+      e->Throw("Array has too many elements (Infinite value encoutered).");
+    DDouble dataMin = minVal, dataMax = maxVal;
 
     int debug=0;
     if (debug) cout << "min/max : " << minVal << " " << maxVal << endl;
@@ -1437,31 +1405,24 @@ namespace lib {
 	|| (binsizeKW == NULL && maxKW == NULL && nbinsKW != NULL)
 	 ) b = a + nbins * bsize;
  
-    // GSL error handling
-    SetTemporaryGSLErrorHandlerT setTemporaryGSLErrorHandler( GDLGenericGSLErrorHandler);
-
-    gsl_histogram* hh = gsl_histogram_alloc( nbins);
-    GDLGuard<gsl_histogram> hhGuard( hh, gsl_histogram_free);
-    gsl_histogram_set_ranges_uniform( hh, a, b);
-
-    // temporary revisited computation of bin values ...
-    gdl_make_uniform (hh, hh->n, a, b);
+    // (formerly rejected by gsl_histogram_alloc / _set_ranges_uniform)
+    if( nbins <= 0 || !(a < b))
+      e->Throw( "Illegal binsize or max/min.");
 
     // Set maxVal from keyword if present
     if (maxKW != NULL) e->AssureDoubleScalarKW(maxIx, maxVal);
 
-    // Generate histogram
-    for( SizeT i=0; i<nEl; ++i) {
-      if ((*p0D)[i] <= maxVal)
-	gsl_histogram_increment(hh, (*p0D)[i]);
-    }
-
-    dimension dim( nbins);
-    DLongGDL* res = new DLongGDL(dim, BaseGDL::NOZERO);
+    static int reverse_indicesIx=e->KeywordIx("REVERSE_INDICES");
+    bool wantRI = e->KeywordPresent(reverse_indicesIx);
+    if (wantRI && input != NULL)
+      e->Throw("Conflicting keywords.");
 
-    for( SizeT i=0; i<nbins; ++i) {
-      (*res)[i] = static_cast<DLong>( gsl_histogram_get(hh, i));
-    }
+    // Generate histogram (and reverse indices) of the values in [a, b)
+    // not above maxVal
+    DLongGDL* revindKW = NULL;
+    DLongGDL* res = HistogramCount( p0, a, b, nbins, dataMin, dataMax, maxVal,
+				    wantRI ? &revindKW : NULL);
+    Guard<DLongGDL> revindGuard( revindKW);
 
     // Add input to output if present
     if (input != NULL)
@@ -1483,80 +1444,9 @@ namespace lib {
     }
 
     // REVERSE_INDICES
-    static int reverse_indicesIx=e->KeywordIx("REVERSE_INDICES");
-    if( e->KeywordPresent(reverse_indicesIx)) {
-
-      if (input != NULL)
-	e->Throw("Conflicting keywords.");
-
-      DULong k = 0;
-      multimap< size_t, SizeT> bin_j;
-      for( SizeT j=0; j<nEl; ++j) {
-	if( (*p0D)[j] >= a && (*p0D)[j] <= b) 
-	  {
-	    ++k;
-
-	    size_t bin;
-	    gsl_histogram_find (hh, (*p0D)[j], &bin);
-
-	    bin_j.insert( make_pair( bin, j));
-	  }
-      }
-
-      nri = nbins + k + 1;
-      DLongGDL* revindKW = new DLongGDL( dimension( nri), BaseGDL::NOZERO);
-
-      k = 0;
-      for( SizeT i=0; i<nbins; ++i) 
-	{
-	  typedef multimap< size_t, SizeT>::const_iterator mmI;
-	  
-	  pair< mmI, mmI> b = bin_j.equal_range( i);
-	  
-	  for( mmI j = b.first; j != b.second; ++j)
-	    {
-	      (*revindKW)[nbins+1+k] = j->second;
-	      k++;
-	    }	    
-	}
-
-      //       for( SizeT i=nbins+1; i<nri; ++i)
-      // 	cout << (*revindKW)[i] << " ";
-      //       cout << endl;
-
-
-      //       k = 0;
-      //       for( SizeT i=0; i<nbins; ++i) {
-      // 	for( SizeT j=0; j<nEl; ++j) {
-
-      // 	  if( (*p0D)[j] >= a && (*p0D)[j] <= b) 
-      // 	    {
-      // 	      size_t bin;
-      // 	      gsl_histogram_find (hh, (*p0D)[j], &bin);
-	      
-      // 	      if( bin == i) 
-      // 		{
-      // 		  (*revindKW)[nbins+1+k] = j;
-      // 		  k++;
-      // 		}
-      // 	    }
-      // 	}
-      //       }
+    if( wantRI)
+      e->SetKW(reverse_indicesIx, revindGuard.release());
 
-      //       for( SizeT i=nbins+1; i<nri; ++i)
-      // 	cout << (*revindKW)[i] << " ";
-      //       cout << endl;
-
-      (*revindKW)[0] = nbins + 1;
-      k = 0;
-      for( SizeT i=1; i<=nbins; ++i) {
-	k += (*res)[i-1];
-	(*revindKW)[i] = k + nbins + 1;
-      }
-
-      e->SetKW(reverse_indicesIx, revindKW);
-    }
-    
     // LOCATIONS
     static int locationsIx=e->KeywordIx("LOCATIONS");
     if( e->KeywordPresent(locationsIx)) {
@@ -1629,8 +1519,6 @@ namespace lib {
       }
 
     }
-    //gsl_histogram_free (hh);
-
     return(res);
   }
 
@@ -66,6 +66,9 @@
 #include "dpro.hpp"
 #include "dinterpreter.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
 
 static bool trace_me(false);
  
@@ -209,7 +212,8 @@ static DStructGDL* GetOBJ( BaseGDL* Objptr, EnvUDT* e)
   }
 
 // if not found returns -(pos +1)
-DLong HashIndex( DStructGDL* hashTable, BaseGDL* key, bool isfoldcase=false)
+// binary search in the table, which is kept sorted (with holes)
+static DLong HashIndexSorted( DStructGDL* hashTable, BaseGDL* key, bool isfoldcase)
 {
     GDL_HASHTABLEENTRY()
   assert( key != NULL && key != NullGDL::GetSingleInstance());
@@ -221,12 +225,11 @@ DLong HashIndex( DStructGDL* hashTable, BaseGDL* key, bool isfoldcase=false)
     if(trace_me) std::cout << ". ";
 
   BaseGDL* keyfind = key;
+  Guard<BaseGDL> keyfindGuard;
   if(dofoldcase) 
     {       // this code bombs if key is not a string.
-    DString keyval = (*static_cast<DStringGDL*>(key))[0];
-    std::transform(keyval.begin(), keyval.end(),
-                            keyval.begin(), ::tolower);
-    keyfind = static_cast<BaseGDL*>(new DStringGDL(keyval));
+    keyfind = new DStringGDL( StrLowCase( (*static_cast<DStringGDL*>(key))[0]));
+    keyfindGuard.Init( keyfind);
       }
     if(trace_me) std::cout << ". ";
   
@@ -256,15 +259,15 @@ DLong HashIndex( DStructGDL* hashTable, BaseGDL* key, bool isfoldcase=false)
     DPtr kID = (*static_cast<DPtrGDL*>( hashTable->GetTag( pKeyTag, searchIx)))[0];
     assert( kID != 0);
     BaseGDL* candidate = BaseGDL::interpreter->GetHeap( kID);
+    int hashCompare;
     if( dofoldcase  and  candidate->Type() == GDL_STRING) 
       {
-          DString keyval = (*static_cast<DStringGDL*>(candidate))[0];
-            std::transform(keyval.begin(), keyval.end(),
-                            keyval.begin(), ::tolower);
-        candidate = static_cast<BaseGDL*>(new DStringGDL(keyval));
-          }
+        DStringGDL candidateLow( StrLowCase( (*static_cast<DStringGDL*>(candidate))[0]));
+        hashCompare = keyfind->HashCompare( &candidateLow);
+      }
+    else
+      hashCompare = keyfind->HashCompare( candidate);
 
-    int hashCompare = keyfind->HashCompare( candidate);
     if( hashCompare == 0)
       return searchIx;
     
@@ -289,7 +292,309 @@ DLong HashIndex( DStructGDL* hashTable, BaseGDL* key, bool isfoldcase=false)
     }
   }
 }
-  
+
+// Native open addressing index of a GDL_HASHTABLEENTRY table: maps the
+// keys (hashed by value, without going through BaseGDL) to their slot.
+// The table itself stays the storage and stays sorted: this gives the
+// HASH its iteration order and is what SAVE/RESTORE and HEAP_GC see.
+// Indices are built on first lookup, kept up to date by
+// InsertIntoHashTable() and RemoveFromHashTable() and dropped when the
+// table struct is deleted (e.g. by GrowHashTable()).
+namespace {
+
+  // hash and compare a key element consistent with HashCompare():
+  // integers compare as RangeT, other numeric types as DDouble
+  template< typename GDLT>
+  inline void IntKey( BaseGDL* key, SizeT ix, RangeT& i, DDouble& d)
+  {
+    i = static_cast<RangeT>((*static_cast<GDLT*>(key))[ ix]);
+    d = static_cast<DDouble>( i);
+  }
+  template< typename GDLT>
+  inline void FloatKey( BaseGDL* key, SizeT ix, RangeT& i, DDouble& d)
+  {
+    d = static_cast<DDouble>((*static_cast<GDLT*>(key))[ ix]);
+  }
+  template< typename GDLT>
+  inline void ComplexKey( BaseGDL* key, SizeT ix, RangeT& i, DDouble& d)
+  {
+    d = real((*static_cast<GDLT*>(key))[ ix]);
+  }
+
+  // false for key types which cannot be indexed
+  bool NumericKey( BaseGDL* key, SizeT ix, RangeT& i, DDouble& d)
+  {
+    switch( key->Type())
+      {
+      case GDL_BYTE:       IntKey<DByteGDL>( key, ix, i, d); return true;
+      case GDL_INT:        IntKey<DIntGDL>( key, ix, i, d); return true;
+      case GDL_UINT:       IntKey<DUIntGDL>( key, ix, i, d); return true;
+      case GDL_LONG:       IntKey<DLongGDL>( key, ix, i, d); return true;
+      case GDL_ULONG:      IntKey<DULongGDL>( key, ix, i, d); return true;
+      case GDL_LONG64:     IntKey<DLong64GDL>( key, ix, i, d); return true;
+      case GDL_ULONG64:    IntKey<DULong64GDL>( key, ix, i, d); return true;
+      case GDL_FLOAT:      FloatKey<DFloatGDL>( key, ix, i, d); return true;
+      case GDL_DOUBLE:     FloatKey<DDoubleGDL>( key, ix, i, d); return true;
+      case GDL_COMPLEX:    ComplexKey<DComplexGDL>( key, ix, i, d); return true;
+      case GDL_COMPLEXDBL: ComplexKey<DComplexDblGDL>( key, ix, i, d); return true;
+      default: return false;
+      }
+  }
+
+  inline SizeT MixHash( DULong64 b)
+  {
+    b ^= b >> 33;
+    b *= 0xff51afd7ed558ccdULL;
+    b ^= b >> 33;
+    return static_cast<SizeT>( b);
+  }
+
+  bool HashKeyElement( BaseGDL* key, SizeT ix, bool isfoldcase, SizeT& h)
+  {
+    if( key->Type() == GDL_STRING)
+      {
+	const DString& str = (*static_cast<DStringGDL*>(key))[ ix];
+	if( isfoldcase)
+	  h = std::hash<DString>()( StrLowCase( str));
+	else
+	  h = std::hash<DString>()( str);
+	return true;
+      }
+    RangeT i;
+    DDouble d;
+    if( !NumericKey( key, ix, i, d)) return false;
+    if( d == 0.0) d = 0.0; // -0.0
+    DULong64 bits;
+    std::memcpy( &bits, &d, sizeof( bits));
+    h = MixHash( bits);
+    return true;
+  }
+
+  bool KeyElementEqual( BaseGDL* key, SizeT ix, BaseGDL* candidate, bool isfoldcase)
+  {
+    if( key->Type() == GDL_STRING)
+      {
+	if( candidate->Type() != GDL_STRING) return false;
+	const DString& k = (*static_cast<DStringGDL*>(key))[ ix];
+	const DString& c = (*static_cast<DStringGDL*>(candidate))[ 0];
+	if( k.length() != c.length()) return false;
+	if( !isfoldcase) return k == c;
+	for( SizeT i=0; i<k.length(); ++i)
+	  if( tolower( k[ i]) != tolower( c[ i])) return false;
+	return true;
+      }
+    if( candidate->Type() == GDL_STRING) return false;
+    RangeT i;
+    DDouble d;
+    if( !NumericKey( key, ix, i, d)) return false;
+    if( IntType( key->Type()) && IntType( candidate->Type()))
+      return i == candidate->LoopIndex();
+    return d == candidate->HashValue();
+  }
+
+  class HashKeyIndex
+  {
+    std::vector<DLong> slot; // -1: empty
+    std::vector<SizeT> hash;
+    SizeT mask;
+    SizeT nUsed;
+
+    void Resize( SizeT capacity)
+    {
+      std::vector<DLong> oldSlot;
+      std::vector<SizeT> oldHash;
+      oldSlot.swap( slot);
+      oldHash.swap( hash);
+      slot.assign( capacity, -1);
+      hash.resize( capacity);
+      mask = capacity - 1;
+      nUsed = 0;
+      for( SizeT i=0; i<oldSlot.size(); ++i)
+	if( oldSlot[ i] >= 0)
+	  Insert( oldHash[ i], oldSlot[ i]);
+    }
+
+  public:
+    bool foldCase;
+    DLong tableSize;
+    bool valid;
+
+    HashKeyIndex(): mask( 0), nUsed( 0), foldCase( false), tableSize( 0), valid( false) {}
+
+    void Insert( SizeT h, DLong s)
+    {
+      if( 2 * (nUsed + 1) > slot.size())
+	Resize( slot.empty() ? 64 : 2 * slot.size());
+      SizeT p = h & mask;
+      while( slot[ p] >= 0) p = (p + 1) & mask;
+      slot[ p] = s;
+      hash[ p] = h;
+      ++nUsed;
+    }
+
+    // position in slot[] of table slot s (which has hash h)
+    SizeT Locate( SizeT h, DLong s) const
+    {
+      SizeT p = h & mask;
+      while( slot[ p] != s)
+	{
+	  assert( slot[ p] >= 0);
+	  p = (p + 1) & mask;
+	}
+      return p;
+    }
+
+    void Move( SizeT h, DLong from, DLong to)
+    {
+      slot[ Locate( h, from)] = to;
+    }
+
+    // backward shift deletion
+    void Erase( SizeT h, DLong s)
+    {
+      SizeT p = Locate( h, s);
+      SizeT q = p;
+      for(;;)
+	{
+	  q = (q + 1) & mask;
+	  if( slot[ q] < 0) break;
+	  SizeT home = hash[ q] & mask;
+	  // can the entry at q move to the hole at p?
+	  if( ((q - home) & mask) >= ((q - p) & mask))
+	    {
+	      slot[ p] = slot[ q];
+	      hash[ p] = hash[ q];
+	      p = q;
+	    }
+	}
+      slot[ p] = -1;
+      --nUsed;
+    }
+
+    // -1 if not found
+    DLong Find( DStructGDL* hashTable, BaseGDL* key, SizeT ix, SizeT h) const
+    {
+      GDL_HASHTABLEENTRY()
+      for( SizeT p = h & mask; slot[ p] >= 0; p = (p + 1) & mask)
+	{
+	  if( hash[ p] != h) continue;
+	  DPtr kID = (*static_cast<DPtrGDL*>( hashTable->GetTag( pKeyTag, slot[ p])))[0];
+	  BaseGDL* candidate = BaseGDL::interpreter->GetHeap( kID);
+	  if( KeyElementEqual( key, ix, candidate, foldCase))
+	    return slot[ p];
+	}
+      return -1;
+    }
+
+    void Build( DStructGDL* hashTable, bool isfoldcase)
+    {
+      GDL_HASHTABLEENTRY()
+      foldCase = isfoldcase;
+      tableSize = hashTable->N_Elements();
+      slot.clear();
+      hash.clear();
+      nUsed = 0;
+      SizeT capacity = 64;
+      while( capacity < 2 * static_cast<SizeT>( tableSize)) capacity <<= 1;
+      Resize( capacity);
+      valid = true;
+      for( DLong s=0; s<tableSize; ++s)
+	{
+	  DPtr kID = (*static_cast<DPtrGDL*>( hashTable->GetTag( pKeyTag, s)))[0];
+	  if( kID == 0) continue;
+	  SizeT h;
+	  if( !HashKeyElement( BaseGDL::interpreter->GetHeap( kID), 0, foldCase, h))
+	    {
+	      valid = false;
+	      return;
+	    }
+	  Insert( h, s);
+	}
+    }
+  };
+
+  typedef std::unordered_map<DStructGDL*, HashKeyIndex> HashKeyIndexMapT;
+
+  // never deleted: tables may be destructed during static deinitialization
+  HashKeyIndexMapT& HashKeyIndices()
+  {
+    static HashKeyIndexMapT* indices = new HashKeyIndexMapT();
+    return *indices;
+  }
+
+  // small tables are fast enough with binary search
+  const DLong hashKeyIndexMinSize = 64;
+
+  // returns NULL if the table is not (or cannot be) indexed
+  HashKeyIndex* GetHashKeyIndex( DStructGDL* hashTable, bool isfoldcase)
+  {
+    DLong tableSize = hashTable->N_Elements();
+    if( tableSize < hashKeyIndexMinSize)
+      return NULL;
+    HashKeyIndex& ix = HashKeyIndices()[ hashTable];
+    if( ix.tableSize != tableSize || ix.foldCase != isfoldcase)
+      ix.Build( hashTable, isfoldcase);
+    return ix.valid ? &ix : NULL;
+  }
+
+  // the index (if any) which must follow modifications of hashTable
+  HashKeyIndex* ExistingHashKeyIndex( DStructGDL* hashTable)
+  {
+    HashKeyIndexMapT& indices = HashKeyIndices();
+    HashKeyIndexMapT::iterator it = indices.find( hashTable);
+    if( it == indices.end() || !it->second.valid ||
+	it->second.tableSize != hashTable->N_Elements())
+      return NULL;
+    return &it->second;
+  }
+
+  SizeT HashOfSlot( DStructGDL* hashTable, DLong s, bool isfoldcase)
+  {
+    GDL_HASHTABLEENTRY()
+    DPtr kID = (*static_cast<DPtrGDL*>( hashTable->GetTag( pKeyTag, s)))[0];
+    SizeT h = 0;
+    HashKeyElement( BaseGDL::interpreter->GetHeap( kID), 0, isfoldcase, h);
+    return h;
+  }
+
+} // namespace
+
+// called by ~DStructGDL()
+void DropHashKeyIndex( DStructGDL* hashTable)
+{
+  HashKeyIndexMapT& indices = HashKeyIndices();
+  if( !indices.empty())
+    indices.erase( hashTable);
+}
+
+// if not found returns -(pos +1)
+DLong HashIndex( DStructGDL* hashTable, BaseGDL* key, bool isfoldcase=false)
+{
+  assert( key != NULL && key != NullGDL::GetSingleInstance());
+  HashKeyIndex* ix = GetHashKeyIndex( hashTable, isfoldcase);
+  SizeT h;
+  if( ix != NULL && HashKeyElement( key, 0, isfoldcase, h))
+  {
+    DLong s = ix->Find( hashTable, key, 0, h);
+    if( s >= 0)
+      return s;
+  }
+  // not found: the caller might need the insert position
+  return HashIndexSorted( hashTable, key, isfoldcase);
+}
+
+// lookup of element ix of key, -1 if not found (no insert position)
+static DLong HashLookup( DStructGDL* hashTable, BaseGDL* key, SizeT ix, bool isfoldcase)
+{
+  HashKeyIndex* index = GetHashKeyIndex( hashTable, isfoldcase);
+  SizeT h;
+  if( index != NULL && HashKeyElement( key, ix, isfoldcase, h))
+    return index->Find( hashTable, key, ix, h);
+  BaseGDL* keyIx = key->NewIx( ix);
+  Guard<BaseGDL> keyIxGuard( keyIx);
+  DLong s = HashIndexSorted( hashTable, keyIx, isfoldcase);
+  return (s >= 0) ? s : -1;
+}
 
 bool Hashisfoldcase( DStructGDL* hashStruct)
 {
@@ -496,6 +801,10 @@ BaseGDL* RemoveFromHashTable( EnvUDT* e, DStructGDL* hashStruct, BaseGDL* key)
       ThrowFromInternalUDSub( e, "Key does not exist.");
   }
   
+  HashKeyIndex* index = ExistingHashKeyIndex( hashTable);
+  if( index != NULL)
+    index->Erase( HashOfSlot( hashTable, hashIndex, index->foldCase), hashIndex);
+
   DPtr kID = (*static_cast<DPtrGDL*>(hashTable->GetTag( pKeyTag, hashIndex)))[0];
   DPtr vID = (*static_cast<DPtrGDL*>(hashTable->GetTag( pValueTag, hashIndex)))[0];
 
@@ -535,6 +844,7 @@ void InsertIntoHashTable( DStructGDL* hashStruct, DStructGDL*& hashTable, BaseGD
     DPtr kID = BaseGDL::interpreter->NewHeap(1,key->Dup());
     (*static_cast<DPtrGDL*>(hashTable->GetTag( pKeyTag, insertPos)))[0] = kID;
     (*static_cast<DLongGDL*>( hashStruct->GetTag( TableCountTag, 0)))[0] = 1;
+    DropHashKeyIndex( hashTable);
     return;
   }
   
@@ -565,6 +875,15 @@ void InsertIntoHashTable( DStructGDL* hashStruct, DStructGDL*& hashTable, BaseGD
 
   // new key -> insert 
   DLong insertPos = -(hashIndex + 1);
+
+  // slots are shuffled below
+  HashKeyIndex* index = ExistingHashKeyIndex( hashTable);
+  SizeT keyHash;
+  if( index != NULL && !HashKeyElement( key, 0, index->foldCase, keyHash))
+  {
+    DropHashKeyIndex( hashTable);
+    index = NULL;
+  }
    
 //   std::cout << "   try "<< i2s(insertPos) << "... ";
 
@@ -580,6 +899,8 @@ void InsertIntoHashTable( DStructGDL* hashStruct, DStructGDL*& hashTable, BaseGD
       // we could optimize this by using a new DStructGDL function
       for( DLong i=nextFreeElementIx; i>insertPos; --i)
       {
+    if( index != NULL)
+      index->Move( HashOfSlot( hashTable, i-1, index->foldCase), i-1, i);
     (*static_cast<DPtrGDL*>(hashTable->GetTag( pKeyTag, i)))[0] =
     (*static_cast<DPtrGDL*>(hashTable->GetTag( pKeyTag, i-1)))[0];
     
@@ -604,6 +925,8 @@ void InsertIntoHashTable( DStructGDL* hashStruct, DStructGDL*& hashTable, BaseGD
       {
     for( DLong i=nextFreeElementIx; i<insertPos; ++i)
     {
+      if( index != NULL)
+        index->Move( HashOfSlot( hashTable, i+1, index->foldCase), i+1, i);
 //    std::cout << i2s(i+1) << " -> " << i2s(i) << "   kID:";//std::endl;
 //    std::cout << (*static_cast<DPtrGDL*>(hashTable->GetTag( pKeyTag, i+1)))[0]; 
 //    std::cout << "   vID:" << (*static_cast<DPtrGDL*>(hashTable->GetTag( pValueTag, i+1)))[0];
@@ -630,6 +953,8 @@ void InsertIntoHashTable( DStructGDL* hashStruct, DStructGDL*& hashTable, BaseGD
   (*static_cast<DPtrGDL*>(hashTable->GetTag( pKeyTag, insertPos)))[0] = kID;
   DPtr pID = BaseGDL::interpreter->NewHeap(1,value);
   (*static_cast<DPtrGDL*>(hashTable->GetTag( pValueTag, insertPos)))[0] = pID;
+  if( index != NULL)
+    index->Insert( keyHash, insertPos);
 
 //   std::cout << "   at "<< i2s(insertPos) << "(" << i2s(kID) << "," << i2s(pID) << ")" <<std::endl;
 
@@ -1109,7 +1434,7 @@ void list_leftinsertion( EnvUDT* e, BaseGDL* theref, int iprm  );
       }
       else // against other HASH
       {
-    DLong insertIx = HashIndex(compareTable, key, isfoldcase);
+    DLong insertIx = HashLookup(compareTable, key, 0, isfoldcase);
     if( insertIx >= 0) // found
     {
 
@@ -1178,7 +1503,7 @@ void list_leftinsertion( EnvUDT* e, BaseGDL* theref, int iprm  );
     BaseGDL* key = BaseGDL::interpreter->GetHeap( kID);
     assert( key != NULL);
 
-    DLong insertIx = HashIndex(hashTable, key, isfoldcase);
+    DLong insertIx = HashLookup(hashTable, key, 0, isfoldcase);
     if( insertIx >= 0) // found
     {
       // this key was already handled (inserted or not) during the first compare
@@ -1377,7 +1702,7 @@ void list_leftinsertion( EnvUDT* e, BaseGDL* theref, int iprm  );
       }
       else // against other HASH
       {
-    DLong insertIx = HashIndex(compareTable, key, isfoldcase);
+    DLong insertIx = HashLookup(compareTable, key, 0, isfoldcase);
     if( insertIx < 0) // not found
       continue;
 
@@ -1970,7 +2295,7 @@ void list_leftinsertion( EnvUDT* e, BaseGDL* theref, int iprm  );
 
     if( keyList->N_Elements() == 1)
     {
-      DLong hashIndex = HashIndex( thisHashTable, keyList, isfoldcase);
+      DLong hashIndex = HashLookup( thisHashTable, keyList, 0, isfoldcase);
       if( hashIndex >= 0)
     return new DIntGDL( 1);
       return new DIntGDL( 0);
@@ -1981,9 +2306,7 @@ void list_leftinsertion( EnvUDT* e, BaseGDL* theref, int iprm  );
     Guard<BaseGDL> resultGuard( result);
     for( SizeT i=0; i<keyListN_Elements; ++i)
     {
-    BaseGDL* key = keyList->NewIx( i);
-//  Guard<BaseGDL> keyGuard( key);
-    DLong hashIndex = HashIndex( thisHashTable, key, isfoldcase);
+    DLong hashIndex = HashLookup( thisHashTable, keyList, i, isfoldcase);
     if( hashIndex >= 0)
       (*result)[ i] = 1;
     }
@@ -2253,7 +2576,7 @@ BaseGDL* hash_newhash(SizeT nEntries = 0, bool isfoldcase = false) {
         ThrowFromInternalUDSub( e, "For struct access (OBJREF is !NULL), RVALUE must be !NULL as well.");      
       }
 
-      DLong hashIndex = HashIndex( thisHashTable, parX, isfoldcase);
+      DLong hashIndex = HashLookup( thisHashTable, parX, 0, isfoldcase);
       if( hashIndex < 0)
         ThrowFromInternalUDSub( e, "Key not found.");
 
@@ -2608,21 +2931,50 @@ BaseGDL* hash_subset(DStructGDL* thisTable, BaseGDL* index, bool isfoldcase)
     (*static_cast<DPtrGDL*>( hashStruct->GetTag( pTableTag, 0)))[0] = hashTableID;
     (*static_cast<DLongGDL*>( hashStruct->GetTag( TableSizeTag, 0)))[0] = initialTableSize;
 
-    BaseGDL* actKey;
+    // one pass over the keys: thisTable is sorted, so the hits ordered
+    // by their slot there are already in the order of the new table
+    std::vector<std::pair<DLong, BaseGDL*> > hits; // (slot, key)
+    hits.reserve( nEntries);
+    std::vector<bool> slotUsed( thisTable->N_Elements(), false);
     for( SizeT eIx=0; eIx<nEntries; ++eIx)
     {
-        if(iskeylist)   actKey = GetNodeData(keyNode);
-        else            actKey = index->NewIx( eIx);
-      
-      DLong hashIndex = HashIndex( thisTable, actKey, isfoldcase);
-      if( hashIndex < 0) continue;
+      DLong hashIndex;
+      BaseGDL* actKey;
+      if(iskeylist)
+      {
+        actKey = GetNodeData(keyNode); // not owned
+        hashIndex = HashLookup( thisTable, actKey, 0, isfoldcase);
+        if( hashIndex < 0 || slotUsed[ hashIndex]) continue;
+        actKey = actKey->Dup();
+      }
+      else
+      {
+        hashIndex = HashLookup( thisTable, index, eIx, isfoldcase);
+        if( hashIndex < 0 || slotUsed[ hashIndex]) continue;
+        actKey = index->NewIx( eIx);
+      }
+      slotUsed[ hashIndex] = true;
+      hits.push_back( std::make_pair( hashIndex, actKey));
+    }
+    std::sort( hits.begin(), hits.end());
+
+    SizeT nCount = hits.size();
+    for( SizeT i=0; i<nCount; ++i)
+    {
+      DLong hashIndex = hits[ i].first;
       DPtr vID = (*static_cast<DPtrGDL*>(thisTable->GetTag( pValueTag, hashIndex)))[0];
       BaseGDL* value = BaseGDL::interpreter->GetHeap( vID);
 
       if( value != NULL)    value = value->Dup();          
 
-      InsertIntoHashTable( hashStruct, hashTable, actKey->Dup(), value);
+      // spread over the table as GrowHashTable() does
+      SizeT newIx = i * initialTableSize / nCount;
+      (*static_cast<DPtrGDL*>(hashTable->GetTag( pKeyTag, newIx)))[0] =
+        BaseGDL::interpreter->NewHeap( 1, hits[ i].second);
+      (*static_cast<DPtrGDL*>(hashTable->GetTag( pValueTag, newIx)))[0] =
+        BaseGDL::interpreter->NewHeap( 1, value);
     }
+    (*static_cast<DLongGDL*>( hashStruct->GetTag( TableCountTag, 0)))[0] = nCount;
     newObjGuard.Release();
     return newObj;
   }
@@ -2894,7 +3246,7 @@ BaseGDL* hash_duplicate(DStructGDL* self) {
     // one element -> return value
     if( index->N_Elements() == 1)
     {
-      DLong hashIndex = HashIndex( thisHashTable, index, isfoldcase);
+      DLong hashIndex = HashLookup( thisHashTable, index, 0, isfoldcase);
 //      if( hashIndex < 0) ThrowFromInternalUDSub( e, "Key is not present.");
      if( hashIndex < 0) return NullGDL::GetSingleInstance();
       DPtr vID = (*static_cast<DPtrGDL*>(thisHashTable->GetTag( pValueTag, hashIndex)))[0];
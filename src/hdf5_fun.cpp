@@ -352,6 +352,44 @@ hid_t
 
   }
 
+#if (H5_VERS_MAJOR>1)||((H5_VERS_MAJOR==1)&&(H5_VERS_MINOR>8))||((H5_VERS_MAJOR==1)&&(H5_VERS_MINOR==8)&&(H5_VERS_RELEASE>=3))
+#define GDL_H5_CHUNK_CACHE 1
+
+  // smallest prime >= n (for the number of chunk cache slots)
+  static size_t hdf5_next_prime(size_t n)
+  {
+    if (n <= 2) return 2;
+    for (n |= 1; ; n += 2) {
+      size_t d = 3;
+      while (d * d <= n && n % d != 0) d += 2;
+      if (d * d > n) return n;
+    }
+  }
+
+  // the HDF5 documentation recommends about 100 hash slots per chunk
+  // fitting into the cache (collisions evict chunks)
+  static size_t hdf5_chunk_cache_nslots(hid_t h5d_id, size_t nbytes)
+  {
+    size_t nslots = H5D_CHUNK_CACHE_NSLOTS_DEFAULT;
+    hid_t dcpl = H5Dget_create_plist(h5d_id);
+    if (dcpl < 0) return nslots;
+    hsize_t chunk[H5S_MAX_RANK];
+    if (H5Pget_layout(dcpl) == H5D_CHUNKED) {
+      int crank = H5Pget_chunk(dcpl, H5S_MAX_RANK, chunk);
+      hid_t datatype = H5Dget_type(h5d_id);
+      if (crank > 0 && datatype >= 0) {
+        size_t chunkBytes = H5Tget_size(datatype);
+        for (int i = 0; i < crank; i++) chunkBytes *= chunk[i];
+        if (chunkBytes > 0)
+          nslots = hdf5_next_prime(100 * max<size_t>(nbytes / chunkBytes, 1));
+      }
+      if (datatype >= 0) H5Tclose(datatype);
+    }
+    H5Pclose(dcpl);
+    return nslots;
+  }
+#endif
+
   BaseGDL* h5d_open_fun( EnvT* e)
   {
     SizeT nParam=e->NParam(2);
@@ -365,6 +403,54 @@ hid_t
 
     if (h5d_id < 0) { string msg; e->Throw(hdf5_error_message(msg)); }
 
+    // raw data chunk cache of this dataset (GDL extension):
+    // CHUNK_CACHE_SIZE in bytes, CHUNK_CACHE_NSLOTS (number of hash slots,
+    // by default about 100 per chunk fitting into the cache) and
+    // CHUNK_CACHE_W0 (preemption policy, 0 to 1)
+    static int cacheNSlotsIx = e->KeywordIx("CHUNK_CACHE_NSLOTS");
+    static int cacheSizeIx = e->KeywordIx("CHUNK_CACHE_SIZE");
+    static int cacheW0Ix = e->KeywordIx("CHUNK_CACHE_W0");
+    if (e->KeywordPresent(cacheNSlotsIx) || e->KeywordPresent(cacheSizeIx) ||
+        e->KeywordPresent(cacheW0Ix)) {
+#ifdef GDL_H5_CHUNK_CACHE
+      size_t nbytes = H5D_CHUNK_CACHE_NBYTES_DEFAULT;
+      size_t nslots = H5D_CHUNK_CACHE_NSLOTS_DEFAULT;
+      double w0 = H5D_CHUNK_CACHE_W0_DEFAULT;
+      if (e->KeywordPresent(cacheSizeIx)) {
+        DLong64 val;
+        e->AssureLongScalarKW(cacheSizeIx, val);
+        if (val < 0) e->Throw("CHUNK_CACHE_SIZE must not be negative.");
+        nbytes = val;
+        nslots = hdf5_chunk_cache_nslots(h5d_id, nbytes);
+      }
+      if (e->KeywordPresent(cacheNSlotsIx)) {
+        DLong64 val;
+        e->AssureLongScalarKW(cacheNSlotsIx, val);
+        if (val <= 0) e->Throw("CHUNK_CACHE_NSLOTS must be positive.");
+        nslots = val;
+      }
+      if (e->KeywordPresent(cacheW0Ix)) {
+        e->AssureDoubleScalarKW(cacheW0Ix, w0);
+        if (!(w0 >= 0 && w0 <= 1)) e->Throw("CHUNK_CACHE_W0 must be in [0,1].");
+      }
+
+      // the cache is a property of the dataset access: reopen with it
+      hid_t dapl = H5Pcreate(H5P_DATASET_ACCESS);
+      if (dapl < 0 || H5Pset_chunk_cache(dapl, nslots, nbytes, w0) < 0) {
+        if (dapl >= 0) H5Pclose(dapl);
+        H5Dclose(h5d_id);
+        string msg; e->Throw(hdf5_error_message(msg));
+      }
+      H5Dclose(h5d_id);
+      h5d_id = H5Dopen2(h5f_id, h5dDatasetname.c_str(), dapl);
+      H5Pclose(dapl);
+      if (h5d_id < 0) { string msg; e->Throw(hdf5_error_message(msg)); }
+#else
+      H5Dclose(h5d_id);
+      e->Throw("CHUNK_CACHE_* keywords need HDF5 1.8.3 or later.");
+#endif
+    }
+
     return hdf5_output_conversion( h5d_id );
 
   }
@@ -713,10 +799,68 @@ hid_t
   }
 
 
+  // hyperslab of the dataset (dataspace of 'rank' dimensions 'dims', in
+  // HDF5 order) selected by the START, COUNT, STRIDE and BLOCK keywords
+  // (GDL extension, in GDL order). Without keywords the whole dataset.
+  // The result has count[i]*block[i] elements along dimension i.
+  static void hdf5_hyperslab_keywords(EnvT* e, int rank, const hsize_t* dims,
+                                      hsize_t* start, hsize_t* count,
+                                      hsize_t* stride, hsize_t* block)
+  {
+    static int blockIx = e->KeywordIx("BLOCK");
+    static int countIx = e->KeywordIx("COUNT");
+    static int startIx = e->KeywordIx("START");
+    static int strideIx = e->KeywordIx("STRIDE");
+
+    static const char* kwNames[] = {"START", "COUNT", "STRIDE", "BLOCK"};
+    const int kwIx[] = {startIx, countIx, strideIx, blockIx};
+    hsize_t* kwVal[] = {start, count, stride, block};
+
+    for (int i = 0; i < rank; i++) {
+      start[i] = 0; stride[i] = 1; block[i] = 1;
+    }
+
+    bool haveCount = false;
+    bool haveStride = false;
+    for (int k = 0; k < 4; k++) {
+      DLong64GDL* val = e->IfDefGetKWAs<DLong64GDL>(kwIx[k]);
+      if (val == NULL) continue;
+      if (rank == 0)
+        e->Throw("Keyword " + string(kwNames[k]) + " not allowed for a scalar dataset.");
+      if (val->N_Elements() != rank)
+        e->Throw("Keyword " + string(kwNames[k]) + " must have " + i2s(rank) + " elements.");
+      DLong64 minVal = (k == 0) ? 0 : 1;
+      for (int i = 0; i < rank; i++) {
+        if ((*val)[i] < minVal)
+          e->Throw("Keyword " + string(kwNames[k]) + " must be " +
+                   (k == 0 ? "non-negative." : "positive."));
+        kwVal[k][rank - 1 - i] = (*val)[i];
+      }
+      if (k == 1) haveCount = true;
+      if (k == 2) haveStride = true;
+    }
+
+    for (int i = 0; i < rank; i++) {
+      // by default the blocks are adjacent
+      if (!haveStride) stride[i] = block[i];
+      // by default as many blocks as fit
+      if (!haveCount)
+        count[i] = (start[i] + block[i] <= dims[i]) ?
+          (dims[i] - start[i] - block[i]) / stride[i] + 1 : 0;
+      // blocks must not overlap (a single block may be of any size)
+      if (count[i] > 1 && block[i] > stride[i])
+        e->Throw("Keyword BLOCK must not exceed STRIDE.");
+      if (count[i] == 0 ||
+          start[i] + (count[i] - 1) * stride[i] + block[i] > dims[i])
+        e->Throw("Hyperslab exceeds the dataset dimensions.");
+    }
+  }
+
   /**
    * h5d_read_fun
    * CAUTION: compatibility only fractional
-   * - Does not allow to select hyperslabs
+   * - hyperslabs are selected by the START, COUNT, STRIDE and BLOCK
+   *   keywords (GDL extension), not by the FILE_SPACE/MEMORY_SPACE ones
    */
   BaseGDL* h5d_read_fun(EnvT* e) {
 
@@ -803,24 +947,29 @@ hid_t
        cout << endl;
     }
 
-    // define hyperslab in dataset
+    // define hyperslab in dataset: only the selected chunks are read
+    hsize_t start[MAXRANK], count[MAXRANK], stride[MAXRANK], block[MAXRANK];
+    hdf5_hyperslab_keywords(e, rank, dims_out, start, count, stride, block);
+
 #if (H5_VERS_MAJOR < 1) || ((H5_VERS_MAJOR == 1) && (H5_VERS_MINOR < 6)) ||  ((H5_VERS_MAJOR == 1) && (H5_VERS_MINOR == 6) && (H5_VERS_RELEASE <= 3))
     hssize_t offset[MAXRANK];
 #else
     hsize_t offset[MAXRANK];
 #endif
-    hsize_t count[MAXRANK];
 
     if (rank>0) {
 
-       for (int i = 0; i < rank; i++) offset[i] = 0;
-       for (int i = 0; i < rank; i++) count[i] = dims_out[i];
+       for (int i = 0; i < rank; i++) offset[i] = start[i];
 
        if (H5Sselect_hyperslab(h5s_id, H5S_SELECT_SET,
-                               offset, NULL, count, NULL) < 0) {
+                               offset, stride, count, block) < 0) {
           string msg;
           e->Throw(hdf5_error_message(msg));
        }
+
+       // from here on: the dimensions of the result
+       for (int i = 0; i < rank; i++) dims_out[i] = count[i] * block[i];
+       for (int i = 0; i < rank; i++) count[i] = dims_out[i];
     }
     if (debug) cout << "here 2" <<endl;
 
@@ -919,15 +1068,16 @@ hid_t
       /*
        * Allocate array of pointers to rows.
        */
-      rdata = (char **) malloc(count_s[0] * sizeof (char *));
+      SizeT nEl = res->N_Elements();
+      rdata = (char **) malloc(nEl * sizeof (char *));
       /*
        * Allocate space for integer data.
        */
-      rdata[0] = (char *) malloc(count_s[0] * sdim * sizeof (char));
+      rdata[0] = (char *) malloc(nEl * sdim * sizeof (char));
       /*
        * Set the rest of the pointers to rows to the correct addresses.
        */
-      for (int i = 1; i < count_s[0]; i++)
+      for (int i = 1; i < nEl; i++)
         rdata[i] = rdata[0] + i * sdim;
       /*
        * Create the memory datatype.
@@ -937,7 +1087,7 @@ hid_t
 
       if (debug) cout << "here 4b" <<endl;
 
-      status = H5Dread(h5d_id, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata[0]);
+      status = H5Dread(h5d_id, memtype, memspace, h5s_id, H5P_DEFAULT, rdata[0]);
 
       if (debug) cout << "here 4c" <<endl;
 
@@ -947,9 +1097,10 @@ hid_t
       }
       if (debug) cout << "here 4d" <<endl;
 
-      for (int i = 0; i < count_s[0]; i++)
+      for (int i = 0; i < nEl; i++)
         (*(static_cast<DStringGDL*> (res)))[i] = rdata[i];
-      free (rdata); //but not rdata[0]
+      free (rdata[0]);
+      free (rdata);
       status = H5Tclose (filetype);
       status = H5Tclose (memtype);
       return res;
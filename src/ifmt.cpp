@@ -38,25 +38,31 @@ using namespace std;
 
 void ReadNext( istream& is, string& buf)
 {
+  // character by character as is.get(), but from the stream buffer
+  const int eof = istream::traits_type::eof();
+  if( is.tie() != NULL) is.tie()->flush();
+  streambuf* sb = is.rdbuf();
+
   bool trail = false;
-  char c;
+  int c = sb->sgetc();
   for(;;)
     {
-      c = is.get();
-
-      //      int cc = c;
-      //      cout << "c: " << cc << " ("<<c<<")"<<endl;
-      
-      if( is.eof())  return;
-      if( c == '\n') return;
-      if( trail && (c == ' ' || c == '\t'))
+      if( c == eof)
 	{
-	  is.unget();
+	  is.setstate( ios_base::eofbit | ios_base::failbit);
 	  return;
 	}
+      if( c == '\n')
+	{
+	  sb->sbumpc();
+	  return;
+	}
+      if( trail && (c == ' ' || c == '\t'))
+	return;
 
-      buf.push_back( c);
+      buf.push_back( static_cast<char>( c));
       trail = true;
+      c = sb->snextc();
     }
 }
 
@@ -1171,6 +1171,8 @@ namespace SysVar
 #endif
     CpuTPOOL_MIN_ELTS = DefaultTPOOL_MIN_ELTS;
     CpuTPOOL_MAX_ELTS = DefaultTPOOL_MAX_ELTS;
+    CpuTPOOL_MIN_ELTS_ARITH = DefaultTPOOL_MIN_ELTS_ARITH;
+    CpuTPOOL_MIN_ELTS_TRANSC = DefaultTPOOL_MIN_ELTS_TRANSC;
 
     DStructGDL* cpuData = new DStructGDL( "!CPU");
     cpuData->NewTag("HW_VECTOR", new DLongGDL( 0)); 
@@ -1187,6 +1189,9 @@ namespace SysVar
     //crash in cpu(). (should have been done on 2014 March 18 by AC (tested).)
     cpuData->NewTag("TPOOL_MIN_ELTS", new DLong64GDL( CpuTPOOL_MIN_ELTS)); 
     cpuData->NewTag("TPOOL_MAX_ELTS", new DLong64GDL( CpuTPOOL_MAX_ELTS)); 
+    // GDL extension: thresholds per operation class (see objects.hpp)
+    cpuData->NewTag("TPOOL_MIN_ELTS_ARITH", new DLong64GDL( CpuTPOOL_MIN_ELTS_ARITH)); 
+    cpuData->NewTag("TPOOL_MIN_ELTS_TRANSC", new DLong64GDL( CpuTPOOL_MIN_ELTS_TRANSC)); 
 
     DVar *cpu=new DVar( "CPU", cpuData);
     cpuIx=sysVarList.size();
@@ -19,11 +19,16 @@
 
 #include <cstdio> // std::remove(...)
 
+#include <cerrno>
+
 #include "objects.hpp"
 #include "io.hpp"
 #ifdef __MINGW32__
 #include <unistd.h> // for close()
 #endif
+#if !defined(_WIN32) || defined(__CYGWIN__)
+#include <sys/select.h>
+#endif
 
 #if defined(_WIN32) && !defined(__CYGWIN__)
 #define NS_INT16SZ       2
@@ -537,8 +542,7 @@ void GDLStream::Socket(const string& host,
   if (iSocketStream == NULL)
     iSocketStream = new istringstream;
 
-  if (recvBuf == NULL)
-    recvBuf = new string;
+  recvBeg = recvEnd = 0;
 
   name = host;
 
@@ -610,6 +614,7 @@ void GDLStream::Close() {
   width = defaultStreamWidth;
 
   sockNum = -1;
+  recvBeg = recvEnd = 0;
   c_timeout = 0.0;
   r_timeout = 0.0;
   w_timeout = 0.0;
@@ -642,8 +647,7 @@ void GDLStream::Free() {
   delete iSocketStream;
   iSocketStream = NULL;
 
-  delete recvBuf;
-  recvBuf = NULL;
+  std::vector<char>().swap(recvBuf);
 
   getLunLock = false;
 }
@@ -686,6 +690,79 @@ istringstream& GDLStream::ISocketStream() {
   return *iSocketStream;
 }
 
+// bytes received per recv() into the socket buffer (at least)
+static const SizeT socketRecvChunk = 256 * 1024;
+
+bool GDLStream::SocketWait(DDouble timeout) {
+  if (sockNum == -1)
+    throw GDLIOException("Socket unit is not open.");
+  fd_set readSet;
+  struct timeval tv;
+  int status;
+  do {
+    FD_ZERO(&readSet);
+    FD_SET(sockNum, &readSet);
+    tv.tv_sec = static_cast<long> (timeout);
+    tv.tv_usec = static_cast<long> ((timeout - tv.tv_sec) * 1e6);
+    status = select(sockNum + 1, &readSet, NULL, NULL, (timeout < 0) ? NULL : &tv);
+  } while (status < 0 && errno == EINTR);
+  return status > 0;
+}
+
+SizeT GDLStream::SocketFill(SizeT n) {
+  if (sockNum == -1)
+    throw GDLIOException("Socket unit is not open.");
+  while (recvEnd - recvBeg < n) {
+    if (recvBuf.size() - recvEnd < socketRecvChunk) {
+      if (recvBeg > 0) {
+        memmove(&recvBuf[0], &recvBuf[recvBeg], recvEnd - recvBeg);
+        recvEnd -= recvBeg;
+        recvBeg = 0;
+      }
+      if (recvBuf.size() - recvEnd < socketRecvChunk)
+        recvBuf.resize(std::max(recvEnd + socketRecvChunk, static_cast<SizeT> (2 * recvBuf.size())));
+    }
+    if (r_timeout > 0.0 && !SocketWait(r_timeout)) break;
+    long status = recv(sockNum, &recvBuf[recvEnd], recvBuf.size() - recvEnd, 0);
+    if (status < 0 && errno == EINTR) continue;
+    if (status <= 0) break; // closed (or error)
+    recvEnd += status;
+  }
+  return recvEnd - recvBeg;
+}
+
+SizeT GDLStream::SocketRead(char* dst, SizeT n) {
+  SizeT nRead = std::min(n, SocketAvailable());
+  if (nRead > 0) memcpy(dst, &recvBuf[recvBeg], nRead);
+  recvBeg += nRead;
+  while (nRead < n) {
+    if (r_timeout > 0.0 && !SocketWait(r_timeout)) break;
+    long status = recv(sockNum, dst + nRead, n - nRead, 0);
+    if (status < 0 && errno == EINTR) continue;
+    if (status <= 0) break;
+    nRead += status;
+  }
+  return nRead;
+}
+
+bool GDLStream::SocketEof() {
+  if (SocketAvailable() > 0) return false;
+  if (!SocketWait(0.0)) return false; // nothing yet, but still connected
+  // readable: either data or the end of the connection
+  DDouble rt = r_timeout;
+  r_timeout = 0.0;
+  SizeT n = SocketFill(1);
+  r_timeout = rt;
+  return n == 0;
+}
+
+istringstream& GDLStream::SocketStream() {
+  istringstream& iss = ISocketStream();
+  iss.clear();
+  iss.str(SocketAvailable() > 0 ? string(&recvBuf[recvBeg], SocketAvailable()) : string());
+  return iss;
+}
+
 void GDLStream::Pad(std::streamsize nBytes) {
   if (anyStream != NULL)
     anyStream->Pad(nBytes);
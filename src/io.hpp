@@ -23,6 +23,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 #include <cmath>
 #include <cassert>
 
@@ -143,7 +144,12 @@ class GDLStream
 
   std::istringstream* iSocketStream;
   int sockNum;
-  std::string* recvBuf;
+  // socket input: bytes [recvBeg, recvEnd) of recvBuf were received and
+  // are not read yet. The buffer is reused: unread bytes are moved to its
+  // front when more room is needed, it is never cleared or shrunk.
+  std::vector<char> recvBuf;
+  SizeT recvBeg;
+  SizeT recvEnd;
   DDouble c_timeout;
   DDouble r_timeout;
   DDouble w_timeout;
@@ -183,7 +189,9 @@ public:
 
     iSocketStream(NULL), 
     sockNum( -1),
-    recvBuf(NULL),
+    recvBuf(),
+    recvBeg(0),
+    recvEnd(0),
     c_timeout(0.0),
     r_timeout(0.0),
     w_timeout(0.0),
@@ -285,7 +293,23 @@ public:
 
   int SockNum() { return sockNum;}
   std::istringstream& ISocketStream(); 
-  std::string& RecvBuf() { return *recvBuf;}
+  // socket input
+  SizeT SocketAvailable() { return recvEnd - recvBeg;}
+  // waits at most 'timeout' seconds (for ever if negative) for input
+  bool SocketWait( DDouble timeout);
+  // receives until 'n' bytes are available, the connection is closed or
+  // the READ_TIMEOUT expires; returns the number of available bytes
+  SizeT SocketFill( SizeT n);
+  // reads up to 'n' bytes into 'dst': first the buffered ones, then the
+  // rest directly from the socket; returns the number of bytes read
+  SizeT SocketRead( char* dst, SizeT n);
+  // true if the peer closed the connection and all input was read
+  bool SocketEof();
+  // the available bytes as a stream (ISocketStream), for formatted input
+  // and data which are not read as a block of bytes; SocketConsume() then
+  // discards what was read from it
+  std::istringstream& SocketStream();
+  void SocketConsume( SizeT n) { recvBeg += (n < SocketAvailable()) ? n : SocketAvailable();}
   DDouble cTimeout() { return c_timeout;}
   DDouble rTimeout() { return r_timeout;}
   DDouble wTimeout() { return w_timeout;}
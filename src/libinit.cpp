@@ -37,8 +37,10 @@
 #include "math_fun_ng.hpp"
 #include "plotting.hpp"
 #include "sorting.hpp"
+#include "binning.hpp"
 
 #include "file.hpp"
+#include "csv.hpp"
 
 #include "gsl_fun.hpp"
 
@@ -84,7 +86,7 @@ void LibInit()
 
   const char KLISTEND[] = "";
 
-  const string restoreKey[]={ "FILENAME","DESCRIPTION","VERBOSE", KLISTEND};
+  const string restoreKey[]={ "FILENAME","DESCRIPTION","VERBOSE","NAMES", KLISTEND};
   const string restoreWarnKey[]={"NO_COMPILE", "RELAXED_STRUCTURE_ASSIGNMENT", "RESTORED_OBJECTS" , KLISTEND};
   new DLibPro(lib::gdl_restore,string("RESTORE"),1,restoreKey,restoreWarnKey);
   
@@ -113,7 +115,8 @@ void LibInit()
   new DLibFun (lib::scope_varname_fun, string ("SCOPE_VARNAME"), -1, scope_varnameKey);
 
 
-  const string cpuKey[]={ "RESET","RESTORE","TPOOL_MAX_ELTS", "TPOOL_MIN_ELTS",
+  const string cpuKey[]={ "BUFFER_POOL","CALIBRATE","EXPR_FUSION","FORMAT_CACHE","RESET","RESTORE","TPOOL_MAX_ELTS", "TPOOL_MIN_ELTS",
+					"TPOOL_MIN_ELTS_ARITH","TPOOL_MIN_ELTS_TRANSC",
 					"TPOOL_NTHREADS","VECTOR_ENABLE",KLISTEND};
   new DLibPro(lib::cpu_pro,string("CPU"),0,cpuKey);
   
@@ -211,6 +214,8 @@ void LibInit()
   new DLibFunRetNew(lib::strcmp_fun,string("STRCMP"),3,strcmpKey,NULL,true);
 
   new DLibFunRetNew(lib::eof_fun,string("EOF"),1);
+  const string file_poll_inputKey[]={"TIMEOUT",KLISTEND};
+  new DLibFunRetNew(lib::file_poll_input_fun,string("FILE_POLL_INPUT"),1,file_poll_inputKey);
 
   new DLibFunRetNew(lib::arg_present,string("ARG_PRESENT"),1);
 
@@ -269,6 +274,15 @@ void LibInit()
   const string file_linesKey[]={"NOEXPAND_PATH","COMPRESS",KLISTEND};
   new DLibFunRetNew(lib::file_lines,string("FILE_LINES"),1,file_linesKey);
 
+  const string read_csvKey[]={"COUNT","HEADER","MISSING_VALUE","N_TABLE_HEADER",
+			      "NUM_RECORDS","RECORD_START","SEPARATOR","TABLE_HEADER",
+			      "TYPES",KLISTEND};
+  new DLibFunRetNew(lib::read_csv_fun,string("READ_CSV"),1,read_csvKey);
+  const string write_csvKey[]={"HEADER","TABLE_HEADER",KLISTEND};
+  new DLibPro(lib::write_csv_pro,string("WRITE_CSV"),9,write_csvKey);
+  // used by READ_ASCII
+  new DLibFunRetNew(lib::gdl_split_columns_fun,string("GDL_SPLIT_COLUMNS"),3);
+
   const string file_mkdirKey[]={"NOEXPAND_PATH",KLISTEND};
   new DLibPro(lib::file_mkdir,string("FILE_MKDIR"),-1,file_mkdirKey);
 
@@ -280,6 +294,14 @@ void LibInit()
   const string gdlsortKey[]={"L64","QUICK","MERGE","RADIX","INSERT","AUTO",KLISTEND}; //,"CHECK"
   new DLibFunRetNew(lib::gdl_sort_fun,string("GDL_SORT"),1,gdlsortKey,NULL,true);
 
+  new DLibFunRetNew(lib::uniq_fun,string("UNIQ"),2);
+  const string value_locateKey[]={"L64",KLISTEND};
+  new DLibFunRetNew(lib::value_locate_fun,string("VALUE_LOCATE"),2,value_locateKey);
+  const string hist_ndKey[]={"MAX","MIN","NBINS","REVERSE_INDICES",KLISTEND};
+  new DLibFunRetNew(lib::hist_nd_fun,string("HIST_ND"),2,hist_ndKey);
+  const string hist_2dKey[]={"BIN1","BIN2","MAX1","MAX2","MIN1","MIN2",KLISTEND};
+  new DLibFunRetNew(lib::hist_2d_fun,string("HIST_2D"),2,hist_2dKey);
+
   const string medianKey[]={"EVEN","DOUBLE","DIMENSION",KLISTEND};
   new DLibFunRetNew(lib::median,string("MEDIAN"),2,medianKey);
 
@@ -324,7 +346,7 @@ void LibInit()
   
   
   const string memoryKey[]={"CURRENT","HIGHWATER","NUM_ALLOC",
-    "NUM_FREE","STRUCTURE","L64",KLISTEND};
+    "NUM_FREE","POOL_HITS","POOL_MISSES","STRUCTURE","L64",KLISTEND};
   new DLibFunRetNew(lib::memory_fun, string("MEMORY"), 1, memoryKey, NULL);
 
   // printKey, readKey and stringKey are closely associated
@@ -602,7 +624,7 @@ void LibInit()
 //   new DLibFun(lib::max_fun,string("MAX"),2,maxKey);
 
 #ifdef USE_PYTHON
-  const string python_funKey[]={"ARGV","DEFAULTRETURNVALUE",KLISTEND};
+  const string python_funKey[]={"ARGV","DEFAULTRETURNVALUE","NOCOPY",KLISTEND};
   new DLibFun(lib::gdlpython_fun,string("PYTHON"),-1,python_funKey);
 
   const string python_proKey[]={"ARGV",KLISTEND};
@@ -115,7 +115,10 @@ void LibInit_cl()
   new DLibPro(lib::ncdf_varget1,string("NCDF_VARGET1"),3,ncdf_varget1Key);
 
   //Varget
-  const string ncdf_vargetKey[]={"COUNT","OFFSET", "STRIDE",KLISTEND};
+  // CHUNK_CACHE_*: netCDF-4 chunk cache of the variable (GDL extension)
+  const string ncdf_vargetKey[]={"COUNT","OFFSET", "STRIDE",
+				 "CHUNK_CACHE_NSLOTS","CHUNK_CACHE_SIZE","CHUNK_CACHE_W0",
+				 KLISTEND};
   new DLibPro(lib::ncdf_varget,string("NCDF_VARGET"),3,ncdf_vargetKey);
 
   //Variable ID
@@ -182,7 +185,9 @@ void LibInit_cl()
   new DLibPro(lib::ncdf_varrename, string("NCDF_VARRENAME"), 3);
 
   //put variable
-  const string ncdf_varputKey[]={"COUNT","OFFSET", "STRIDE",KLISTEND};
+  const string ncdf_varputKey[]={"COUNT","OFFSET", "STRIDE",
+				 "CHUNK_CACHE_NSLOTS","CHUNK_CACHE_SIZE","CHUNK_CACHE_W0",
+				 KLISTEND};
   new DLibPro(lib::ncdf_varput, string("NCDF_VARPUT"), 3,ncdf_varputKey);
 
   //epoch time conversion (a draft of the code existed in CVS version before January 2014
@@ -52,6 +52,11 @@ void LibInit_mes()
   const string strtokKey[]={"EXTRACT","ESCAPE","LENGTH",
                             "PRESERVE_NULL","REGEX","COUNT","FOLD_CASE",KLISTEND};
   new DLibFunRetNew(lib::strtok_fun, string("STRTOK"), 2, strtokKey);
+  // STRSPLIT reads the keywords as STRTOK does: same list
+  new DLibFunRetNew(lib::strsplit_fun, string("STRSPLIT"), 2, strtokKey);
+
+  const string strmatchKey[]={"FOLD_CASE",KLISTEND};
+  new DLibFunRetNew(lib::strmatch_fun, string("STRMATCH"), 2, strmatchKey);
 
 
   new DLibPro(lib::setenv_pro, string("SETENV"), 1);
@@ -94,8 +99,11 @@ void LibInit_mes()
   // hdf5 procedures/functions
   new DLibFunRetNew(lib::h5f_create_fun, string("H5F_CREATE"), 1);
   new DLibFunRetNew(lib::h5f_open_fun, string("H5F_OPEN"), 1);
-  new DLibFunRetNew(lib::h5d_open_fun, string("H5D_OPEN"), 2);
-  new DLibFunRetNew(lib::h5d_read_fun, string("H5D_READ"), 1); // TODO: 2nd argument & keywords
+  const string h5dOpenKey[] = {"CHUNK_CACHE_NSLOTS", "CHUNK_CACHE_SIZE",
+                               "CHUNK_CACHE_W0", KLISTEND};
+  new DLibFunRetNew(lib::h5d_open_fun, string("H5D_OPEN"), 2, h5dOpenKey);
+  const string h5dReadKey[] = {"BLOCK", "COUNT", "START", "STRIDE", KLISTEND};
+  new DLibFunRetNew(lib::h5d_read_fun, string("H5D_READ"), 1, h5dReadKey); // TODO: 2nd argument, FILE_SPACE, MEMORY_SPACE
   new DLibFunRetNew(lib::h5d_get_space_fun, string("H5D_GET_SPACE"), 1);
   new DLibFunRetNew(lib::h5s_get_simple_extent_ndims_fun,
                string("H5S_GET_SIMPLE_EXTENT_NDIMS"), 1);
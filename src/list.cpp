@@ -111,6 +111,8 @@
 #include "dpro.hpp"
 #include "dinterpreter.hpp"
 
+#include <unordered_map>
+
   bool Hashisfoldcase( DStructGDL* hashStruct);
   DLong HashIndex( DStructGDL* hashTable, BaseGDL* key, bool isfoldcase);
   void InsertIntoHashTable( DStructGDL* hashStruct,
@@ -254,6 +256,106 @@ static BaseGDL* GetNodeData(DPtr &Node)
     return;
   }
 
+  // Node index of a LIST: the heap IDs of its GDL_CONTAINER_NODEs in
+  // list order, so that list[i] does not walk the PNEXT chain.
+  // The chain remains the storage (SAVE/RESTORE, HEAP_GC and
+  // IDL_CONTAINER use it), the index is validated against PTAIL, PHEAD and
+  // NLIST. Appending and removing at either end are followed incrementally,
+  // any other relinking must call InvalidateLISTNodeIndex().
+  struct LISTNodeIndex
+  {
+    DPtr pTail;
+    DPtr pHead;
+    DLong nList;
+    std::vector<DPtr> nodes;
+
+    LISTNodeIndex(): pTail( 0), pHead( 0), nList( 0) {}
+  };
+  typedef std::unordered_map<DStructGDL*, LISTNodeIndex> LISTNodeIndexMapT;
+  static LISTNodeIndexMapT listNodeIndex;
+  // short lists are cheap to walk, don't keep an index for them
+  static const SizeT listNodeIndexMinSize = 32;
+
+  static void InvalidateLISTNodeIndex( DStructGDL* self)
+  {
+    listNodeIndex.erase( self);
+  }
+
+  // the index is keyed by the LIST struct: drop it when the struct is freed
+  // (the address could be reused by a new LIST)
+  void ForgetLISTNodeIndex( DStructGDL* self)
+  {
+    if( !listNodeIndex.empty()) listNodeIndex.erase( self);
+  }
+
+  // heap IDs are reused after GDLInterpreter::ResetHeap()
+  void ResetLISTNodeIndex()
+  {
+    listNodeIndex.clear();
+  }
+
+  static const std::vector<DPtr>& GetLISTNodeIndex( EnvUDT* e, DStructGDL* self)
+  {
+    GDL_LIST_STRUCT()
+    GDL_CONTAINER_NODE()
+
+    DPtr pTail = (*static_cast<DPtrGDL*>(self->GetTag( pTailTag, 0)))[0];
+    DPtr pHead = (*static_cast<DPtrGDL*>(self->GetTag( pHeadTag, 0)))[0];
+    DLong nList = (*static_cast<DLongGDL*>(self->GetTag( nListTag, 0)))[0];
+
+    LISTNodeIndex& ix = listNodeIndex[ self];
+    std::vector<DPtr>& nodes = ix.nodes;
+    if( ix.pTail == pTail && ix.pHead == pHead && ix.nList == nList)
+      return nodes;
+
+    bool valid = !nodes.empty() && nList > 0;
+    if( valid && ix.pTail == pTail && nList > ix.nList && ix.pHead != pHead &&
+        BaseGDL::interpreter->PtrValid( nodes.back()))
+    { // appended
+      DPtr actP = nodes.back();
+      while( valid && nodes.size() < static_cast<SizeT>( nList))
+      {
+        DStructGDL* actPStruct = GetLISTStruct( e, actP);
+        actP = (*static_cast<DPtrGDL*>( actPStruct->GetTag( pNextTag, 0)))[0];
+        if( actP == 0)
+          valid = false;
+        else
+          nodes.push_back( actP);
+      }
+      valid = valid && nodes.back() == pHead;
+    }
+    else if( valid && ix.pTail == pTail && nList < ix.nList &&
+             nodes[ nList-1] == pHead)
+    { // removed at the end
+      nodes.resize( nList);
+    }
+    else if( valid && ix.pHead == pHead && nList < ix.nList &&
+             nodes[ ix.nList-nList] == pTail)
+    { // removed at the front
+      nodes.erase( nodes.begin(), nodes.begin() + (ix.nList-nList));
+    }
+    else
+      valid = false;
+
+    if( !valid)
+    {
+      nodes.clear();
+      nodes.reserve( nList);
+      DPtr actP = pTail;
+      for( SizeT elIx = 0; elIx < static_cast<SizeT>( nList); ++elIx)
+      {
+        nodes.push_back( actP);
+        DStructGDL* actPStruct = GetLISTStruct( e, actP);
+        actP = (*static_cast<DPtrGDL*>( actPStruct->GetTag( pNextTag, 0)))[0];
+      }
+    }
+
+    ix.pTail = pTail;
+    ix.pHead = pHead;
+    ix.nList = nList;
+    return nodes;
+  }
+
   DPtr GetLISTNode( EnvUDT* e, DStructGDL* self, DLong targetIx)
   {
       
@@ -265,6 +367,12 @@ static BaseGDL* GetNodeData(DPtr &Node)
     {
       actP = (*static_cast<DPtrGDL*>(self->GetTag( pHeadTag, 0)))[0];      
     }
+    else if( targetIx >= 0 && static_cast<SizeT>( targetIx) >= listNodeIndexMinSize &&
+             self->Desc() == structDesc::LIST &&
+             targetIx < (*static_cast<DLongGDL*>(self->GetTag( nListTag, 0)))[0])
+    {
+      actP = GetLISTNodeIndex( e, self)[ targetIx];
+    }
     else
     {
       actP = (*static_cast<DPtrGDL*>(self->GetTag( pTailTag, 0)))[0];
@@ -345,6 +453,8 @@ static BaseGDL* GetNodeData(DPtr &Node)
         GDL_LIST_STRUCT()
     DLong nList = (*static_cast<DLongGDL*>( self->GetTag( nListTag, 0)))[0];          
   
+    InvalidateLISTNodeIndex( self);
+
     DPtr actP = (*static_cast<DPtrGDL*>(self->GetTag( pTailTag, 0)))[0];
     // swipe head and tail pointer
     (*static_cast<DPtrGDL*>( self->GetTag( pTailTag, 0)))[0] = 0;
@@ -2213,6 +2323,8 @@ void list__move( EnvUDT* e)
     }
     if(index1 == index2) return;        // trivial case
 
+    InvalidateLISTNodeIndex( self);
+
     DPtr ptrg, predptr;
     DPtr p0 = pTail;
     DStructGDL* Node = GetLISTStruct(NULL, p0);
@@ -2320,6 +2432,8 @@ void list__swap( EnvUDT* e)
         DLong swap = index1; index1 = index2; index2 = swap;
     } else if(index1 == index2) return;
 
+    InvalidateLISTNodeIndex( self);
+
 // define the standard LIST struct = listDesc:
    DStructDesc* listDesc = structDesc::LIST;
     DStructDesc* containerDesc=structDesc::GDL_CONTAINER_NODE;
@@ -2500,6 +2614,7 @@ void list__swap( EnvUDT* e)
       (*static_cast<DLongGDL*>( listStruct->GetTag( nListTag, 0)))[0] =
       (*static_cast<DLongGDL*>( self->GetTag( nListTag, 0)))[0];
       (*static_cast<DLongGDL*>( self->GetTag( nListTag, 0)))[0] = 0;
+      InvalidateLISTNodeIndex( self);
       
       newObjGuard.Release();
       return newObj;    
@@ -2632,6 +2747,7 @@ void list__swap( EnvUDT* e)
     (*static_cast<DPtrGDL*>( removeNode->GetTag( pNextTag, 0)))[0];
     
     (*static_cast<DLongGDL*>( self->GetTag( nListTag, 0)))[0] = nList - 1;
+    InvalidateLISTNodeIndex( self);
 
 //     e->Interpreter()->HeapErase( pData); // no delete
 //     e->Interpreter()->FreeHeap( pRemoveNode); // no delete
@@ -2734,6 +2850,7 @@ void list__swap( EnvUDT* e)
   }
   SizeT nListStart = nList;
   DLong prvfetch = -1; // repeated indeces need to be skipped!!
+  InvalidateLISTNodeIndex( self);
 #if 1
 // alternative one-way removal.
     DPtr pTail = (*Tail)[0];
@@ -2928,6 +3045,8 @@ void list__swap( EnvUDT* e)
     if( nList <= 1) // no change for empty or one-element
       return;
     
+    InvalidateLISTNodeIndex( self);
+
     DPtr actPrevP = 0;
     DPtr actP = (*static_cast<DPtrGDL*>(self->GetTag( pTailTag, 0)))[0];
     for( SizeT elIx = 0; elIx < nList; ++elIx)
@@ -3411,6 +3530,7 @@ void list__swap( EnvUDT* e)
     (*static_cast<DPtrGDL*>( cStruct->GetTag( pNextTag, 0)))[0] = 
     (*static_cast<DPtrGDL*>( predNode->GetTag( pNextTag, 0)))[0];
         (*static_cast<DPtrGDL*>( predNode->GetTag( pNextTag, 0)))[0] = firstID;
+    InvalidateLISTNodeIndex( self);
     }
       
       (*static_cast<DLongGDL*>( self->GetTag( nListTag, 0)))[0] =
@@ -3583,7 +3703,45 @@ void list__swap( EnvUDT* e)
     newObjGuard.Release();
     return newObj;
   }
-  
+
+  BaseGDL* NewLIST( const std::vector<BaseGDL*>& items)
+  {
+    GDL_LIST_STRUCT()
+    GDL_CONTAINER_NODE()
+
+    DInterpreter* ip = BaseGDL::interpreter;
+
+    // because of .RESET_SESSION, we cannot use static here
+    DStructDesc* containerDesc=structDesc::GDL_CONTAINER_NODE;
+
+    DStructGDL* listStruct= new DStructGDL( structDesc::LIST, dimension());
+    DObj objID= ip->NewObjHeap( 1, listStruct); // owns objStruct
+    BaseGDL* newObj = new DObjGDL( objID); // the list object
+
+    DStructGDL* cStructLast = NULL;
+    DPtr cID = 0;
+    for( SizeT i=0; i<items.size(); ++i)
+    {
+      DPtr pID = ip->NewHeap(1,items[i]); // sets ref count
+
+      DStructGDL* cStruct= new DStructGDL( containerDesc, dimension());
+      (*static_cast<DPtrGDL*>( cStruct->GetTag( pDataTag, 0)))[0] = pID;
+      cID = ip->NewHeap(1,cStruct);
+
+      if( cStructLast != NULL)
+        (*static_cast<DPtrGDL*>( cStructLast->GetTag( pNextTag, 0)))[0] = cID;
+      else
+      { // 1st element
+        (*static_cast<DPtrGDL*>( listStruct->GetTag( pTailTag, 0)))[0] = cID;
+      }
+      cStructLast = cStruct;
+    }
+
+    (*static_cast<DPtrGDL*>( listStruct->GetTag( pHeadTag, 0)))[0] = cID;
+    (*static_cast<DLongGDL*>( listStruct->GetTag( nListTag, 0)))[0] = items.size();
+    return newObj;
+  }
+
  BaseGDL* container__init( EnvUDT* e) {
 // container is parented by GDL_OBJECT which can handle INIT:
     return new DByteGDL(1); // if we reach here, defaul is to return 'TRUE'
@@ -21,6 +21,10 @@
 
 // #include <envt.hpp>
 void LIST__ToStream( DStructGDL* oStructGDL, std::ostream& o, SizeT w, SizeT* actPosPtr);
+// drops the LIST node indices (to be called with GDLInterpreter::ResetHeap())
+void ResetLISTNodeIndex();
+// drops the node index of a LIST (to be called when its struct is freed)
+void ForgetLISTNodeIndex( DStructGDL* self);
 
 DStructGDL*GetOBJ( BaseGDL* selfP, EnvUDT* e);
 DStructGDL*GetSELF( BaseGDL* selfP, EnvUDT* e);
@@ -29,6 +33,10 @@ namespace lib {
 
    BaseGDL* list_fun( EnvT* e);
 
+   // a new LIST of 'items' (which it owns from now on, NULL for !NULL),
+   // as LIST(items[0], items[1], ..., /NO_COPY) would return it
+   BaseGDL* NewLIST( const std::vector<BaseGDL*>& items);
+
    void list__cleanup( EnvUDT* e);
 
    BaseGDL* LIST___OverloadIsTrue( EnvUDT* e);
@@ -60,7 +60,7 @@ namespace lib {
   template< typename srcT, typename destT>
   void FromToGSL(  srcT* src, destT* dest, SizeT nEl)
   {
-    #pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+    #pragma omp parallel if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     {
     #pragma omp for
       for( SizeT d = 0; d<nEl; ++d)
@@ -236,7 +236,7 @@ namespace lib {
             (*res)[ 0] = round ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = round ((*p0C)[ i]);
         return res;
       }
@@ -248,7 +248,7 @@ namespace lib {
             (*res)[ 0] = round ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = round ((*p0C)[ i]);
 
         return res;
@@ -277,7 +277,7 @@ namespace lib {
                   (*res)[ 0] = round ((*p0C)[ 0].real ());
                   return res;
                 }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
               for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = round ((*p0C)[ i].real ());
               return res;
             }
@@ -291,7 +291,7 @@ namespace lib {
                   (*res)[ 0] = round ((*p0C)[ 0].real ());
                   return res;
                 }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
               for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = round ((*p0C)[ i].real ());
               return res;
             }
@@ -312,7 +312,7 @@ namespace lib {
                   (*res)[ 0] = round ((*p0C)[ 0].real ());
                   return res;
                 }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
               for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = round ((*p0C)[ i].real ());
               return res;
             }
@@ -326,7 +326,7 @@ namespace lib {
                   (*res)[ 0] = round ((*p0C)[ 0].real ());
                   return res;
                 }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
               for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = round ((*p0C)[ i].real ());
               return res;
             }
@@ -350,7 +350,7 @@ namespace lib {
             (*res)[ 0] = ceil ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = ceil ((*p0C)[ i]);
         return res;
       }
@@ -362,7 +362,7 @@ namespace lib {
             (*res)[ 0] = ceil ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = ceil ((*p0C)[ i]);
 
         return res;
@@ -391,7 +391,7 @@ namespace lib {
                 (*res)[ 0] = ceil ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = ceil ((*p0C)[ i].real ());
             return res;
           }
@@ -405,7 +405,7 @@ namespace lib {
                 (*res)[ 0] = ceil ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = ceil ((*p0C)[ i].real ());
             return res;
           }
@@ -426,7 +426,7 @@ namespace lib {
                 (*res)[ 0] = ceil ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = ceil ((*p0C)[ i].real ());
             return res;
           }
@@ -440,7 +440,7 @@ namespace lib {
                 (*res)[ 0] = ceil ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = ceil ((*p0C)[ i].real ());
             return res;
           }
@@ -464,7 +464,7 @@ namespace lib {
             (*res)[ 0] = floor ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = floor ((*p0C)[ i]);
         return res;
       }
@@ -476,7 +476,7 @@ namespace lib {
             (*res)[ 0] = floor ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = floor ((*p0C)[ i]);
 
         return res;
@@ -505,7 +505,7 @@ namespace lib {
                 (*res)[ 0] = floor ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = floor ((*p0C)[ i].real ());
             return res;
           }
@@ -519,7 +519,7 @@ namespace lib {
                 (*res)[ 0] = floor ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = floor ((*p0C)[ i].real ());
             return res;
           }
@@ -540,7 +540,7 @@ namespace lib {
                 (*res)[ 0] = floor ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = floor ((*p0C)[ i].real ());
             return res;
           }
@@ -554,7 +554,7 @@ namespace lib {
                 (*res)[ 0] = floor ((*p0C)[ 0].real ());
                 return res;
               }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
             for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = floor ((*p0C)[ i].real ());
             return res;
           }
@@ -577,7 +577,7 @@ namespace lib {
       (*res)[0] = sqrt((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = sqrt((*p0C)[ i]);
     return res;
   }
@@ -590,7 +590,7 @@ namespace lib {
       (*p0C)[0] = sqrt((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = sqrt((*p0C)[ i]);
     return p0;
   }
@@ -612,7 +612,7 @@ namespace lib {
       else return sqrt_fun_template_grab< DFloatGDL>(p0);
     else {
       DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2(GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = sqrt((*res)[ i]);
       return res;
     }
@@ -630,7 +630,7 @@ namespace lib {
         (*res)[0] = sin ((*p0C)[0]);
         return res;
       }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = sin ((*p0C)[ i]);
     return res;
   }
@@ -645,7 +645,7 @@ namespace lib {
         (*p0C)[0] = sin ((*p0C)[0]);
         return p0;
       }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = sin ((*p0C)[ i]);
     return p0;
   }
@@ -665,7 +665,7 @@ namespace lib {
     else
       {
         DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2 (GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = sin ((*res)[ i]);
         return res;
       }
@@ -681,7 +681,7 @@ namespace lib {
       (*res)[0] = cos((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = cos((*p0C)[ i]);
     return res;
   }
@@ -694,7 +694,7 @@ namespace lib {
       (*p0C)[0] = cos((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = cos((*p0C)[ i]);
     return p0;
   }
@@ -716,7 +716,7 @@ namespace lib {
       else return cos_fun_template_grab< DFloatGDL>(p0);
     else {
       DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2(GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = cos((*res)[ i]);
       return res;
     }
@@ -732,7 +732,7 @@ namespace lib {
       (*res)[0] = tan((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = tan((*p0C)[ i]);
     return res;
   }
@@ -745,7 +745,7 @@ namespace lib {
       (*p0C)[0] = tan((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = tan((*p0C)[ i]);
     return p0;
   }
@@ -767,7 +767,7 @@ namespace lib {
       else return tan_fun_template_grab< DFloatGDL>(p0);
     else {
       DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2(GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = tan((*res)[ i]);
       return res;
     }
@@ -783,7 +783,7 @@ namespace lib {
       (*res)[0] = sinh((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = sinh((*p0C)[ i]);
     return res;
   }
@@ -796,7 +796,7 @@ namespace lib {
       (*p0C)[0] = sinh((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = sinh((*p0C)[ i]);
     return p0;
   }
@@ -818,7 +818,7 @@ namespace lib {
       else return sinh_fun_template_grab< DFloatGDL>(p0);
     else {
       DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2(GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = sinh((*res)[ i]);
       return res;
     }
@@ -834,7 +834,7 @@ namespace lib {
       (*res)[0] = cosh((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = cosh((*p0C)[ i]);
     return res;
   }
@@ -847,7 +847,7 @@ namespace lib {
       (*p0C)[0] = cosh((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = cosh((*p0C)[ i]);
     return p0;
   }
@@ -869,7 +869,7 @@ namespace lib {
       else return cosh_fun_template_grab< DFloatGDL>(p0);
     else {
       DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2(GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = cosh((*res)[ i]);
       return res;
     }
@@ -885,7 +885,7 @@ namespace lib {
       (*res)[0] = tanh((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = tanh((*p0C)[ i]);
     return res;
   }
@@ -898,7 +898,7 @@ namespace lib {
       (*p0C)[0] = tanh((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = tanh((*p0C)[ i]);
     return p0;
   }
@@ -920,7 +920,7 @@ namespace lib {
       else return tanh_fun_template_grab< DFloatGDL>(p0);
     else {
       DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2(GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = tanh((*res)[ i]);
       return res;
     }
@@ -935,7 +935,7 @@ namespace lib {
       (*res)[0] = asin((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = asin((*p0C)[ i]);
     return res;
   }
@@ -948,7 +948,7 @@ namespace lib {
       (*p0C)[0] = asin((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = asin((*p0C)[ i]);
     return p0;
   }
@@ -968,7 +968,7 @@ namespace lib {
     else
       {
         DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2 (GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = asin ((*res)[ i]);
         return res;
       }
@@ -983,7 +983,7 @@ namespace lib {
       (*res)[0] = acos((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = acos((*p0C)[ i]);
     return res;
   }
@@ -996,7 +996,7 @@ namespace lib {
       (*p0C)[0] = acos((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = acos((*p0C)[ i]);
     return p0;
   }
@@ -1016,7 +1016,7 @@ namespace lib {
     else
       {
         DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2 (GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = acos ((*res)[ i]);
         return res;
       }
@@ -1032,7 +1032,7 @@ namespace lib {
       (*res)[0] = exp((*p0C)[0]);
       return res;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = exp((*p0C)[ i]);
     return res;
   }
@@ -1045,7 +1045,7 @@ namespace lib {
       (*p0C)[0] = exp((*p0C)[0]);
       return p0;
     }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*p0C)[ i] = exp((*p0C)[ i]);
     return p0;
   }
@@ -1067,7 +1067,7 @@ namespace lib {
       else return exp_fun_template_grab< DFloatGDL>(p0);
     else {
       DFloatGDL* res = static_cast<DFloatGDL*> (p0->Convert2(GDL_FLOAT, BaseGDL::COPY));
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
       for (SizeT i = 0; i < nEl; ++i)(*res)[ i] = exp((*res)[ i]);
       return res;
     }
@@ -1109,7 +1109,7 @@ namespace lib {
         (*res)[ 0] = abs ((*p0C)[ 0]);
         return res;
       }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = abs ((*p0C)[ i]);
     return res;
   }
@@ -1126,7 +1126,7 @@ namespace lib {
             (*res)[ 0] = abs ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = abs ((*p0C)[ i]); //sqrt(Creal*Creal + Cimag*Cimag);
         return res;
       }
@@ -1140,7 +1140,7 @@ namespace lib {
             (*res)[ 0] = abs ((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = abs ((*p0C)[ i]); //sqrt(Creal*Creal + Cimag*Cimag);
         return res;
       }
@@ -1184,7 +1184,7 @@ namespace lib {
         (*res)[ 0] = abs ((*res)[ 0]);
         return res;
       }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
     for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = abs ((*res)[ i]);
     return res;
   }
@@ -1199,7 +1199,7 @@ namespace lib {
         DComplexGDL* res;
         if (isReference) res = static_cast<DComplexGDL*> (p0)->NewResult (); else res=static_cast<DComplexGDL*>(p0);
         DComplexGDL* p0C = static_cast<DComplexGDL*> (p0);
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[i] = std::conj ((*p0C)[i]);
         return res;
       }
@@ -1208,7 +1208,7 @@ namespace lib {
         DComplexDblGDL* res;
         if (isReference) res = static_cast<DComplexDblGDL*> (p0)->NewResult (); else res=res=static_cast<DComplexDblGDL*>(p0);
         DComplexDblGDL* p0C = static_cast<DComplexDblGDL*> (p0);
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[i] = std::conj ((*p0C)[i]);
         return res;
       }
@@ -1232,7 +1232,7 @@ namespace lib {
       {
         DComplexGDL* c0 = static_cast<DComplexGDL*> (p0);
         DFloatGDL* res = new DFloatGDL (c0->Dim (), BaseGDL::NOZERO);
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[i] = imag ((*c0)[i]);
         return res;
       }
@@ -1240,7 +1240,7 @@ namespace lib {
       {
         DComplexDblGDL* c0 = static_cast<DComplexDblGDL*> (p0);
         DDoubleGDL* res = new DDoubleGDL (c0->Dim (), BaseGDL::NOZERO);
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[i] = imag ((*c0)[i]);
         return res;
       }
@@ -1268,7 +1268,7 @@ namespace lib {
       {
         DComplexGDL* c0 = static_cast<DComplexGDL*> (p0);
         DFloatGDL* res = new DFloatGDL (c0->Dim (), BaseGDL::NOZERO);
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[i] = real ((*c0)[i]);
         return res;
       }
@@ -1276,7 +1276,7 @@ namespace lib {
       {
         DComplexDblGDL* c0 = static_cast<DComplexDblGDL*> (p0);
         DDoubleGDL* res = new DDoubleGDL (c0->Dim (), BaseGDL::NOZERO);
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_ARITH && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
         for (SizeT i = 0; i < nEl; ++i) (*res)[i] = real ((*c0)[i]);
         return res;
       }
@@ -1400,15 +1400,15 @@ namespace lib {
         }
         switch (cas) {
         case 0:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0D)[i], (*p1D)[i]);
           return res;
         case 1:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0D)[i], (*p1D)[0]);
           return res;
         case 2:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0D)[0], (*p1D)[i]);
           return res;
         }
@@ -1432,15 +1432,15 @@ namespace lib {
         }
         switch (cas) {
         case 0:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0F)[i], (*p1F)[i]);
           return res;
         case 1:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0F)[i], (*p1F)[0]);
           return res;
         case 2:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0F)[0], (*p1F)[i]);
           return res;
         }
@@ -1464,15 +1464,15 @@ namespace lib {
         }
         switch (cas) {
         case 0:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atanC((*p0C)[i], (*p1C)[i]);
           return res;
         case 1:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atanC((*p0C)[i], (*p1C)[0]);
           return res;
         case 2:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atanC((*p0C)[0], (*p1C)[i]);
           return res;
         }
@@ -1496,15 +1496,15 @@ namespace lib {
         }
         switch (cas) {
         case 0:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atanC((*p0DC)[i], (*p1DC)[i]);
           return res;
         case 1:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atanC((*p0DC)[i], (*p1DC)[0]);
           return res;
         case 2:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atanC((*p0DC)[0], (*p1DC)[i]);
           return res;
         }
@@ -1520,15 +1520,15 @@ namespace lib {
         }
         switch (cas) {
         case 0:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0D)[i], (*p1D)[i]);
           return res;
         case 1:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0D)[i], (*p1D)[0]);
           return res;
         case 2:
-#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
+#pragma omp parallel for if (nElMin >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nElMin))
           for (SizeT i = 0; i < nElMin; ++i) (*res)[i] = atan2((*p0D)[0], (*p1D)[i]);
           return res;
         }
@@ -1543,7 +1543,7 @@ namespace lib {
             (*res)[ 0] = atan2(((*p0C)[ 0]).imag(), ((*p0C)[ 0]).real());
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
           for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = atan2(((*p0C)[i]).imag(), ((*p0C)[i]).real());
           return res;
         } else if (p0->Type() == GDL_COMPLEXDBL) {
@@ -1553,7 +1553,7 @@ namespace lib {
             (*res)[ 0] = atan2(((*p0C)[ 0]).imag(), ((*p0C)[ 0]).real());
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
           for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = atan2(((*p0C)[i]).imag(), ((*p0C)[i]).real());
           return res;
         }
@@ -1565,7 +1565,7 @@ namespace lib {
             (*res)[ 0] = atan((*p0D)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
           for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = atan((*p0D)[i]);
           return res;
         } else if (p0->Type() == GDL_FLOAT) {
@@ -1575,7 +1575,7 @@ namespace lib {
             (*res)[ 0] = atan((*p0F)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
           for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = atan((*p0F)[i]);
           return res;
         } else if (p0->Type() == GDL_COMPLEX) {
@@ -1585,7 +1585,7 @@ namespace lib {
             (*res)[ 0] = std::atan((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
           for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = std::atan((*p0C)[ i]);
           return res;
         } else if (p0->Type() == GDL_COMPLEXDBL) {
@@ -1595,7 +1595,7 @@ namespace lib {
             (*res)[ 0] = std::atan((*p0C)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
           for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = std::atan((*p0C)[ i]);
           return res;
         } else {
@@ -1604,7 +1604,7 @@ namespace lib {
             (*res)[ 0] = atan((*res)[ 0]);
             return res;
           }
-#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+#pragma omp parallel for if (nEl >= CpuTPOOL_MIN_ELTS_TRANSC && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
           for (SizeT i = 0; i < nEl; ++i) (*res)[ i] = atan((*res)[i]);
           return res;
         }
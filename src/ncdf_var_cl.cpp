@@ -91,6 +91,91 @@ namespace lib {
   }
   
 
+  // one nc_get_vara_* (unit strides) or nc_get_vars_* call: the library
+  // reads (and converts) whole runs, not element by element
+  template <typename NcT>
+  int ncdf_get_values(int cdfid, int varid, const size_t* off, const size_t* cou,
+                      const ptrdiff_t* stri, bool strided, NcT* data,
+                      int (*get_vara)(int, int, const size_t*, const size_t*, NcT*),
+                      int (*get_vars)(int, int, const size_t*, const size_t*,
+                                      const ptrdiff_t*, NcT*))
+  {
+    if (strided) return get_vars(cdfid, varid, off, cou, stri, data);
+    return get_vara(cdfid, varid, off, cou, data);
+  }
+
+  template <typename NcT>
+  int ncdf_put_values(int cdfid, int varid, const size_t* off, const size_t* cou,
+                      const ptrdiff_t* stri, bool strided, const NcT* data,
+                      int (*put_vara)(int, int, const size_t*, const size_t*, const NcT*),
+                      int (*put_vars)(int, int, const size_t*, const size_t*,
+                                      const ptrdiff_t*, const NcT*))
+  {
+    if (strided) return put_vars(cdfid, varid, off, cou, stri, data);
+    return put_vara(cdfid, varid, off, cou, data);
+  }
+
+  // NCDF_VARGET: the selection is read into the buffer of the new result
+  template <typename T, typename NcT>
+  void ncdf_varget_values(EnvT* e, int cdfid, int varid, const size_t* off,
+                          const size_t* cou, const ptrdiff_t* stri, bool strided,
+                          const dimension& dim,
+                          int (*get_vara)(int, int, const size_t*, const size_t*, NcT*),
+                          int (*get_vars)(int, int, const size_t*, const size_t*,
+                                          const ptrdiff_t*, NcT*))
+  {
+    T* temp = new T(dim, BaseGDL::NOZERO);
+    int status = ncdf_get_values(cdfid, varid, off, cou, stri, strided,
+                                 reinterpret_cast<NcT*>(temp->DataAddr()),
+                                 get_vara, get_vars);
+    ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
+    GDLDelete(e->GetParGlobal(2));
+    e->GetParGlobal(2) = temp;
+  }
+
+  // CHUNK_CACHE_NSLOTS, CHUNK_CACHE_SIZE (bytes), CHUNK_CACHE_W0 (preemption,
+  // 0 to 1) of NCDF_VARGET and NCDF_VARPUT (keywords 3 to 5, GDL extension):
+  // the chunk cache of a netCDF-4 variable, kept while the file is open.
+  // Ignored for netCDF-3 files (not chunked).
+  void ncdf_var_chunk_cache(EnvT* e, int cdfid, int varid, const char* function)
+  {
+    const int nslotsIx = 3, sizeIx = 4, w0Ix = 5;
+    if (!e->KeywordPresent(nslotsIx) && !e->KeywordPresent(sizeIx) &&
+        !e->KeywordPresent(w0Ix)) return;
+#ifdef USE_NETCDF4
+    size_t size, nelems;
+    float preemption;
+    int status = nc_get_var_chunk_cache(cdfid, varid, &size, &nelems, &preemption);
+    if (status == NC_ENOTNC4) return;
+    ncdf_handle_error(e, status, function);
+    if (e->KeywordPresent(sizeIx))
+    {
+      DLong64 val;
+      e->AssureLongScalarKW(sizeIx, val);
+      if (val < 0) e->Throw("CHUNK_CACHE_SIZE must not be negative.");
+      size = val;
+    }
+    if (e->KeywordPresent(nslotsIx))
+    {
+      DLong64 val;
+      e->AssureLongScalarKW(nslotsIx, val);
+      if (val <= 0) e->Throw("CHUNK_CACHE_NSLOTS must be positive.");
+      nelems = val;
+    }
+    if (e->KeywordPresent(w0Ix))
+    {
+      DDouble val;
+      e->AssureDoubleScalarKW(w0Ix, val);
+      if (!(val >= 0 && val <= 1)) e->Throw("CHUNK_CACHE_W0 must be in [0,1].");
+      preemption = val;
+    }
+    status = nc_set_var_chunk_cache(cdfid, varid, size, nelems, preemption);
+    ncdf_handle_error(e, status, function);
+#else
+    e->Throw("GDL was compiled without support to new NetCDF-4 format(s)");
+#endif
+  }
+
   BaseGDL* ncdf_varinq(EnvT* e)
   {
 //    size_t nParam=e->NParam(2);
@@ -379,6 +464,8 @@ else if(var_type == NC_LONG)
     status = nc_inq_var(cdfid, varid, var_name, &var_type, &var_ndims, var_dims, &var_natts);
     ncdf_handle_error(e, status, "NCDF_VARGET");
 
+    ncdf_var_chunk_cache(e, cdfid, varid, "NCDF_VARGET");
+
     //get the dimension lengths
     if (var_ndims == 0) trans[0] = 0;
     else for (int i=0; i < var_ndims; ++i)
@@ -405,7 +492,7 @@ else if(var_type == NC_LONG)
       subcase 3: All keywords are DEFINED
       subcase 4(==case 3): STRIDE is undefined (1,1,1,1)...
 
-    case 1 we can do seperately, the rest can be handled generically, 
+    all of them are handled generically (case 1: the whole variable),
       filling in COUNT, OFFSET and STRIDE as needed.
 
     */
@@ -414,82 +501,21 @@ else if(var_type == NC_LONG)
     //COUNT  = 1
     //STRIDE = 2
 
-    if (e->GetKW(0) == NULL && e->GetKW(1) == NULL && e->GetKW(2) == NULL)
-    {  
-      //get all the data
-
-      size_t array_size = 1;
-      for (int i = 0; i < var_ndims; ++i) array_size = array_size * dim_length[i];
+    // one read of the selection (OFFSET, COUNT, STRIDE) straight into
+    // the result (no keywords: all the data)
+    size_t off[NC_MAX_VAR_DIMS], cou[NC_MAX_VAR_DIMS];
+    ptrdiff_t stri[NC_MAX_VAR_DIMS];
+    for (int i = 0; i < NC_MAX_VAR_DIMS; ++i)
+    {
+      off[i]=0;
+      cou[i]=1;
+      stri[i]=1;
+    }
+    for (int i = 0; i < var_ndims; ++i) cou[i] = dim_length[i];
 
-      dimension dim(transposed_dim_length, (SizeT) var_ndims);
-      if (var_type == NC_DOUBLE)
-      {
-        DDoubleGDL *temp = new DDoubleGDL(dim,BaseGDL::NOZERO);
-        status=nc_get_var_double(cdfid, varid, &(*temp)[0]);
-        ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-        GDLDelete(e->GetParGlobal(2));
-        e->GetParGlobal(2)=temp;      	
-      } 
-      else if (var_type == NC_FLOAT)
-      {
-        DFloatGDL *temp = new DFloatGDL(dim, BaseGDL::NOZERO);
-        status = nc_get_var_float(cdfid, varid, &(*temp)[0]);
-        ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-        GDLDelete(e->GetParGlobal(2));
-        e->GetParGlobal(2)=temp;
-      } 
-      else if (var_type == NC_SHORT)
-      {
-        DIntGDL * temp=new DIntGDL(dim,BaseGDL::NOZERO);
-        status=nc_get_var_short(cdfid, varid,&(*temp)[0]);
-        ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-        GDLDelete(e->GetParGlobal(2));
-        e->GetParGlobal(2)=temp;      	
-      } 
-      else if (var_type == NC_INT)
-      {
-        DLongGDL* temp=new DLongGDL(dim,BaseGDL::NOZERO);
-        status=nc_get_var_int(cdfid, varid,&(*temp)[0]);
-        ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-        GDLDelete(e->GetParGlobal(2));
-        e->GetParGlobal(2)=temp;      	
-      } 
-      else if (var_type == NC_BYTE)
-      {
-        DByteGDL* temp=new DByteGDL(dim,BaseGDL::NOZERO);
-        status=nc_get_var_uchar(cdfid, varid, &(*temp)[0]);
-	if (status != NC_ERANGE) {
-	  ncdf_var_handle_error(e,status,"NCDF_VARGET (ici)", temp);
-	} else {
-	  Warning("Warning in NCDF_VARGET: NC_ERANGE during BYTE reading");
-	  ncdf_var_handle_error(e,status,"NCDF_VARGET (ici)", temp);
-	}
-	GDLDelete(e->GetParGlobal(2));  
-        e->GetParGlobal(2)=temp;      	
-      } 
-      else if (var_type == NC_CHAR)
-      {
-        DByteGDL* temp = new DByteGDL(dim, BaseGDL::NOZERO);
-        status = nc_get_var_text(cdfid, varid, (char*) &(*temp)[0]);
-        ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-        GDLDelete(e->GetParGlobal(2));
-        e->GetParGlobal(2) = temp;
-      }
-      //done read all.
-    } 
-    else  
+    if (e->GetKW(0) != NULL || e->GetKW(1) != NULL || e->GetKW(2) != NULL)
     {
       //OFFSET AND/OR COUNT and NOT/ STRIDE
-//      BaseGDL *offset,*count;
-      size_t off[NC_MAX_VAR_DIMS], cou[NC_MAX_VAR_DIMS];
-      for (int i = 0; i < NC_MAX_VAR_DIMS; ++i)
-      {
-        off[i]=0;
-        cou[i]=1;
-      }
-      size_t array_size = 1;
-      for (int i = 0; i < var_ndims; ++i) off[i] = 0;
-
       if (e->GetKW(1) !=NULL)
       {
         DLongGDL *o=e->GetKWAs<DLongGDL>(1);
@@ -539,99 +565,36 @@ else if(var_type == NC_LONG)
         }
       }
 	    
-      if (e->GetKW(2) == NULL)
-      {
-        //NO STRIDE
-        array_size = 1;
-        for (int i = 0; i < var_ndims; ++i) 
-        {
-          transposed_dim_length[trans[i]] = cou[i];
-          array_size = array_size * cou[i];
-        }
-        dimension dim(transposed_dim_length, (SizeT) var_ndims);
-        if (var_type == NC_DOUBLE)
-        {
-          DDoubleGDL *temp = new DDoubleGDL(dim, BaseGDL::NOZERO);
-          status=nc_get_vara_double(cdfid, varid, off, cou, &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;      	
-        }
-        else if (var_type == NC_FLOAT)
-        {
-          DFloatGDL *temp = new DFloatGDL(dim, BaseGDL::NOZERO);
-          status = nc_get_vara_float(cdfid, varid, off,cou,&(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;
-        }
-        else if (var_type == NC_SHORT)
-        {
-          DIntGDL *temp = new DIntGDL(dim, BaseGDL::NOZERO);
-          status = nc_get_vara_short(cdfid, varid, off, cou, &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;      	
-        }
-        else if(var_type == NC_INT)
-        {
-          DLongGDL *temp = new DLongGDL(dim,BaseGDL::NOZERO);
-          status = nc_get_vara_int(cdfid, varid, off, cou, &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;    
-        }
-        else if (var_type == NC_BYTE)
-        {
-          DByteGDL *temp=new DByteGDL(dim,BaseGDL::NOZERO);
-          status = nc_get_vara_uchar(cdfid, varid, off, cou, &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;      	
-        }
-        else if (var_type == NC_CHAR)
-        {
-          DByteGDL *temp = new DByteGDL(dim, BaseGDL::NOZERO);
-          status = nc_get_vara_text(cdfid, varid, off, cou, (char*) &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;
-        }
-      } 
-      else 
+      if (e->GetKW(2) != NULL)
       {
         //STRIDE
-        ptrdiff_t stri[NC_MAX_VAR_DIMS];
-//        BaseGDL * stride;
         DIntGDL *s=e->GetKWAs<DIntGDL>(2);
-        for (int i = 0; i < var_ndims; ++i) stri[i]=1;
         int nstri=s->N_Elements();
         for (int i = 0; i < nstri; ++i) 
         {
-          if ((*s)[i]*cou[trans[i]] < dim_length[trans[i]]-off[trans[i]]+1)
-          {
-            //stride * count < length-offset
-            stri[trans[i]]=(*s)[i];
-          }
-          else if ((*s)[i] <= 0)
+          if ((*s)[i] <= 0)
           {
             //	stride<0, stop it now.
             stri[trans[i]]=1;
             e->Throw("STRIDE array cannot have negative elements"
               +e->GetParString(0));
           }
+          else if ((*s)[i]*(cou[trans[i]]-1) < dim_length[trans[i]]-off[trans[i]])
+          {
+            //stride * (count-1) < length-offset
+            stri[trans[i]]=(*s)[i];
+          }
           else
           {
-            //cou*stride> length-offset
+            //last element beyond length-offset
             //reduce count
             stri[trans[i]]=(*s)[i];
-            cou[trans[i]]=(dim_length[trans[i]]-off[trans[i]])/
-            stri[trans[i]];
+            cou[trans[i]]=(dim_length[trans[i]]-off[trans[i]]-1)/
+            stri[trans[i]]+1;
 
             //silent if there is no COUNT keyword
             if(e->GetKW(0) !=NULL)
             {
-//              int mema=3;
               string mess;
               mess = "NCDF_VARGET: Requested read is larget than data in dimension ";
               mess+=i2s(i);
@@ -642,66 +605,68 @@ else if(var_type == NC_LONG)
             }	
           }
         }
-
-        //now we can get the damn data
-        array_size=1;
-        for (int i = 0; i < var_ndims; ++i) 
-        {
-          transposed_dim_length[trans[i]]=cou[i];
-          array_size=array_size*cou[i];
-        }
-        dimension dim(transposed_dim_length, (SizeT) var_ndims);
-	    	  
-        if (var_type == NC_DOUBLE)
-        {
-          DDoubleGDL *temp = new DDoubleGDL(dim, BaseGDL::NOZERO);
-          status=nc_get_vars_double(cdfid, varid, off, cou, stri, &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp; 
-        }
-        else if(var_type == NC_FLOAT)
-        {
-          DFloatGDL *temp = new DFloatGDL(dim,BaseGDL::NOZERO);
-          status = nc_get_vars_float(cdfid, varid, off, cou, stri, &(*temp)[0]);
-          ncdf_var_handle_error(e,status,"NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp; 
-        }
-        else if (var_type == NC_SHORT)
-        {
-          DIntGDL *temp = new DIntGDL(dim, BaseGDL::NOZERO);
-          status = nc_get_vars_short(cdfid, varid, off, cou, stri, &(*temp)[0]);
-          ncdf_var_handle_error(e,status,"NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;      	
-        }
-        else if(var_type == NC_INT)
-        {
-          DLongGDL *temp = new DLongGDL(dim, BaseGDL::NOZERO);
-          status = nc_get_vars_int(cdfid, varid, off,cou, stri, &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;  
-        }
-        else if(var_type == NC_BYTE)
-        {
-          DByteGDL *temp=new DByteGDL(dim, BaseGDL::NOZERO);
-          status = nc_get_vars_uchar(cdfid, varid, off, cou, stri, &(*temp)[0]);
-          ncdf_var_handle_error(e,status,"NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;      	
-        }
-        else if (var_type == NC_CHAR)
-        {
-          DByteGDL *temp = new DByteGDL(dim, BaseGDL::NOZERO);
-          status = nc_get_vars_text(cdfid, varid, off, cou, stri, (char*) &(*temp)[0]);
-          ncdf_var_handle_error(e, status, "NCDF_VARGET", temp);
-          GDLDelete(e->GetParGlobal(2));
-          e->GetParGlobal(2) = temp;      	
-        }
       }
     }
+
+    bool strided = false;
+    for (int i = 0; i < var_ndims; ++i)
+    {
+      transposed_dim_length[trans[i]] = cou[i];
+      if (stri[i] != 1) strided = true;
+    }
+    dimension dim(transposed_dim_length, (SizeT) var_ndims);
+
+    switch (var_type)
+    {
+      case NC_DOUBLE:
+        ncdf_varget_values<DDoubleGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                       nc_get_vara_double, nc_get_vars_double);
+        break;
+      case NC_FLOAT:
+        ncdf_varget_values<DFloatGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                      nc_get_vara_float, nc_get_vars_float);
+        break;
+      case NC_SHORT:
+        ncdf_varget_values<DIntGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                    nc_get_vara_short, nc_get_vars_short);
+        break;
+      case NC_INT:
+        ncdf_varget_values<DLongGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                     nc_get_vara_int, nc_get_vars_int);
+        break;
+      case NC_BYTE:
+        ncdf_varget_values<DByteGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                     nc_get_vara_uchar, nc_get_vars_uchar);
+        break;
+      case NC_CHAR:
+        ncdf_varget_values<DByteGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                     nc_get_vara_text, nc_get_vars_text);
+        break;
+#ifdef USE_NETCDF4
+      case NC_UBYTE:
+        ncdf_varget_values<DByteGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                     nc_get_vara_uchar, nc_get_vars_uchar);
+        break;
+      case NC_USHORT:
+        ncdf_varget_values<DUIntGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                     nc_get_vara_ushort, nc_get_vars_ushort);
+        break;
+      case NC_UINT:
+        ncdf_varget_values<DULongGDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                      nc_get_vara_uint, nc_get_vars_uint);
+        break;
+      case NC_INT64:
+        ncdf_varget_values<DLong64GDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                       nc_get_vara_longlong, nc_get_vars_longlong);
+        break;
+      case NC_UINT64:
+        ncdf_varget_values<DULong64GDL>(e, cdfid, varid, off, cou, stri, strided, dim,
+                                        nc_get_vara_ulonglong, nc_get_vars_ulonglong);
+        break;
+#endif
+      default:
+        e->Throw("Unsupported variable type: " + i2s(var_type));
+    }
   }
 
 
@@ -851,6 +816,9 @@ else if(var_type == NC_LONG)
     int var_ndims;
     status = nc_inq_var(cdfid, varid, var_name, &var_type, 
       (int *) &var_ndims, var_dims, &var_natts);
+    ncdf_handle_error(e, status, "NCDF_VARPUT");
+
+    ncdf_var_chunk_cache(e, cdfid, varid, "NCDF_VARPUT");
 
     //get the value
     v = e->GetParDefined(2);
@@ -970,37 +938,60 @@ else if(var_type == NC_LONG)
       }
     }
 
-    // TODO netCDF-4 has new data types
+    bool strided = false;
+    for (int i = 0; i < var_ndims; ++i) if (stride[i] != 1) strided = true;
+
+    // one call writing directly from the value
     switch (v->Type()) 
     { 
       // using netCDF API functions data type convertion
       case GDL_DOUBLE : 
-        status = nc_put_vars_double(cdfid, varid, offset, count, stride, 
-          &((*static_cast<DDoubleGDL*>(v))[0]));
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DDoubleGDL*>(v))[0]), nc_put_vara_double, nc_put_vars_double);
         break;
       case GDL_FLOAT :
-        status = nc_put_vars_float(cdfid, varid, offset, count, stride, 
-          &((*static_cast<DFloatGDL*>(v))[0]));
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DFloatGDL*>(v))[0]), nc_put_vara_float, nc_put_vars_float);
         break;
       case GDL_INT : 
-        status = nc_put_vars_short(cdfid, varid, offset, count, stride, 
-          &((*static_cast<DIntGDL*>(v))[0]));
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DIntGDL*>(v))[0]), nc_put_vara_short, nc_put_vars_short);
         break;
       case GDL_LONG :
-        status = nc_put_vars_int(cdfid, varid, offset, count, stride, 
-          &((*static_cast<DLongGDL*>(v))[0]));
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DLongGDL*>(v))[0]), nc_put_vara_int, nc_put_vars_int);
         break;
       case GDL_BYTE :
-        status = nc_put_vars_uchar(cdfid, varid, offset, count, stride,
-          &((*static_cast<DByteGDL*>(v))[0]));
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DByteGDL*>(v))[0]), nc_put_vara_uchar, nc_put_vars_uchar);
         break;
+#ifdef USE_NETCDF4
+      case GDL_UINT :
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DUIntGDL*>(v))[0]), nc_put_vara_ushort, nc_put_vars_ushort);
+        break;
+      case GDL_ULONG :
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DULongGDL*>(v))[0]), nc_put_vara_uint, nc_put_vars_uint);
+        break;
+      case GDL_LONG64 :
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DLong64GDL*>(v))[0]), nc_put_vara_longlong, nc_put_vars_longlong);
+        break;
+      case GDL_ULONG64 :
+        status = ncdf_put_values(cdfid, varid, offset, count, stride, strided,
+          &((*static_cast<DULong64GDL*>(v))[0]), nc_put_vara_ulonglong, nc_put_vars_ulonglong);
+        break;
+#endif
       // initially using GDL methods for data type convertion
       case GDL_COMPLEXDBL : 
       case GDL_COMPLEX :
+#ifndef USE_NETCDF4
       case GDL_UINT :
       case GDL_ULONG :
       case GDL_LONG64:
       case GDL_ULONG64 :
+#endif
       {
         BaseGDL* val;
         Guard<BaseGDL> val_guard;
@@ -357,7 +357,7 @@ ProgNodeP ProgNode::NewProgNode( const RefDNode& refNode)
 
       if( newNode != NULL)
 	{
-	  if( !newNode->ConstantExpr()) return newNode;
+	  if( !newNode->ConstantExpr()) return FusedExpr::Wrap( newNode);
 
 	  Guard<ProgNode> guard( newNode);
 
@@ -371,7 +371,7 @@ ProgNodeP ProgNode::NewProgNode( const RefDNode& refNode)
 	}
       else if( newUnary != NULL)
 	{
-	  if( !newUnary->ConstantExpr()) return newUnary;
+	  if( !newUnary->ConstantExpr()) return FusedExpr::Wrap( newUnary);
 
 	  Guard<ProgNode> guard( newUnary);
 
@@ -538,7 +538,7 @@ ProgNodeP ProgNode::NewProgNode( const RefDNode& refNode)
 	}
       if( newNode != NULL)
 	{
-	  if( !newNode->ConstantExpr()) return newNode;
+	  if( !newNode->ConstantExpr()) return FusedExpr::Wrap( newNode);
 
 	  Guard<ProgNode> guard( newNode);
 
@@ -552,7 +552,7 @@ ProgNodeP ProgNode::NewProgNode( const RefDNode& refNode)
 	}
       else if( newUnary != NULL)
 	{
-	  if( !newUnary->ConstantExpr()) return newUnary;
+	  if( !newUnary->ConstantExpr()) return FusedExpr::Wrap( newUnary);
 
 	  Guard<ProgNode> guard( newUnary);
 
@@ -596,7 +596,7 @@ ProgNodeP ProgNode::NewProgNode( const RefDNode& refNode)
 	ProgNodeP c = new FCALL_LIB_DIRECTNode( refNode);
 
 	if( !static_cast<DLibFunDirect*>(c->libFun)->RetConstant()
-	    || !ConstantPar( c->getFirstChild())) return c;
+	    || !ConstantPar( c->getFirstChild())) return FusedExpr::Wrap( c);
 
 	Guard< ProgNode> guard( c);
 
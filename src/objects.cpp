@@ -19,6 +19,9 @@
 
 #include <limits>
 #include <ios>
+#include <unordered_map>
+#include <vector>
+#include <cmath>
 
 #include "str.hpp"
 #include "gdlexception.hpp"
@@ -27,6 +30,7 @@
 
 #include "objects.hpp"
 #include "graphicsdevice.hpp"
+#include "astcache.hpp"
 #include "overload.hpp"
 
 //#include "dinterpreter.hpp"
@@ -92,6 +96,92 @@ DLong CpuTPOOL_NTHREADS;
 DLong64 CpuTPOOL_MIN_ELTS;
 DLong64 CpuTPOOL_MAX_ELTS;
 //const DULong64 CpuTPOOL_MAX_ELTS_max = numeric_limits<DLong64>::max();
+DLong64 CpuTPOOL_MIN_ELTS_ARITH;
+DLong64 CpuTPOOL_MIN_ELTS_TRANSC;
+// threading a memory bound loop pays off only for large arrays, while
+// a loop calling exp() or pow() is worth splitting much earlier
+DLong64 DefaultTPOOL_MIN_ELTS_ARITH = 1000000;
+DLong64 DefaultTPOOL_MIN_ELTS_TRANSC = 10000;
+
+#ifdef _OPENMP
+namespace {
+
+  // best of a few runs [s]
+  template< typename Kernel>
+  double TimeKernel( Kernel& kernel, OMPInt n, bool parallel)
+  {
+    double best = numeric_limits<double>::max();
+    for( int rep = 0; rep < 5; ++rep)
+      {
+	double t0 = omp_get_wtime();
+	kernel( n, parallel);
+	double t = omp_get_wtime() - t0;
+	if( t < best) best = t;
+      }
+    return best;
+  }
+
+  // smallest size from which on the threaded kernel is clearly faster
+  // (for two consecutive sizes, to filter out noise)
+  template< typename Kernel>
+  DLong64 CrossOver( Kernel& kernel, OMPInt maxN)
+  {
+    bool lastFaster = false;
+    DLong64 candidate = 0;
+    for( OMPInt n = 1024; n <= maxN; n *= 2)
+      {
+	bool faster = TimeKernel( kernel, n, true) < 0.8 * TimeKernel( kernel, n, false);
+	if( faster && lastFaster) return candidate;
+	if( faster) candidate = n;
+	lastFaster = faster;
+      }
+    // never (or only at the largest size) faster within the tested range
+    return lastFaster ? candidate : 2 * maxN;
+  }
+
+  struct AddKernel
+  {
+    std::vector<float> a, b, c;
+    AddKernel( OMPInt n): a( n, 1.0f), b( n, 2.0f), c( n) {}
+    void operator()( OMPInt n, bool parallel)
+    {
+#pragma omp parallel for if (parallel)
+      for( OMPInt i = 0; i < n; ++i)
+	c[ i] = a[ i] + b[ i];
+    }
+  };
+
+  struct ExpKernel
+  {
+    std::vector<float> a, c;
+    ExpKernel( OMPInt n): a( n, 0.5f), c( n) {}
+    void operator()( OMPInt n, bool parallel)
+    {
+#pragma omp parallel for if (parallel)
+      for( OMPInt i = 0; i < n; ++i)
+	c[ i] = exp( a[ i]);
+    }
+  };
+
+} // namespace
+#endif
+
+void CalibrateTPoolThresholds()
+{
+#ifdef _OPENMP
+  if( CpuTPOOL_NTHREADS > 1)
+    {
+      const OMPInt maxArith = 1 << 22;
+      const OMPInt maxTransc = 1 << 20;
+      AddKernel add( maxArith);
+      DefaultTPOOL_MIN_ELTS_ARITH = CrossOver( add, maxArith);
+      ExpKernel ex( maxTransc);
+      DefaultTPOOL_MIN_ELTS_TRANSC = CrossOver( ex, maxTransc);
+    }
+#endif
+  CpuTPOOL_MIN_ELTS_ARITH = DefaultTPOOL_MIN_ELTS_ARITH;
+  CpuTPOOL_MIN_ELTS_TRANSC = DefaultTPOOL_MIN_ELTS_TRANSC;
+}
 
 // instantiate own AST factory
 //_DNodeFactory DNodeFactory;
@@ -128,6 +218,7 @@ void ResetObjects()
 //   sysVarRdOnlyList.clear(); // data is owned by sysVarList
   PurgeContainer(funList);
   PurgeContainer(proList);
+  InvalidateRoutineIndex();
 
   // delete common block data (which might be of type STRUCT)
   CommonListT::iterator i;
@@ -918,66 +1009,110 @@ DLong GetLUN()
 bool IsRelaxed(){return !strictInterpreter;}
 void SetStrict(bool value){strictInterpreter=value;}
 
-// for semantic predicate
-bool IsFun(antlr::RefToken rT1)
+// hashed name -> index lookup into the routine lists
+// the vectors themselves are left untouched (the call nodes store indices
+// into them), the maps only replace the linear search over the names.
+// Appended routines are picked up incrementally on the next lookup,
+// anything else (purge, erase, sort) must call InvalidateRoutineIndex().
+namespace {
+  template< typename ListT> class RoutineIndex
+  {
+    typedef std::unordered_map<std::string, int> MapT;
+    MapT  ix;
+    SizeT nIndexed; // number of list entries already in ix
+
+  public:
+    RoutineIndex(): nIndexed( 0) {}
+
+    void Invalidate()
+    {
+      ix.clear();
+      nIndexed = 0;
+    }
+
+    int Find( const ListT& list, const std::string& n)
+    {
+      if( nIndexed > list.size()) Invalidate();
+      // first entry wins (as for the former linear search)
+      for( ; nIndexed < list.size(); ++nIndexed)
+	ix.insert( std::make_pair( list[ nIndexed]->Name(), static_cast<int>(nIndexed)));
+
+      typename MapT::const_iterator it = ix.find( n);
+      if( it == ix.end()) return -1;
+
+      int i = it->second;
+      if( list[ i]->Name() == n) return i;
+
+      // list was reordered without notice: rebuild
+      Invalidate();
+      return Find( list, n);
+    }
+  };
+
+  RoutineIndex<ProListT>    proIndex;
+  RoutineIndex<FunListT>    funIndex;
+  RoutineIndex<LibProListT> libProIndex;
+  RoutineIndex<LibFunListT> libFunIndex;
+}
+
+void InvalidateRoutineIndex()
 {
-  antlr::Token& T1=*rT1;
+  proIndex.Invalidate();
+  funIndex.Invalidate();
+  libProIndex.Invalidate();
+  libFunIndex.Invalidate();
+}
 
-  // search for T1.getText() in function table and path
-  string searchName=StrUpCase(T1.getText());
+void InvalidateLibFunIndex()
+{
+  libFunIndex.Invalidate();
+}
 
+bool IsFun(const string& searchName)
+{
 //  cout << "IsFun: Searching for: " << searchName << endl;
 
 // Speeds up the process of finding (in gdlc.g) if a syntax like foo(bar) is a call to the function 'foo'
 // or the 'bar' element of array 'foo'.
-  LibFunListT::iterator p=find_if(libFunList.begin(),libFunList.end(),
-			       Is_eq<DLibFun>(searchName));
-  if( p != libFunList.end()) if( *p != NULL) return true;
-
-  FunListT::iterator q=find_if(funList.begin(),funList.end(),
-			       Is_eq<DFun>(searchName));
-  if( q != funList.end()) if( *q != NULL) return true;
+  if( LibFunIx( searchName) != -1) return true;
+  if( FunIx( searchName) != -1) return true;
 
   //  cout << "Not found: " << searchName << endl;
 
   return false;
 }
 
+// for semantic predicate
+bool IsFun(antlr::RefToken rT1)
+{
+  antlr::Token& T1=*rT1;
+
+  // search for T1.getText() in function table and path
+  string searchName=StrUpCase(T1.getText());
+
+  bool isFun = IsFun( searchName);
+  ASTCache::NoteIsFun( searchName, isFun); // the parser output depends on it
+  return isFun;
+}
+
 int ProIx(const string& n)
 {
-SizeT nF=proList.size();
-for( SizeT i=0; i<nF; i++) if( Is_eq<DPro>(n)(proList[i])) 
-  return (int)i;
-return -1;
+  return proIndex.Find( proList, n);
 }
 
 int FunIx(const string& n)
 {
-SizeT nF=funList.size();
-for( SizeT i=0; i<nF; i++) if( Is_eq<DFun>(n)(funList[i]))
-  return (int)i;
-return -1;
+  return funIndex.Find( funList, n);
 }
 
 int LibProIx(const string& n)
 {
-  SizeT nF=libProList.size();
-  for( SizeT i=0; i<nF; i++) 
-    {
-      if( Is_eq<DLibPro>(n)(libProList[i])) return (int)i;
-    }
-  return -1;
+  return libProIndex.Find( libProList, n);
 }
 
 int LibFunIx(const string& n)
 {
-  SizeT nF=libFunList.size();
-  
-  for( SizeT i=0; i<nF; i++) 
-    {
-      if( Is_eq<DLibFun>(n)(libFunList[i])) return (int)i;
-    }
-  return -1;
+  return libFunIndex.Find( libFunList, n);
 }
 
 // returns the endian of the current machine
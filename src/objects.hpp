@@ -18,8 +18,10 @@
 #ifndef OBJECTS_HPP_
 #define OBJECTS_HPP_
 
-//#include<deque>
+#include<deque>
 #include<string>
+#include<vector>
+#include<algorithm>
 
 #include "datatypes.hpp"
 
@@ -57,9 +59,20 @@ extern GDLFileListT  fileUnits;
 // for OpenMP
 const SizeT DefaultTPOOL_MIN_ELTS = 100000;
 const SizeT DefaultTPOOL_MAX_ELTS = 0;
+// defaults for the per operation class thresholds, which can be tuned to
+// the host by CalibrateTPoolThresholds()
+extern DLong64 DefaultTPOOL_MIN_ELTS_ARITH;
+extern DLong64 DefaultTPOOL_MIN_ELTS_TRANSC;
 extern DLong CpuTPOOL_NTHREADS;
 extern DLong64 CpuTPOOL_MIN_ELTS;
 extern DLong64 CpuTPOOL_MAX_ELTS;
+extern DLong64 CpuTPOOL_MIN_ELTS_ARITH;
+extern DLong64 CpuTPOOL_MIN_ELTS_TRANSC;
+
+// times serial against parallel execution of a cheap (ADD) and an
+// expensive (EXP) kernel and sets the defaults above and the current
+// thresholds to the smallest size from which on threading pays off
+void CalibrateTPoolThresholds();
 
 //extern DeviceListT   deviceList;
 //extern Graphics*     actDevice;
@@ -108,7 +121,13 @@ int FunIx(const std::string& n);
 int LibProIx(const std::string& n);
 int LibFunIx(const std::string& n);
 
+// the above use hashed indices, which must be invalidated whenever
+// routines are removed from or reordered in the lists
+void InvalidateRoutineIndex();
+void InvalidateLibFunIndex(); // libFunList only
+
 bool IsFun(antlr::RefToken); // used by Lexer and Parser
+bool IsFun(const std::string& upName);
 bool IsRelaxed(); //tells if syntax is not strict (i.e. parenthesis for array indexes).
 void SetStrict(bool value);
 
@@ -173,6 +192,181 @@ template <typename T> class RefHeap {
     }
 };
 
+// the heap (and object heap) table of the interpreter
+// maps the (IDL visible) heap IDs to their RefHeap entries.
+// Entries live in a dense slab (freed slots are recycled, a deque as
+// references to the entries must stay valid while the heap grows), the IDs are
+// found through an open addressing (linear probing) hash index, hence
+// lookup, insertion and removal are O(1) without node allocation.
+// As IDs are never reused, the ID stored in the slot doubles as
+// generation check for a slot reached through the index.
+// Iteration is in slab order (use SortedIDs() where the order matters).
+template <typename T> class HeapTable {
+public:
+  struct Slot {
+    SizeT      first;  // heap ID, 0 for a free slot
+    RefHeap<T> second;
+    Slot(): first( 0), second() {}
+  };
+
+  // index based: stays valid when the table grows or shrinks meanwhile
+  class iterator {
+    HeapTable* t;
+    SizeT      ix;
+    friend class HeapTable;
+  public:
+    iterator( HeapTable* t_, SizeT ix_): t( t_), ix( ix_) {}
+    Slot& operator*() const { return t->slab[ ix];}
+    Slot* operator->() const { return &t->slab[ ix];}
+    iterator& operator++()
+    {
+      SizeT nSlab = t->slab.size();
+      for( ++ix; ix < nSlab && t->slab[ ix].first == 0; ++ix);
+      return *this;
+    }
+    bool operator==( const iterator& r) const
+    { return ix == r.ix || (ix >= t->slab.size() && r.ix >= t->slab.size());}
+    bool operator!=( const iterator& r) const { return !(*this == r);}
+  };
+
+private:
+  struct IndexEntry {
+    SizeT id; // 0 -> empty
+    SizeT slot;
+  };
+
+  std::deque<Slot>        slab;
+  std::vector<SizeT>      freeSlots;
+  std::vector<IndexEntry> index; // size is a power of 2 (or 0)
+  SizeT                   nLive;
+
+  SizeT Home( SizeT id) const
+  {
+    // Fibonacci hashing (IDs are mostly consecutive)
+    return (id * static_cast<SizeT>(11400714819323198485ULL)) & (index.size() - 1);
+  }
+
+  void Grow()
+  {
+    std::vector<IndexEntry> old;
+    old.swap( index);
+    IndexEntry empty = { 0, 0};
+    index.assign( old.empty() ? 1024 : 2 * old.size(), empty);
+    for( SizeT i = 0; i < old.size(); ++i)
+      if( old[ i].id != 0) Place( old[ i].id, old[ i].slot);
+  }
+
+  void Place( SizeT id, SizeT slot)
+  {
+    SizeT mask = index.size() - 1;
+    SizeT i = Home( id);
+    while( index[ i].id != 0) i = (i + 1) & mask;
+    index[ i].id = id;
+    index[ i].slot = slot;
+  }
+
+  // position in index, -1 if not found
+  long long FindIndex( SizeT id) const
+  {
+    if( id == 0 || nLive == 0) return -1;
+    SizeT mask = index.size() - 1;
+    for( SizeT i = Home( id); index[ i].id != 0; i = (i + 1) & mask)
+      if( index[ i].id == id) return i;
+    return -1;
+  }
+
+public:
+  HeapTable(): nLive( 0) {}
+
+  iterator begin()
+  {
+    iterator it( this, 0);
+    if( !slab.empty() && slab[ 0].first == 0) ++it;
+    return it;
+  }
+  iterator end() { return iterator( this, slab.size());}
+
+  SizeT size() const { return nLive;}
+
+  iterator find( SizeT id)
+  {
+    long long i = FindIndex( id);
+    if( i < 0) return end();
+    SizeT s = index[ i].slot;
+    assert( slab[ s].first == id);
+    return iterator( this, s);
+  }
+
+  void insert( SizeT id, T* var)
+  {
+    assert( id != 0 && FindIndex( id) < 0);
+    if( 2 * (nLive + 1) > index.size()) Grow();
+
+    SizeT s;
+    if( freeSlots.empty())
+      {
+	s = slab.size();
+	slab.push_back( Slot());
+      }
+    else
+      {
+	s = freeSlots.back();
+	freeSlots.pop_back();
+      }
+    slab[ s].first = id;
+    new (&slab[ s].second) RefHeap<T>( var); // RefHeap cannot be assigned
+    Place( id, s);
+    ++nLive;
+  }
+
+  void erase( SizeT id)
+  {
+    long long found = FindIndex( id);
+    if( found < 0) return;
+
+    SizeT s = index[ found].slot;
+    slab[ s].first = 0;
+    new (&slab[ s].second) RefHeap<T>();
+    freeSlots.push_back( s);
+    --nLive;
+
+    // backward shift deletion (no tombstones with linear probing)
+    SizeT mask = index.size() - 1;
+    SizeT hole = found;
+    for( SizeT i = (hole + 1) & mask; index[ i].id != 0; i = (i + 1) & mask)
+      {
+	SizeT home = Home( index[ i].id);
+	// can the entry at i move to the hole?
+	if( ((i - home) & mask) >= ((i - hole) & mask))
+	  {
+	    index[ hole] = index[ i];
+	    hole = i;
+	  }
+      }
+    index[ hole].id = 0;
+
+    if( nLive == 0) clear();
+  }
+
+  void clear()
+  {
+    slab.clear();
+    freeSlots.clear();
+    index.clear();
+    nLive = 0;
+  }
+
+  // all IDs in ascending order (as for the former std::map)
+  void SortedIDs( std::vector<SizeT>& ids)
+  {
+    ids.clear();
+    ids.reserve( nLive);
+    for( SizeT s = 0; s < slab.size(); ++s)
+      if( slab[ s].first != 0) ids.push_back( slab[ s].first);
+    std::sort( ids.begin(), ids.end());
+  }
+};
+
 namespace structDesc {
  
   // these are used mainly in list.cpp and hash.cpp
@@ -20,22 +20,26 @@
 #include "calendar.hpp"
 
 #include "ofmt.hpp"
+
+#include <limits>
+#include <type_traits>
+
 using namespace std;
 
 // for double -> string
 inline string double2string( DDouble d)      
 {
-  std::ostringstream os;
-  OutAuto( os, d, 16, 8, ' ');
-  return os.str();
+  std::string s;
+  AppendAuto( s, d, 16, 8, ' ');
+  return s;
 }
 
 // for float -> string
 inline string float2string( DFloat f)      
 {
-  std::ostringstream os;
-  OutAuto( os, f, 13, 6, ' ');
-  return os.str();
+  std::string s;
+  AppendAuto( s, f, 13, 6, ' ');
+  return s;
 }
 
 
@@ -97,43 +101,96 @@ std::string binstr( const Ty v, int w, int d, int code)
 #include "ofmt.hpp"
 
 template <typename T>
-void OutInteger(std::ostream& os, const T &val, const int w, const int d, int code, const BaseGDL::IOMode oMode) {
- std::ostringstream oss;
+void AppendInteger(std::string& out, const T &val, const int w, const int d, int code, const BaseGDL::IOMode oMode) {
+  std::string::size_type start = out.size();
+  if (oMode == BaseGDL::BIN) out += binstr(val, w, d, code);
+  else if (oMode == BaseGDL::DEC) {
+    // as ostream << showpos << val
+    if (val < 0) {
+      out += '-';
+      FmtDigits(out, 0ULL - static_cast<unsigned long long>(val), 10, false);
+    } else {
+      if ((code & fmtSHOWPOS) && std::numeric_limits<T>::is_signed) out += '+';
+      FmtDigits(out, static_cast<unsigned long long>(val), 10, false);
+    }
+  } else {
+    // as ostream << hex << val: no sign, the bits of T
+    typedef typename std::make_unsigned<T>::type UT;
+    FmtDigits(out, static_cast<UT>(val), (oMode == BaseGDL::OCT) ? 8 : 16, oMode == BaseGDL::HEX);
+  }
   if (d > 0) {
-   std::ostringstream ossI;
-   if (code & fmtSHOWPOS) ossI << std::showpos;
-   if (oMode == BaseGDL::DEC) ossI << val;
-   else if (oMode == BaseGDL::OCT) ossI << std::oct << val;
-   else if (oMode == BaseGDL::BIN) ossI << binstr(val, w, d, code);
-   else if (oMode == BaseGDL::HEX) ossI << std::uppercase << std::hex << val;
-   else ossI << std::nouppercase << std::hex << val; // HEXL
-   //force PADDING
-   code |= fmtPAD;
-   OutAdjustFill(oss, ossI.str(), d, code);
-   //remove PAD for next treatment ---> must be blanks
-   code &= (~fmtPAD);
- } else {
-  if (code & fmtSHOWPOS) oss << std::showpos;
-  if (d > 0) oss << std::setw(d) << std::setfill('0');
-  if (oMode == BaseGDL::DEC) oss << val;
-  else if (oMode == BaseGDL::OCT) oss << std::oct << val;
-  else if (oMode == BaseGDL::BIN) oss << binstr(val, w, d, code);
-  else if (oMode == BaseGDL::HEX) oss << std::uppercase << std::hex << val;
-  else oss << std::nouppercase << std::hex << val; // HEXL
- }
- if (w == 0)
-  os << oss.str();
- else if (oss.tellp() > w)
-  OutStars(os, w);
- else if (code & fmtALIGN_LEFT) {
-  os << std::left;
-  os << std::setw(w);
-  os << oss.str();
-  os << std::right;
- } else
-  OutFixFill(os, oss.str(), w, code);
+    // at least d digits, the sign not counted
+    std::string::size_type digits = start;
+    if (out[ digits] == '-' || out[ digits] == '+') ++digits;
+    if (out.size() - digits < static_cast<std::string::size_type>(d))
+      out.insert(digits, d - (out.size() - digits), '0');
+    //remove PAD for next treatment ---> must be blanks
+    code &= (~fmtPAD);
+  }
+  if (w == 0) return;
+  FmtFit(out, start, w, code & fmtALIGN_LEFT, code & fmtPAD);
 }
 
+template <typename T>
+void OutInteger(std::ostream& os, const T &val, const int w, const int d, int code, const BaseGDL::IOMode oMode) {
+  std::string out;
+  AppendInteger(out, val, w, d, code, oMode);
+  os << out;
+}
+
+// the formatted output of many numbers goes through one buffer, written
+// at once. For large arrays the blocks of fmtBlockSize elements are
+// formatted in parallel (one buffer per thread)
+static const SizeT fmtBlockSize = 1 << 20;
+
+template <typename T>
+class FloatFormatter {
+  int w, d, code;
+  BaseGDL::IOMode oMode;
+public:
+  FloatFormatter(int w_, int d_, int code_, BaseGDL::IOMode oMode_): w(w_), d(d_), code(code_), oMode(oMode_) {}
+  SizeT Width() const { return w > 0 ? w : 16; }
+  void operator()(std::string& out, const T& val) const {
+    if (oMode == BaseGDL::AUTO) AppendAuto(out, val, w, d, code); // G
+    else if (oMode == BaseGDL::FIXED) AppendFixed(out, val, w, d, code); // F, D
+    else if (oMode == BaseGDL::SCIENTIFIC) AppendScientific(out, val, w, d, code); // E
+  }
+};
+
+template <typename T>
+class IntegerFormatter {
+  int w, d, code;
+  BaseGDL::IOMode oMode;
+public:
+  IntegerFormatter(int w_, int d_, int code_, BaseGDL::IOMode oMode_): w(w_), d(d_), code(code_), oMode(oMode_) {}
+  SizeT Width() const { return w > 0 ? w : 12; }
+  void operator()(std::string& out, const T& val) const {
+    AppendInteger(out, val, w, d, code, oMode);
+  }
+};
+
+template <typename T, typename Formatter>
+static void OutFormatted(ostream& os, const T* data, SizeT nEl, const Formatter& fmt) {
+  if (nEl == 0) return;
+  int nChunks = 1;
+  if (CpuTPOOL_NTHREADS > 1 && nEl >= CpuTPOOL_MIN_ELTS && (CpuTPOOL_MAX_ELTS == 0 || CpuTPOOL_MAX_ELTS <= nEl))
+    nChunks = CpuTPOOL_NTHREADS;
+  std::vector<std::string> buf(nChunks);
+  for (SizeT b = 0; b < nEl; b += fmtBlockSize) {
+    SizeT nB = std::min(fmtBlockSize, nEl - b);
+    const T* blk = data + b;
+#pragma omp parallel for num_threads(nChunks) if (nChunks > 1)
+    for (int c = 0; c < nChunks; ++c) {
+      SizeT from = nB * c / nChunks;
+      SizeT to = nB * (c + 1) / nChunks;
+      std::string& out = buf[c];
+      out.clear();
+      out.reserve((to - from) * fmt.Width());
+      for (SizeT i = from; i < to; ++i) fmt(out, blk[i]);
+    }
+    for (int c = 0; c < nChunks; ++c) os.write(buf[c].data(), buf[c].size());
+  }
+}
 
 template <>
 void OutFixed<DComplex>(ostream& os, const DComplex &val, const int w, const int d, const int code)
@@ -418,21 +475,7 @@ OFmtF( ostream* os, SizeT offs, SizeT r, int w, int d, const int code, const Bas
  
   SetDefaultFieldLengths( w, d, 6,  16, 25);
 
-  if( oMode == AUTO) // G
-    {
-      for( SizeT i=offs; i<endEl; ++i)
-	OutAuto( *os, (*this)[ i], w, d, code);
-    }
-  else if( oMode == FIXED) // F, D
-    {
-      for( SizeT i=offs; i<endEl; ++i)
-	OutFixed(*os, (*this)[ i], w, d, code);
-    }
-  else if ( oMode == SCIENTIFIC) // E 
-    {
-      for( SizeT i=offs; i<endEl; ++i)
-	OutScientific( *os, (*this)[ i], w, d, code);
-    }
+  OutFormatted( *os, static_cast<Ty*>( this->DataAddr()) + offs, endEl - offs, FloatFormatter<Ty>( w, d, code, oMode));
   
   return tCount;
 }
@@ -450,21 +493,7 @@ OFmtF( ostream* os, SizeT offs, SizeT r, int w, int d, const int code, const Bas
 
   SetDefaultFieldLengths( w, d, 6, 7, 15);
 
-  if( oMode == AUTO) // G
-    {
-      for( SizeT i=offs; i<endEl; ++i)
-	OutAuto( *os, (*this)[ i], w, d, code);
-    }
-  else if( oMode == FIXED) // F, D
-    {
-      for( SizeT i=offs; i<endEl; ++i)
-	OutFixed(*os, (*this)[ i], w, d, code);
-    }
-  else if ( oMode == SCIENTIFIC) // E 
-    {
-      for( SizeT i=offs; i<endEl; ++i)
-	OutScientific( *os, (*this)[ i], w, d, code);
-    }
+  OutFormatted( *os, static_cast<Ty*>( this->DataAddr()) + offs, endEl - offs, FloatFormatter<Ty>( w, d, code, oMode));
 
   return tCount;
 }
@@ -695,7 +724,8 @@ OFmtI( ostream* os, SizeT offs, SizeT r, int w, int d, int code,
 
   SizeT endEl = offs + tCount;
 
-  for( SizeT i=offs; i<endEl; ++i)  OutInteger( *os, (*cVal)[ i], w, d, code, oMode);
+  OutFormatted( *os, static_cast<DInt*>( cVal->DataAddr()) + offs, endEl - offs, IntegerFormatter<DInt>( w, d, code, oMode));
+  delete cVal;
   return tCount;
 }
 
@@ -715,7 +745,8 @@ OFmtI( ostream* os, SizeT offs, SizeT r, int w, int d, int code,
 
   SizeT endEl = offs + tCount;
 
-  for( SizeT i=offs; i<endEl; ++i)  OutInteger( *os, (*cVal)[ i], w, d, code, oMode);
+  OutFormatted( *os, static_cast<DLong*>( cVal->DataAddr()) + offs, endEl - offs, IntegerFormatter<DLong>( w, d, code, oMode));
+  delete cVal;
   return tCount;
 }
 //GDL_INT
@@ -732,7 +763,7 @@ OFmtI( ostream* os, SizeT offs, SizeT r, int w, int d, int code,
 
   SizeT endEl = offs + tCount;
 
-  for( SizeT i=offs; i<endEl; ++i)  OutInteger( *os, (*this)[ i], w, d, code, oMode);
+  OutFormatted( *os, static_cast<Ty*>( this->DataAddr()) + offs, endEl - offs, IntegerFormatter<Ty>( w, d, code, oMode));
   return tCount;
 }
 
@@ -750,7 +781,7 @@ OFmtI( ostream* os, SizeT offs, SizeT r, int w, int d, int code,
 
   SizeT endEl = offs + tCount;
   
-  for( SizeT i=offs; i<endEl; ++i)  OutInteger( *os, (*this)[ i], w, d, code, oMode);
+  OutFormatted( *os, static_cast<Ty*>( this->DataAddr()) + offs, endEl - offs, IntegerFormatter<Ty>( w, d, code, oMode));
   return tCount;
 }
 // GDL_ULONG
@@ -767,7 +798,7 @@ OFmtI( ostream* os, SizeT offs, SizeT r, int w, int d, int code,
 
   SizeT endEl = offs + tCount;
 
-  for( SizeT i=offs; i<endEl; ++i)  OutInteger( *os, (*this)[ i], w, d, code, oMode);
+  OutFormatted( *os, static_cast<Ty*>( this->DataAddr()) + offs, endEl - offs, IntegerFormatter<Ty>( w, d, code, oMode));
   return tCount;
 }
 // GDL_LONG64
@@ -784,7 +815,7 @@ OFmtI(ostream* os, SizeT offs, SizeT r, int w, int d, int code,
 
   SizeT endEl = offs + tCount;
 
-  for (SizeT i = offs; i < endEl; ++i) OutInteger(*os, (*this)[ i], w, d, code, oMode);
+  OutFormatted(*os, static_cast<Ty*>( this->DataAddr()) + offs, endEl - offs, IntegerFormatter<Ty>(w, d, code, oMode));
   return tCount;
 }
 // GDL_ULONG64
@@ -801,7 +832,7 @@ OFmtI( ostream* os, SizeT offs, SizeT r, int w, int d, int code,
 
   SizeT endEl = offs + tCount;
 
-  for( SizeT i=offs; i<endEl; ++i)  OutInteger( *os, (*this)[ i], w, d, code, oMode);
+  OutFormatted( *os, static_cast<Ty*>( this->DataAddr()) + offs, endEl - offs, IntegerFormatter<Ty>( w, d, code, oMode));
   return tCount;
 }
 
@@ -27,6 +27,7 @@
 
 #include "datatypes.hpp"
 #include "dstructgdl.hpp"
+#include "fmtnum.hpp"
 
 #ifdef _MSC_VER
 #define finite _finite
@@ -91,45 +92,48 @@ inline void OutStars( std::ostream& os, const int n)
   for( int i=0; i<n; ++i) os << "*";
 }
 
-inline void OutFixedStringVal( std::ostream& os, const std::string &symbol, const char s, int w, const int code) {
+// the Append... functions write to a string (see fmtnum.hpp), the Out...
+// functions to a stream: same output
+inline void AppendFixedStringVal( std::string& out, const std::string &symbol, const char s, int w, const int code) {
   int l=symbol.length();
   bool dosign=( code & fmtSHOWPOS || s=='-');
   bool dofill=( code & fmtPAD );
   if (w <=0) w=(dosign?l+1:l);
-  if( w < (dosign?l+1:l)) { OutStars( os, w); return;}
-  if (code & fmtALIGN_LEFT) 
-  {
-   os << std::left;
-   if (dosign) {os << s << std::setw( w-1 ) << symbol ; return;}
-   os << std::setw( w ) << symbol;  return;
-  }
-  if (dofill && dosign ) { os << s << std::setw( w-1 ) << std::setfill('0') << std::right << symbol << std::setfill(' ') ; return;}
-  if (dofill) { os << std::setw( w ) << std::setfill('0') << std::right << symbol << std::setfill(' ') ; return;}
-  if (dosign)  { os << std::setw( w-l ) << std::right << s << symbol; return;}
-  os << std::setw( w ) << std::right << symbol; return;
+  if( w < (dosign?l+1:l)) { out.append( w, '*'); return;}
+  if (dosign) { w--; if (!dofill && !(code & fmtALIGN_LEFT)) { out.append( w-l, ' '); w=l;} out += s;}
+  std::string::size_type start=out.size();
+  out += symbol;
+  FmtFit( out, start, w, code & fmtALIGN_LEFT, dofill);
 }
 
 template <typename T>
-inline void OutFixedNan( std::ostream& os, const T val, const int w, const int code) //d is ignored for Nan/Inf
+inline void AppendFixedNan( std::string& out, const T val, const int w, const int code) //d is ignored for Nan/Inf
 {
-  static std::string symbol="NaN";
+  static const std::string symbol="NaN";
   char s=(std::signbit(val))?'-':'+';
-  OutFixedStringVal(os, symbol, s, w, code);
+  AppendFixedStringVal(out, symbol, s, w, code);
 }
 
 template <typename T>
-inline void OutFixedInf( std::ostream& os, const T val, const int w, const int code) //d is ignored for Nan/Inf
+inline void AppendFixedInf( std::string& out, const T val, const int w, const int code) //d is ignored for Nan/Inf
 {
-  static std::string symbol="Inf";
+  static const std::string symbol="Inf";
   char s=(std::signbit(val))?'-':'+';
-  OutFixedStringVal(os, symbol, s, w, code);
+  AppendFixedStringVal(out, symbol, s, w, code);
 }
 template <>
-inline void OutFixedInf<DDouble>( std::ostream& os, const DDouble val, const int w, const int code) //d is ignored for Nan/Inf
+inline void AppendFixedInf<DDouble>( std::string& out, const DDouble val, const int w, const int code) //d is ignored for Nan/Inf
 {
-  static std::string symbol="Infinity";
+  static const std::string symbol="Infinity";
   char s=(std::signbit(val))?'-':'+';
-  OutFixedStringVal(os, symbol,s, w, code);
+  AppendFixedStringVal(out, symbol, s, w, code);
+}
+
+// 'out' from 'start' in a field of width w (w==0: as is)
+inline void AppendField( std::string& out, std::string::size_type start, const int w, const int code)
+{
+  if( w == 0) return;
+  FmtFit( out, start, w, code & fmtALIGN_LEFT, code & fmtPAD);
 }
 
 inline void OutFixFill(std::ostream& os, const std::string &s, const int w, const int code)
@@ -155,28 +159,23 @@ inline void OutAdjustFill(std::ostream& os, const std::string &s, const int w, c
 }
 
 template <typename T>
-void OutFixed(std::ostream& os, const T &val, const int w, const int d, const int code)
+void AppendFixed(std::string& out, const T &val, const int w, const int d, const int code)
 {
   if (std::isfinite(val)) {
-   std::ostringstream oss;
-  if ( code & fmtSHOWPOS ) oss << std::showpos;
-   oss << std::fixed << std::setprecision(d) << val;
-   if (d==0) oss << ".";
-   if( w <= 0)
-     os << oss.str();
-   else if( oss.tellp() > w)
-     OutStars( os, w);
-   else if (code & fmtALIGN_LEFT) 
-   {
-    os << std::left;
-    os << std::setw(w);
-    os << oss.str();
-    os << std::right;
-   }
-   else
-     OutFixFill(os, oss.str(), w, code);
-  } else if (std::isnan(val))    OutFixedNan<T>( os, val, w, code);
-  else OutFixedInf<T>( os, val, w, code);
+   std::string::size_type start=out.size();
+   FmtFixed( out, val, d, code & fmtSHOWPOS);
+   if (d==0) out += '.';
+   if( w > 0) AppendField( out, start, w, code);
+  } else if (std::isnan(val))    AppendFixedNan<T>( out, val, w, code);
+  else AppendFixedInf<T>( out, val, w, code);
+}
+
+template <typename T>
+void OutFixed(std::ostream& os, const T &val, const int w, const int d, const int code)
+{
+  std::string out;
+  AppendFixed( out, val, w, d, code);
+  os << out;
 }
 
 template <>
@@ -186,27 +185,21 @@ void OutFixed<DComplexDbl>(std::ostream& os, const DComplexDbl &val, const int w
 
 
 template <typename T>
-void OutScientific(std::ostream& os, const T &val, const int w, const int d, const int code) {
+void AppendScientific(std::string& out, const T &val, const int w, const int d, const int code) {
  if (std::isfinite(val)) {
-  std::ostringstream oss;
   // TODO: IDL handles both lower and upper case "E" (tracker item no. 3147155)
-  if ( code & fmtSHOWPOS ) oss << std::showpos;
-  if ( code & fmtUPPER ) oss << std::uppercase ;
-  oss << std::scientific << std::setprecision(d) << val;
-  if (w == 0 )
-   os << oss.str();
-  else if (oss.tellp() > w)
-   OutStars(os, w);
-  else if (code & fmtALIGN_LEFT) 
-  {
-   os << std::left;
-   os << std::setw(w);
-   os << oss.str();
-   os << std::right;
-  }
-  else OutFixFill(os, oss.str(), w, code);
- } else if (std::isnan(val)) OutFixedNan<T>(os, val, w, code);
- else OutFixedInf<T>(os, val, w, code);
+  std::string::size_type start=out.size();
+  FmtScientific( out, val, d, code & fmtSHOWPOS, code & fmtUPPER);
+  AppendField( out, start, w, code);
+ } else if (std::isnan(val)) AppendFixedNan<T>(out, val, w, code);
+ else AppendFixedInf<T>(out, val, w, code);
+}
+
+template <typename T>
+void OutScientific(std::ostream& os, const T &val, const int w, const int d, const int code) {
+  std::string out;
+  AppendScientific( out, val, w, d, code);
+  os << out;
 }
 
 template <>
@@ -215,21 +208,20 @@ template <>
 void OutScientific<DComplexDbl>( std::ostream& os, const DComplexDbl &val, const int w, const int d, const int code);
 
 template <typename T>
-void OutAuto(std::ostream& os, const T &val, const int w, const int d, const int code=0) {
+void AppendAuto(std::string& out, const T &val, const int w, const int d, const int code=0) {
 
  if (std::isfinite(val)) {
-  std::ostringstream ossF;
+  const bool showPos = code & fmtSHOWPOS;
+  std::string::size_type start=out.size();
   int fixLen=1;
   
   if (val == T(0.0)) // handle 0.0
   {
    if (w <= 0) {
-    if ( code & fmtSHOWPOS ) os<<"+0"; else os<<"0";
+    if ( showPos ) out += "+0"; else out += '0';
     return;
    } //0 is FIXED
-   if (code & fmtSHOWPOS) ossF << std::showpos ;
-   if (code & fmtALIGN_LEFT) ossF << std::left; else ossF << std::right;
-   ossF << std::fixed << std::setprecision(d-1) << val;
+   FmtFixed( out, val, d-1, showPos);
   } else {
    int   powTen = static_cast<int>(std::floor( std::log10( std::abs( val))));
    fixLen = powTen > 0 ? powTen+1 : 1; // number of digits before '.'
@@ -239,61 +231,37 @@ void OutAuto(std::ostream& os, const T &val, const int w, const int d, const int
    // static cast here is needed for OS X, without we get a *linker* error
    // (but only if GDL is compiled with Magick)
 
-   if (code & fmtSHOWPOS) ossF << std::showpos ;
-   if (code & fmtALIGN_LEFT) ossF << std::left; else ossF << std::right;
    if( w == 0 && (powTen < d && powTen > -d) && (val - std::floor( val) < std::pow( 10.0, static_cast<double>(-d))))
-     ossF << std::fixed << std::setprecision(0) << val; 
+     FmtFixed( out, val, 0, showPos);
    else if( powTen == 0 || (powTen < d && powTen > -d+1)) //just like that.
      {
        //format for values between -1 and 1 adapts to the width as to show as many digits as possible
-       ossF << std::fixed << std::setprecision(d>fixLen?d-fixLen+((powTen<0)?-powTen:0):0) << val;
-       if( d <= fixLen && w>0) ossF << ".";
+       FmtFixed( out, val, d>fixLen?d-fixLen+((powTen<0)?-powTen:0):0, showPos);
+       if( d <= fixLen && w>0) out += '.';
      }
    else
      fixLen = 0; // marker to force scientific output
  }
   //get the scientific string
-  std::ostringstream ossS;
-  if (code & fmtSHOWPOS) ossS << std::showpos ;
-  if (code & fmtALIGN_LEFT) ossS << std::left; else ossS << std::right;
-  if ( code & fmtUPPER ) ossS << std::uppercase ;
-  if (w==0) ossS << std::setprecision(d>6?d:6) << val; //Auto w=0 special format: does not use "scientific" but default field-point notation. 
-  else ossS << std::scientific << std::setprecision(d>0?d-1:0) << val;
+  std::string sci;
+  if (w==0) FmtGeneral( sci, val, d>6?d:6, showPos, code & fmtUPPER); //Auto w=0 special format: does not use "scientific" but default field-point notation. 
+  else FmtScientific( sci, val, d>0?d-1:0, showPos, code & fmtUPPER);
   // compare merits
-  if( fixLen == 0 || ossF.tellp() > ossS.tellp()) {
-    if( w == 0)
-      os << ossS.str();
-    else if( ossS.tellp() > w)
-      OutStars( os, w);
-    else if (code & fmtALIGN_LEFT) 
-    {
-     os << std::left;
-     os << std::setw(w);
-     os << ossS.str();
-     os << std::right;
-    }    
-    else
-      OutFixFill(os, ossS.str(), w, code);
-  }
-  else
-  {
-    if( w == 0)
-      os << ossF.str();
-    else if( ossF.tellp() > w)
-      OutStars( os, w);
-    else if (code & fmtALIGN_LEFT) 
-    {
-     os << std::left;
-     os << std::setw(w);
-     os << ossF.str();
-     os << std::right;
-    }
-    else
-      OutFixFill(os, ossF.str(), w, code);
+  if( fixLen == 0 || out.size() - start > sci.size()) {
+    out.resize( start);
+    out += sci;
   }
+  AppendField( out, start, w, code);
  }
- else if (std::isnan(val)) OutFixedNan<T>(os, val, w, code);
- else OutFixedInf<T>(os, val, w, code);
+ else if (std::isnan(val)) AppendFixedNan<T>(out, val, w, code);
+ else AppendFixedInf<T>(out, val, w, code);
+}
+
+template <typename T>
+void OutAuto(std::ostream& os, const T &val, const int w, const int d, const int code=0) {
+  std::string out;
+  AppendAuto( out, val, w, d, code);
+  os << out;
 }
 
 template <>
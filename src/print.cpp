@@ -25,6 +25,7 @@
 #include "basic_pro.hpp"
 #include "objects.hpp"
 #include "FMTOut.hpp"
+#include "fmtprogram.hpp"
 #include "terminfo.hpp" 
 #include "gdljournal.hpp"
 #include "dinterpreter.hpp"
@@ -187,7 +188,8 @@ no_implied:
 
       if (fmtString != "") {
         try {
-          RefFMTNode fmtAST = GetFMTAST(fmtString);
+          const FMTProgram* fmtProgram;
+          RefFMTNode fmtAST = GetFMTAST(fmtString, &fmtProgram);
 #ifdef GDL_DEBUG
           antlr::print_tree pt;
           cout << "Format parser output:" << endl;
@@ -196,13 +198,22 @@ no_implied:
 #endif
 
           // formatted output ignores WIDTH
+          if (fmtProgram != NULL) {
+            fmtProgram->Out(os, e, parOffset);
+            return;
+          }
           FMTOut Formatter(fmtAST, os, e, parOffset);
           return;
         } catch (antlr::ANTLRException& ex) {
           //Authorize the format to be "new" C format. Should better be handled in the parser, FIXME!
           try {
             DString fmtSTring2 = "(%\"" + fmtString + "\")";
-            RefFMTNode fmtAST = GetFMTAST(fmtSTring2);
+            const FMTProgram* fmtProgram;
+            RefFMTNode fmtAST = GetFMTAST(fmtSTring2, &fmtProgram);
+            if (fmtProgram != NULL) {
+              fmtProgram->Out(os, e, parOffset);
+              return;
+            }
             FMTOut Formatter(fmtAST, os, e, parOffset);
             return;
           } catch (antlr::ANTLRException& ex) {
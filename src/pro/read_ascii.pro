@@ -306,17 +306,12 @@ rnumber = '^[+-]?([0-9]*\.?[0-9]*[ed]?[+-]?[0-9]+\.?[0-9]*|NaN|Inf|Infinity)$'
 ;------------------
 
 if N_ELEMENTS(template) eq 0 then begin
-   ncolumns = LONARR(linecount)
-   for line=0l, linecount-1 do begin
-      ncolumns[line] = N_ELEMENTS(STRSPLIT(text[line], delimiter))
-   endfor
-   ncolumn = MAX(ncolumns)
-   result = MAKE_ARRAY(ncolumn, linecount, /float, value=FLOAT(missing_value))
-   for line=0l, linecount-1 do begin
-      row = STRSPLIT(text[line], delimiter, /extract)
-      index = WHERE(STREGEX(row, rnumber, /fold_case, /boolean), count)
-      if count gt 0 then result[index, line] = float(row[index])
-   endfor
+   ; one row per line, as many columns as the longest line has fields
+   strresult = GDL_SPLIT_COLUMNS(text, delimiter)
+   result = MAKE_ARRAY(dimension=SIZE(strresult, /dimensions), /float, $
+                       value=FLOAT(missing_value))
+   index = WHERE(STREGEX(strresult, rnumber, /fold_case, /boolean), count)
+   if count gt 0 then result[index] = float(strresult[index])
    return, {field1:TEMPORARY(result)}
 endif
 ;
@@ -344,19 +339,14 @@ end
 fieldlocs   = template.fieldlocations
 fieldgroups = template.fieldgroups
 
-strresult = STRARR(fieldcount, linecount)
-
-
 ;-------------------------------------
 ; slice the file content into columns
 ;-------------------------------------
 
 if KEYWORD_SET(delimiter) then begin
-   for line=0l, linecount-1 do begin
-      row = STRSPLIT(text[line], STRING(delimiter), /extract)
-      strresult[0, line] = row
-   endfor
+   strresult = GDL_SPLIT_COLUMNS(text, STRING(delimiter), fieldcount)
 endif else begin
+   strresult = STRARR(fieldcount, linecount)
    for i=0l, fieldcount-2 do begin
       strresult[i,*] = STRMID(text, fieldlocs[i], fieldlocs[i+1]-fieldlocs[i])
    endfor
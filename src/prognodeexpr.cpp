@@ -3221,6 +3221,32 @@ BaseGDL* FCALL_LIB_DIRECTNode::Eval()
     }
 }
 
+FUSEDEXPRNode::FUSEDEXPRNode( ProgNodeP expr, FusedExpr* f)
+  : DefaultNode(), fused( f), active( true)
+{
+  setType( GDLTokenTypes::EXPR);
+  setText( "fused");
+  setLine( expr->getLine());
+  right = expr->StealNextSibling();
+  down = expr;
+}
+
+FUSEDEXPRNode::~FUSEDEXPRNode()
+{
+  delete fused;
+}
+
+BaseGDL* FUSEDEXPRNode::Eval()
+{
+  if( active && FusedExpr::Enabled())
+    {
+      BaseGDL* res = fused->Eval();
+      if( res != NULL)
+	return res;
+    }
+  return down->Eval();
+}
+
 BaseGDL** FCALL_LIBNode::EvalRefCheck( BaseGDL*& rEval)
 {
     EnvT* newEnv=new EnvT( this, this->libFun);//libFunList[fl->funIx]);
@@ -20,6 +20,7 @@
 
 #include "prognode.hpp"
 #include "dpro.hpp"
+#include "exprfusion.hpp"
 
 
 class UnaryExpr: public DefaultNode
@@ -118,10 +119,24 @@ public:
     assert( this->libFun != NULL);
     libFunDirectFun = static_cast<DLibFunDirect*>(this->libFun)->FunDirect();
   }
+  LibFunDirect FunDirect() const { return libFunDirectFun;}
   BaseGDL** LEval();
   BaseGDL* Eval();
 };
 
+// replaces a tree of elementwise operators (see exprfusion.hpp)
+// typed EXPR with the original tree as first child, like EXPRNode
+class FUSEDEXPRNode: public DefaultNode
+{
+  FusedExpr* fused;
+  bool       active; // false if part of a larger fused expression
+public:
+  FUSEDEXPRNode( ProgNodeP expr, FusedExpr* f);
+  ~FUSEDEXPRNode();
+  void Deactivate() { active = false;}
+  BaseGDL* Eval();
+};
+
 class FCALL_LIB_N_ELEMENTSNode: public LeafNode
 {
 public:
@@ -143,6 +143,10 @@ bool CheckSub( DSub* sub, PyObject *argTuple, PyObject *kwDict)
   return true;
 }
 
+// GDL.zero_copy(): large NumPy arrays passed to GDL are used in place
+// (GDL modifies them then). Off by default: python may alias them.
+static bool zeroCopyArgs = false;
+
 bool CopyArgFromPython( vector<BaseGDL*>& parRef,
 			vector<BaseGDL*>& kwRef,
 			EnvBaseT& e,
@@ -159,13 +163,13 @@ bool CopyArgFromPython( vector<BaseGDL*>& parRef,
       PyObject *pyArg = PyTuple_GetItem(argTuple, p);
       if( PyTuple_Check( pyArg)) // local variable (no cpy back)
 	{
-	  BaseGDL* pP = FromPython( PyTuple_GetItem( pyArg, 0)); // throws
+	  BaseGDL* pP = FromPython( PyTuple_GetItem( pyArg, 0), zeroCopyArgs); // throws
 	  parRef.push_back( NULL);
 	  e.SetNextPar( pP);
 	}
       else
 	{
-	  BaseGDL* pP = FromPython( pyArg); // throws
+	  BaseGDL* pP = FromPython( pyArg, zeroCopyArgs); // throws
 	  parRef.push_back( pP);
 	  e.SetNextPar( &(parRef.back()));
 
@@ -213,13 +217,13 @@ bool CopyArgFromPython( vector<BaseGDL*>& parRef,
 	  
 	  if( PyTuple_Check( value)) // local keyword (no cpy back)
 	    {
-	      BaseGDL* pP = FromPython( PyTuple_GetItem( value, 0)); // throws
+	      BaseGDL* pP = FromPython( PyTuple_GetItem( value, 0), zeroCopyArgs); // throws
 	      kwRef.push_back( NULL);
 	      e.SetKeyword(  keyString, pP);
 	    }
 	  else
 	    {
-	      BaseGDL* pP = FromPython( value); // throws
+	      BaseGDL* pP = FromPython( value, zeroCopyArgs); // throws
 	      kwRef.push_back( pP);
 	      e.SetKeyword(  keyString, &kwRef.back());
 	    }
@@ -242,7 +246,12 @@ bool CopyArgToPython( vector<BaseGDL*>& parRef,
       BaseGDL* gdlPar = parRef[ p-1];
       if( gdlPar != NULL)
 	{
-	  PyObject* pyObj = gdlPar->ToPython(); // throws
+	  // the argument copies are discarded: arrays are handed over
+	  PyObject* pyObj = GiveToPython( gdlPar);
+	  if( pyObj != NULL)
+	    parRef[ p-1] = NULL;
+	  else
+	    pyObj = gdlPar->ToPython(); // throws
 	  int success0 = PyTuple_SetItem( argTuple, p, pyObj);
 	  // Py_DECREF(pyObj); not needed: PyTuple_SetItem steals
 	}
@@ -259,7 +268,11 @@ bool CopyArgToPython( vector<BaseGDL*>& parRef,
 	  PyDict_Next( kwDict, &dictPos, &key, &value);
 	  if( gdlKW != NULL)
 	    {
-	      PyObject* pyObj = gdlKW->ToPython(); // throws
+	      PyObject* pyObj = GiveToPython( gdlKW);
+	      if( pyObj != NULL)
+		kwRef[ k] = NULL;
+	      else
+		pyObj = gdlKW->ToPython(); // throws
 	      int success0 = PyDict_SetItem( kwDict, key, pyObj);
 	      Py_DECREF( pyObj);
 	    }
@@ -428,7 +441,11 @@ PyObject *GDLSub( PyObject *self, PyObject *argTuple, PyObject *kwDict,
 
     if( retValGDL != NULL)
       {
-	retVal = retValGDL->ToPython();
+	retVal = GiveToPython( retValGDL);
+	if( retVal != NULL)
+	  retValGDL_guard.release();
+	else
+	  retVal = retValGDL->ToPython();
       }
   }
   catch ( GDLException ex)
@@ -516,6 +533,18 @@ extern "C" {
     return GDLSub( self, argTuple, kwDict, false);
   }
 
+  // GDL.zero_copy([flag]): returns the current setting, sets it to 'flag'
+  PyObject *GDL_zero_copy(PyObject *self, PyObject *argTuple)
+  {
+    PyObject* flag = NULL;
+    if( !PyArg_ParseTuple( argTuple, "|O", &flag))
+      return NULL;
+    PyObject* retVal = PyBool_FromLong( zeroCopyArgs);
+    if( flag != NULL)
+      zeroCopyArgs = PyObject_IsTrue( flag);
+    return retVal;
+  }
+
   // python GDL module method table
   PyMethodDef GDLMethods[] = {
     {"pro",      (PyCFunction) GDL_pro,      METH_VARARGS | METH_KEYWORDS,
@@ -524,6 +553,8 @@ extern "C" {
      "Execute a GDL function."},
     {"script",   (PyCFunction) GDL_script,   METH_VARARGS | METH_KEYWORDS,
      "Run a GDL script (sequence of commands)."},
+    {"zero_copy", (PyCFunction) GDL_zero_copy, METH_VARARGS,
+     "Pass large NumPy arrays to GDL without copying them."},
     {NULL, NULL, 0, NULL}        // Sentinel
   };
 
@@ -20,6 +20,7 @@
 
 #include <string>
 #include <iostream>
+#include <limits>
 
 #include "datatypes.hpp"
 #include "envt.hpp"
@@ -77,35 +78,10 @@ namespace lib {
 
 	} else {
 	  //  *** Socket Read *** //
-	  string *recvBuf = &fileUnits[ lun-1].RecvBuf();
-
-	  // Setup recv buffer & string
-	  const int MAXRECV = 2048*8;
-	  char buf[MAXRECV+1];
-
-	  // Read socket until finished & store in recv string
-	  int totalread = 0;
-	  while (1) {
-	    memset(buf, 0, MAXRECV+1);
-	    int status = recv(sockNum, buf, MAXRECV, 0);
-	    //	    cout << "Bytes received: " << status << endl;
-	    if (status == 0) break;
-
-	    recvBuf->append(buf, status);
-
-	    //	    for( SizeT i=0; i<status; i++) 
-	    // recvBuf->push_back(buf[i]);
-
-	    totalread += status;
-	    //cout << "recvBuf size: " << recvBuf->size() << endl;
-	    //cout << "Total bytes read: " << totalread << endl << endl;
-	  }
-	  //  if (totalread > 0) cout << "Total bytes read: " << totalread << endl;
-
-	  // Get istringstream, write recv string, & assign to istream
-	  istringstream *iss = &fileUnits[ lun-1].ISocketStream();
-	  iss->str(*recvBuf);
-	  is = iss;
+	  // everything until the connection is closed (or READ_TIMEOUT)
+	  GDLStream& sock = fileUnits[ lun-1];
+	  sock.SocketFill( std::numeric_limits<SizeT>::max());
+	  is = &sock.SocketStream();
 	}
       }
 
@@ -113,9 +89,7 @@ namespace lib {
 
     // If socket strip off leading line
     if (lun > 0 && fileUnits[ lun-1].SockNum() != -1) {
-      string *recvBuf = &fileUnits[ lun-1].RecvBuf();
-      int pos = is->tellg();
-      recvBuf->erase(0, pos);
+      fileUnits[ lun-1].SocketConsume( is->tellg());
 
       //      int pos = recvBuf->find("\n", 0);
       //recvBuf->erase(0, pos+1);
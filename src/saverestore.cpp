@@ -21,6 +21,7 @@
 #include "dinterpreter.hpp"
 #include "nullgdl.hpp"
 #include <queue>
+#include <set>
 
 //Useful for debugging...
 #define DEBUG_SAVERESTORE 0
@@ -113,6 +114,94 @@ enum {
     return (xdr_double(xdrs, reinterpret_cast<double *> (p)) && xdr_double(xdrs, reinterpret_cast<double *> (p) + 1));
   }
   
+  // Numeric array data in bulk: xdr_vector() calls a filter per element;
+  // here the payload is moved with xdr_opaque() (memcpy or fread/fwrite,
+  // in chunks) and byte swapped in place on little endian hosts. The XDR
+  // representation is unchanged: big endian, 4 byte units, 16 bit integers
+  // widened to 32 bits (xdr_int16_t sign extends, xdr_uint16_t does not).
+  static const SizeT xdrBulkChunk = 1 << 20; // bytes, a multiple of 8
+
+  inline uint32_t xdrSwap32(uint32_t v) {
+    return (v >> 24) | ((v >> 8) & 0xff00) | ((v << 8) & 0xff0000) | (v << 24);
+  }
+
+  inline uint64_t xdrSwap64(uint64_t v) {
+    return (static_cast<uint64_t>(xdrSwap32(static_cast<uint32_t>(v))) << 32) | xdrSwap32(static_cast<uint32_t>(v >> 32));
+  }
+
+  // host <-> XDR order of n 4 or 8 byte words
+  void xdrSwapWords(char* data, SizeT n, int size) {
+#ifndef IS_BIGENDIAN
+    if (size == 4)
+    {
+      uint32_t* w = reinterpret_cast<uint32_t*> (data);
+      for (SizeT i = 0; i < n; ++i) w[i] = xdrSwap32(w[i]);
+    } else
+    {
+      uint64_t* w = reinterpret_cast<uint64_t*> (data);
+      for (SizeT i = 0; i < n; ++i) w[i] = xdrSwap64(w[i]);
+    }
+#endif
+  }
+
+  // nEl words of 'size' (4 or 8) bytes, as xdr_vector with xdr_int32_t,
+  // xdr_float, xdr_double, xdr_int64_t... would decode them
+  bool xdrReadWords(XDR* xdrs, char* data, SizeT nEl, int size) {
+    SizeT nBytes = nEl * size;
+    for (SizeT done = 0; done < nBytes; done += xdrBulkChunk)
+      if (!xdr_opaque(xdrs, data + done, std::min(xdrBulkChunk, nBytes - done))) return false;
+    xdrSwapWords(data, nEl, size);
+    return true;
+  }
+
+  bool xdrWriteWords(XDR* xdrs, const char* data, SizeT nEl, int size) {
+    SizeT nBytes = nEl * size;
+    char* buf = static_cast<char*> (malloc(std::min(xdrBulkChunk, nBytes)));
+    bool ok = true;
+    for (SizeT done = 0; ok && done < nBytes; done += xdrBulkChunk)
+    {
+      SizeT len = std::min(xdrBulkChunk, nBytes - done);
+      memcpy(buf, data + done, len);
+      xdrSwapWords(buf, len / size, size);
+      ok = xdr_opaque(xdrs, buf, len);
+    }
+    free(buf);
+    return ok;
+  }
+
+  // 16 bit integers (DInt, DUInt) take one 4 byte XDR unit each
+  template<typename T16>
+  bool xdrReadShorts(XDR* xdrs, T16* data, SizeT nEl) {
+    const SizeT nChunk = xdrBulkChunk / 4;
+    uint32_t* buf = static_cast<uint32_t*> (malloc(std::min(nChunk, nEl) * 4));
+    bool ok = true;
+    for (SizeT done = 0; ok && done < nEl; done += nChunk)
+    {
+      SizeT n = std::min(nChunk, nEl - done);
+      ok = xdr_opaque(xdrs, reinterpret_cast<char*> (buf), n * 4);
+      xdrSwapWords(reinterpret_cast<char*> (buf), n, 4);
+      for (SizeT i = 0; i < n; ++i) data[done + i] = static_cast<T16> (buf[i]);
+    }
+    free(buf);
+    return ok;
+  }
+
+  template<typename T16>
+  bool xdrWriteShorts(XDR* xdrs, const T16* data, SizeT nEl) {
+    const SizeT nChunk = xdrBulkChunk / 4;
+    uint32_t* buf = static_cast<uint32_t*> (malloc(std::min(nChunk, nEl) * 4));
+    bool ok = true;
+    for (SizeT done = 0; ok && done < nEl; done += nChunk)
+    {
+      SizeT n = std::min(nChunk, nEl - done);
+      for (SizeT i = 0; i < n; ++i) buf[i] = static_cast<uint32_t> (static_cast<int32_t> (data[done + i]));
+      xdrSwapWords(reinterpret_cast<char*> (buf), n, 4);
+      ok = xdr_opaque(xdrs, reinterpret_cast<char*> (buf), n * 4);
+    }
+    free(buf);
+    return ok;
+  }
+
   void getTimeUserHost(XDR *xdrs) {
     int32_t UnknownLong;
     for (int i = 0; i < 256; ++i) if (!xdr_int32_t(xdrs, &UnknownLong)) break;
@@ -136,6 +225,23 @@ enum {
     }
   }
   
+#ifndef _WIN32
+  // SAVE, /COMPRESS: the data of a record is encoded in memory (the XDR
+  // stream is redirected to 'save_record' between writeNewRecordHeader and
+  // updateNewRecordHeader) and deflated from there into the file.
+  static FILE* save_record=NULL;
+  static char* save_recordBuf=NULL;
+  static size_t save_recordLen=0;
+
+  void closeRecordBuffer() {
+    if (save_record!=NULL) fclose(save_record);
+    save_record=NULL;
+    free(save_recordBuf);
+    save_recordBuf=NULL;
+    save_recordLen=0;
+  }
+#endif
+
   inline uint32_t writeNewRecordHeader(XDR *xdrs, int code){
     int32_t rectype=code;    
     xdr_int32_t(xdrs, &rectype); //-16
@@ -145,11 +251,54 @@ enum {
     xdr_uint32_t(xdrs, &ptrs1); //-8
     int32_t UnknownLong=0;
     xdr_int32_t(xdrs, &UnknownLong);
-    return xdr_getpos(xdrs); //end of header
+    uint32_t cur=xdr_getpos(xdrs); //end of header
+#ifndef _WIN32
+    if (save_compress && code!=END_MARKER)
+    {
+      closeRecordBuffer(); //left over by an error in a previous SAVE
+      save_record = open_memstream(&save_recordBuf, &save_recordLen);
+      if (save_record!=NULL)
+      {
+        xdr_destroy(xdrs);
+        xdrstdio_create(xdrs, save_record, XDR_ENCODE);
+      }
+    }
+#endif
+    return cur;
   }
 
   inline uint32_t updateNewRecordHeader(XDR *xdrs, uint32_t cur) {
     uint32_t next = xdr_getpos(xdrs);
+#ifndef _WIN32
+    if (save_record!=NULL)
+    {
+      // deflate the record (as compress2() would) directly into the file
+      xdr_destroy(xdrs);
+      fflush(save_record);
+      const SizeT chunk = 1<<20;
+      unsigned char* out = (unsigned char*) malloc(chunk);
+      z_stream zs;
+      zs.zalloc = Z_NULL;
+      zs.zfree = Z_NULL;
+      zs.opaque = Z_NULL;
+      deflateInit(&zs, Z_BEST_SPEED);
+      zs.next_in = (Bytef *) save_recordBuf;
+      zs.avail_in = save_recordLen;
+      int ret;
+      do
+      {
+        zs.next_out = out;
+        zs.avail_out = chunk;
+        ret = deflate(&zs, Z_FINISH);
+        if (fwrite(out, 1, chunk - zs.avail_out, save_fid) != chunk - zs.avail_out) cerr << "(compress) write error" << endl;
+      } while (ret == Z_OK);
+      next = cur + zs.total_out;
+      deflateEnd(&zs);
+      free(out);
+      closeRecordBuffer();
+      xdrstdio_create(xdrs, save_fid, XDR_ENCODE);
+    } else
+#endif
     //dirty trick for compression: write uncompressed, rewind, read what was just written, compress, write over, reset positions.
     if (save_compress)
     {
@@ -1032,54 +1181,54 @@ enum {
         break;
       case GDL_INT:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DInt), (xdrproc_t) xdr_int16_t)) cerr << "error GDL_INT" << endl;
+        if (!xdrReadShorts(xdrs, static_cast<DInt*> (var->DataAddr()), nEl)) cerr << "error GDL_INT" << endl;
       }
         break;
       case GDL_UINT:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DUInt), (xdrproc_t) xdr_uint16_t)) cerr << "error GDL_UINT" << endl;
+        if (!xdrReadShorts(xdrs, static_cast<DUInt*> (var->DataAddr()), nEl)) cerr << "error GDL_UINT" << endl;
       }
         break;
       case GDL_LONG:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (int32_t), (xdrproc_t) xdr_int32_t)) cerr << "error GDL_LONG" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (int32_t))) cerr << "error GDL_LONG" << endl;
       }
         break;
       case GDL_ULONG:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DULong), (xdrproc_t) xdr_uint32_t)) cerr << "error GDL_ULONG" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DULong))) cerr << "error GDL_ULONG" << endl;
       }
         break;
       case GDL_LONG64:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DLong64), (xdrproc_t) xdr_int64_t)) cerr << "error GDL_LONG64" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DLong64))) cerr << "error GDL_LONG64" << endl;
       }
         break;
       case GDL_ULONG64:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DULong64), (xdrproc_t) xdr_uint64_t)) cerr << "error GDL_ULONG64" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DULong64))) cerr << "error GDL_ULONG64" << endl;
       }
         break;
       case GDL_FLOAT:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DFloat), (xdrproc_t) xdr_float)) cerr << "error GDL_FLOAT" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DFloat))) cerr << "error GDL_FLOAT" << endl;
       }
         break;
       case GDL_DOUBLE:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DDouble), (xdrproc_t) xdr_double)) cerr << "error GDL_DOUBLE" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DDouble))) cerr << "error GDL_DOUBLE" << endl;
       }
         break;
       case GDL_COMPLEX:
       {
         u_int nEl2 = nEl * 2;
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl2, sizeof (DFloat), (xdrproc_t) xdr_float)) cerr << "error GDL_COMPLEX" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl2, sizeof (DFloat))) cerr << "error GDL_COMPLEX" << endl;
       }
         break;
       case GDL_COMPLEXDBL:
       {
         u_int nEl2 = nEl * 2;
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl2, sizeof (DDouble), (xdrproc_t) xdr_double)) cerr << "error GDL_COMPLEXDBL" << endl;
+        if (!xdrReadWords(xdrs, static_cast<char*> (var->DataAddr()), nEl2, sizeof (DDouble))) cerr << "error GDL_COMPLEXDBL" << endl;
       }
         break;
       case GDL_STRING:
@@ -1106,9 +1255,9 @@ enum {
       }
       case GDL_PTR:
       {
-        int32_t heapNumber[nEl];
+        std::vector<int32_t> heapNumber(nEl);
         DPtrGDL* ptr = static_cast<DPtrGDL*> (var);
-        for (SizeT ix = 0; ix < nEl; ++ix) xdr_int32_t(xdrs, &(heapNumber[ix]));
+        if (!xdrReadWords(xdrs, reinterpret_cast<char*> (&heapNumber[0]), nEl, sizeof (int32_t))) cerr << "error PTR" << endl;
         for (SizeT ix = 0; ix < nEl; ++ix)
         {
           DPtr heapptr = heapIndexMapRestore.find(heapNumber[ix])->second.second;
@@ -1120,9 +1269,9 @@ enum {
       }
       case GDL_OBJ:
       {
-        int32_t heapNumber[nEl];
+        std::vector<int32_t> heapNumber(nEl);
         DObjGDL* ptr = static_cast<DObjGDL*> (var);
-        for (SizeT ix = 0; ix < nEl; ++ix) xdr_int32_t(xdrs, &(heapNumber[ix]));
+        if (!xdrReadWords(xdrs, reinterpret_cast<char*> (&heapNumber[0]), nEl, sizeof (int32_t))) cerr << "error OBJ" << endl;
         for (SizeT ix = 0; ix < nEl; ++ix)
         {
           DObj heapptr = heapIndexMapRestore.find(heapNumber[ix])->second.second;
@@ -1148,54 +1297,54 @@ enum {
         break;
       case GDL_INT:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DInt), (xdrproc_t) xdr_int16_t)) cerr << "error GDL_INT" << endl;
+        if (!xdrWriteShorts(xdrs, static_cast<DInt*> (var->DataAddr()), nEl)) cerr << "error GDL_INT" << endl;
       }
         break;
       case GDL_UINT:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DUInt), (xdrproc_t) xdr_uint16_t)) cerr << "error GDL_UINT" << endl;
+        if (!xdrWriteShorts(xdrs, static_cast<DUInt*> (var->DataAddr()), nEl)) cerr << "error GDL_UINT" << endl;
       }
         break;
       case GDL_LONG:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (int32_t), (xdrproc_t) xdr_int32_t)) cerr << "error GDL_LONG" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (int32_t))) cerr << "error GDL_LONG" << endl;
       }
         break;
       case GDL_ULONG:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DULong), (xdrproc_t) xdr_uint32_t)) cerr << "error GDL_ULONG" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DULong))) cerr << "error GDL_ULONG" << endl;
       }
         break;
       case GDL_LONG64:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DLong64), (xdrproc_t) xdr_int64_t)) cerr << "error GDL_LONG64" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DLong64))) cerr << "error GDL_LONG64" << endl;
       }
         break;
       case GDL_ULONG64:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DULong64), (xdrproc_t) xdr_uint64_t)) cerr << "error GDL_ULONG64" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DULong64))) cerr << "error GDL_ULONG64" << endl;
       }
         break;
       case GDL_FLOAT:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DFloat), (xdrproc_t) xdr_float)) cerr << "error GDL_FLOAT" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DFloat))) cerr << "error GDL_FLOAT" << endl;
       }
         break;
       case GDL_DOUBLE:
       {
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl, sizeof (DDouble), (xdrproc_t) xdr_double)) cerr << "error GDL_DOUBLE" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl, sizeof (DDouble))) cerr << "error GDL_DOUBLE" << endl;
       }
         break;
       case GDL_COMPLEX:
       {
         u_int nEl2 = nEl * 2;
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl2, sizeof (DFloat), (xdrproc_t) xdr_float)) cerr << "error GDL_COMPLEX" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl2, sizeof (DFloat))) cerr << "error GDL_COMPLEX" << endl;
       }
         break;
       case GDL_COMPLEXDBL:
       {
         u_int nEl2 = nEl * 2;
-        if (!xdr_vector(xdrs, (char*) var->DataAddr(), nEl2, sizeof (DDouble), (xdrproc_t) xdr_double)) cerr << "error GDL_COMPLEXDBL" << endl;
+        if (!xdrWriteWords(xdrs, static_cast<char*> (var->DataAddr()), nEl2, sizeof (DDouble))) cerr << "error GDL_COMPLEXDBL" << endl;
       }
         break;
       case GDL_STRING:
@@ -1218,7 +1367,7 @@ enum {
       }
       case GDL_PTR:  //we must translate PTRs as they may have been scrambled in the writing of the heap indexes.
       {
-        uint32_t heapNumber[nEl];
+        std::vector<uint32_t> heapNumber(nEl);
         for (SizeT i = 0; i < nEl; ++i)
         {
           heapNumber[i]=0;
@@ -1226,12 +1375,12 @@ enum {
           heapT::iterator it=heapIndexMapSave.find(ptr);
           if (it!=heapIndexMapSave.end()) heapNumber[i]=(*it).second;
         }
-        if (!xdr_vector(xdrs, (char*) &heapNumber, nEl, sizeof (int32_t), (xdrproc_t) xdr_uint32_t)) cerr << "error PTR" << endl;
+        if (!xdrWriteWords(xdrs, reinterpret_cast<char*> (&heapNumber[0]), nEl, sizeof (uint32_t))) cerr << "error PTR" << endl;
         break;
       }
       case GDL_OBJ:
       {
-        uint32_t heapNumber[nEl];
+        std::vector<uint32_t> heapNumber(nEl);
         for (SizeT i = 0; i < nEl; ++i)
         {
           heapNumber[i]=0;
@@ -1239,7 +1388,7 @@ enum {
           heapT::iterator it=heapIndexMapSave.find(ptr);
           if (it!=heapIndexMapSave.end()) heapNumber[i]=(*it).second; 
         }
-        if (!xdr_vector(xdrs, (char*) &heapNumber, nEl, sizeof (int32_t), (xdrproc_t) xdr_uint32_t)) cerr << "error OBJ" << endl;
+        if (!xdrWriteWords(xdrs, reinterpret_cast<char*> (&heapNumber[0]), nEl, sizeof (uint32_t))) cerr << "error OBJ" << endl;
         break;
       }
       default: assert(false);
@@ -1527,6 +1676,17 @@ enum {
     // AC 20200323 : we may have this keyword set but no value in the file : should return "" 
     if (hasDescription)	e->SetKW(DESCRIPTION, new DStringGDL(""));
 
+    // NAMES= (GDL extension): restore only these variables. The records of the
+    // other variables are skipped by their offset, their data are never read.
+    static int NAMES = e->KeywordIx("NAMES");
+    std::set<std::string> wantedNames;
+    bool selective = e->KeywordPresent(NAMES);
+    if (selective)
+    {
+      DStringGDL* names = e->GetKWAs<DStringGDL>(NAMES);
+      for (SizeT i = 0; i < names->N_Elements(); ++i) wantedNames.insert(StrUpCase((*names)[i]));
+    }
+
     //empty heap map by security.
     heapIndexMapRestore.clear();
 
@@ -1620,7 +1780,7 @@ enum {
         if (ptrs1 > 0)
         {
           DULong64 tmp = ptrs1;
-          nextptr &= (tmp << 32);
+          nextptr |= (tmp << 32);
         }
       }
 
@@ -1802,7 +1962,7 @@ enum {
         if (ptrs1 > 0)
         {
           DULong64 tmp = ptrs1;
-          nextptr &= (tmp << 32);
+          nextptr |= (tmp << 32);
         }
       }
 
@@ -1824,7 +1984,9 @@ enum {
           char* varname = 0;
           if (!xdr_string(xdrs, &varname, 2048)) break;
           string varName(varname);
-          if (DEBUG_SAVERESTORE) cerr<<varname<<endl;
+          free(varname);
+          if (DEBUG_SAVERESTORE) cerr<<varName<<endl;
+          if (selective && wantedNames.erase(varName) == 0) break; //not wanted: on to next record
           bool isObjStruct=false;
           BaseGDL* ret = getVariable(e, xdrs, isSysVar, isObjStruct);
           if (ret == NULL)
@@ -1893,6 +2055,8 @@ enum {
     //if problem, guards should deleted the allocated BaseGDLs.
     if (SomethingFussyHappened) e->Throw("Error Reading File: " + name + ".");
     //here everything was ok
+    for (std::set<std::string>::iterator it = wantedNames.begin(); it != wantedNames.end(); ++it)
+      Message("RESTORE: Variable " + *it + " not found in " + name + ".");
 
 
 
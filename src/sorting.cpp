@@ -34,6 +34,7 @@ namespace lib {
 #define RADIX_SORT_THRESHOLD_FOR_LONG64 2000000
 #define RADIX_SORT_THRESHOLD_FOR_ULONG64 1000000
 #define MERGESORT_PARALLEL_THRESHOLD 1000000
+#define PARALLEL_SORT_MIN_ELTS 100000 //below, the parallel sorts do not pay off whatever !CPU says
 
 // The following GDL version of SORT() is a complete rewriting using modern methods for a faster sort. 
 // It provides a noticeable, sometimes even huge, speed gain, depending on array sizes and types. 
@@ -1639,6 +1640,246 @@ template <typename T, typename IndexT>
     delete[] aux;
   } 
 //--------------------------------------------------------------------------------------------------------------------
+// Parallel sorts, used by SORT() for large arrays when several threads are available (!CPU.TPOOL_NTHREADS, 
+// !CPU.TPOOL_MIN_ELTS). The sorts above only use two threads, at their top level.
+// 1) a parallel LSD radix sort of (key, index) pairs for all numeric types (complex: on the magnitude) and pointers:
+//    each pass counts the digits of each thread's chunk, then scatters the chunks in parallel, which keeps the sort stable.
+//    Floating point values are mapped to keys such that all NaNs (whatever their sign) come last and -0 equals +0,
+//    i.e. the order of the merge sorts above (the -NaN feature of RadixSort() does not apply).
+// 2) a parallel merge sort for strings: chunks sorted as above, then merged pairwise, each merge being split
+//    between all threads.
+
+  static int ParallelSortThreads(SizeT nEl)
+  {
+    if (CpuTPOOL_NTHREADS <= 1 || nEl < PARALLEL_SORT_MIN_ELTS || nEl < CpuTPOOL_MIN_ELTS ||
+      (CpuTPOOL_MAX_ELTS != 0 && CpuTPOOL_MAX_ELTS > nEl)) return 1;
+    return CpuTPOOL_NTHREADS;
+  }
+
+  // first element of chunk c of n elements in nChunks chunks
+  static inline SizeT SortChunkStart(SizeT n, int c, int nChunks)
+  {
+    return static_cast<SizeT>((static_cast<double>(n) * c) / nChunks);
+  }
+
+  // unsigned keys in the order of the values
+  template<typename T> struct RadixKey { typedef T Key; static Key Of(T v) { return v; } };
+  template<> struct RadixKey<DInt> { typedef DUInt Key; static Key Of(DInt v) { return static_cast<Key>(v) ^ 0x8000U; } };
+  template<> struct RadixKey<DLong> { typedef DULong Key; static Key Of(DLong v) { return static_cast<Key>(v) ^ 0x80000000U; } };
+  template<> struct RadixKey<DLong64> { typedef DULong64 Key; static Key Of(DLong64 v) { return static_cast<Key>(v) ^ 0x8000000000000000ULL; } };
+  template<> struct RadixKey<DFloat> {
+    typedef DULong Key;
+    static Key Of(DFloat v) {
+      if (std::isnan(v)) return 0xFFFFFFFFU;
+      if (v == 0) return 0x80000000U;
+      Key u;
+      memcpy(&u, &v, sizeof(u));
+      return (u & 0x80000000U) ? ~u : (u | 0x80000000U);
+    }
+  };
+  template<> struct RadixKey<DDouble> {
+    typedef DULong64 Key;
+    static Key Of(DDouble v) {
+      if (std::isnan(v)) return 0xFFFFFFFFFFFFFFFFULL;
+      if (v == 0) return 0x8000000000000000ULL;
+      Key u;
+      memcpy(&u, &v, sizeof(u));
+      return (u & 0x8000000000000000ULL) ? ~u : (u | 0x8000000000000000ULL);
+    }
+  };
+
+  // returns the sorted indexes (allocated with gdlAlignedMalloc, as RadixSort())
+  template<typename IndexT, typename T>
+  static IndexT* ParallelRadixSortIndex(const T* val, SizeT nEl, int nThreads)
+  {
+    typedef typename RadixKey<T>::Key Key;
+    const int nDigits = sizeof(Key);
+    Key* keyA = (Key*) gdlAlignedMalloc(nEl * sizeof(Key));
+    Key* keyB = (Key*) gdlAlignedMalloc(nEl * sizeof(Key));
+    IndexT* ixA = (IndexT*) gdlAlignedMalloc(nEl * sizeof(IndexT));
+    IndexT* ixB = (IndexT*) gdlAlignedMalloc(nEl * sizeof(IndexT));
+    if (keyA == NULL || keyB == NULL || ixA == NULL || ixB == NULL) {
+      gdlAlignedFree(keyA); gdlAlignedFree(keyB); gdlAlignedFree(ixA); gdlAlignedFree(ixB);
+      throw GDLException("Array requires more memory than available");
+    }
+
+    // counts of all digits in one pass, to skip the passes where all the keys have the same digit
+    std::vector<SizeT> count(nThreads * nDigits * 256, 0);
+#pragma omp parallel for num_threads(nThreads)
+    for (int c = 0; c < nThreads; ++c) {
+      SizeT* h = &count[c * nDigits * 256];
+      for (SizeT i = SortChunkStart(nEl, c, nThreads); i < SortChunkStart(nEl, c + 1, nThreads); ++i) {
+        Key k = RadixKey<T>::Of(val[i]);
+        keyA[i] = k;
+        ixA[i] = i;
+        for (int d = 0; d < nDigits; ++d) h[d * 256 + ((k >> (8 * d)) & 0xFF)]++;
+      }
+    }
+
+    std::vector<SizeT> offset(nThreads * 256);
+    for (int d = 0; d < nDigits; ++d) {
+      bool trivial = false;
+      for (int b = 0; b < 256 && !trivial; ++b) {
+        SizeT tot = 0;
+        for (int c = 0; c < nThreads; ++c) tot += count[(c * nDigits + d) * 256 + b];
+        trivial = (tot == nEl);
+      }
+      if (trivial) continue;
+      const int shift = 8 * d;
+      if (d > 0) { // the chunks changed since the first count
+#pragma omp parallel for num_threads(nThreads)
+        for (int c = 0; c < nThreads; ++c) {
+          SizeT* h = &count[(c * nDigits + d) * 256];
+          memset(h, 0, 256 * sizeof(SizeT));
+          for (SizeT i = SortChunkStart(nEl, c, nThreads); i < SortChunkStart(nEl, c + 1, nThreads); ++i)
+            h[(keyA[i] >> shift) & 0xFF]++;
+        }
+      }
+      // chunk c writes digit b after all smaller digits and after the chunks before it
+      SizeT pos = 0;
+      for (int b = 0; b < 256; ++b)
+        for (int c = 0; c < nThreads; ++c) {
+          offset[c * 256 + b] = pos;
+          pos += count[(c * nDigits + d) * 256 + b];
+        }
+#pragma omp parallel for num_threads(nThreads)
+      for (int c = 0; c < nThreads; ++c) {
+        SizeT* o = &offset[c * 256];
+        for (SizeT i = SortChunkStart(nEl, c, nThreads); i < SortChunkStart(nEl, c + 1, nThreads); ++i) {
+          SizeT p = o[(keyA[i] >> shift) & 0xFF]++;
+          keyB[p] = keyA[i];
+          ixB[p] = ixA[i];
+        }
+      }
+      std::swap(keyA, keyB);
+      std::swap(ixA, ixB);
+    }
+    gdlAlignedFree(keyA);
+    gdlAlignedFree(keyB);
+    gdlAlignedFree(ixB);
+    return ixA;
+  }
+
+  // stable merge of the sorted runs index[low..mid] and index[mid+1..high] into out[low..high]
+  // by all the threads: each thread computes its part of the output (merge path).
+  template<typename T, typename IndexT>
+  static void ParallelMergeIndex(T* val, const IndexT* index, IndexT* out, SizeT low, SizeT mid, SizeT high, int nThreads)
+  {
+    const IndexT* a = &index[low];
+    const IndexT* b = &index[mid + 1];
+    const SizeT na = mid - low + 1;
+    const SizeT nb = high - mid;
+    const SizeT n = na + nb;
+#pragma omp parallel for num_threads(nThreads)
+    for (int t = 0; t < nThreads; ++t) {
+      SizeT kStart = SortChunkStart(n, t, nThreads);
+      SizeT kEnd = SortChunkStart(n, t + 1, nThreads);
+      // number of elements of 'a' within the first k merged elements
+      SizeT ia[2];
+      SizeT ks[2] = {kStart, kEnd};
+      for (int s = 0; s < 2; ++s) {
+        SizeT k = ks[s];
+        SizeT lo = (k > nb) ? k - nb : 0;
+        SizeT hi = (k < na) ? k : na;
+        while (lo < hi) {
+          SizeT i = lo + (hi - lo) / 2;
+          if (!less(val[b[k - i - 1]], val[a[i]])) lo = i + 1; else hi = i;
+        }
+        ia[s] = lo;
+      }
+      SizeT i = ia[0], j = kStart - ia[0];
+      for (SizeT k = kStart; k < kEnd; ++k) {
+        if (i >= na) out[low + k] = b[j++];
+        else if (j >= nb) out[low + k] = a[i++];
+        else if (less(val[b[j]], val[a[i]])) out[low + k] = b[j++];
+        else out[low + k] = a[i++];
+      }
+    }
+  }
+
+  // index must contain 0..nEl-1 on input
+  template<typename T, typename IndexT>
+  static void ParallelMergeSortIndex(T* val, IndexT* index, SizeT nEl, int nThreads)
+  {
+    std::vector<SizeT> run(nThreads + 1);
+    for (int c = 0; c <= nThreads; ++c) run[c] = SortChunkStart(nEl, c, nThreads);
+#pragma omp parallel for num_threads(nThreads)
+    for (int c = 0; c < nThreads; ++c)
+      if (run[c + 1] > run[c]) QuickSortIndex<T, IndexT>(val, index, run[c], run[c + 1] - 1);
+
+    IndexT* aux = (IndexT*) gdlAlignedMalloc(nEl * sizeof(IndexT));
+    if (aux == NULL) throw GDLException("Array requires more memory than available");
+    IndexT* from = index;
+    IndexT* to = aux;
+    for (SizeT width = 1; width < static_cast<SizeT>(nThreads); width *= 2) {
+      for (SizeT c = 0; c < static_cast<SizeT>(nThreads); c += 2 * width) {
+        SizeT low = run[c];
+        SizeT midRun = std::min<SizeT>(c + width, nThreads);
+        SizeT highRun = std::min<SizeT>(c + 2 * width, nThreads);
+        if (run[highRun] == low) continue;
+        if (run[midRun] == low || run[midRun] == run[highRun]) // single run: copy
+          memcpy(&to[low], &from[low], (run[highRun] - low) * sizeof(IndexT));
+        else
+          ParallelMergeIndex(val, from, to, low, run[midRun] - 1, run[highRun] - 1, nThreads);
+      }
+      std::swap(from, to);
+    }
+    if (from != index) memcpy(index, from, nEl * sizeof(IndexT));
+    gdlAlignedFree(aux);
+  }
+
+  template<typename GDLIndexT, typename IndexT, typename T>
+  static GDLIndexT* ParallelRadixSortResult(const T* val, SizeT nEl, int nThreads)
+  {
+    GDLIndexT* res = new GDLIndexT(dimension(nEl), BaseGDL::NOALLOC);
+    res->SetBuffer(ParallelRadixSortIndex<IndexT>(val, nEl, nThreads));
+    res->SetBufferSize(nEl);
+    res->SetDim(dimension(nEl));
+    return res;
+  }
+
+  // NULL if the type is not handled here
+  template<typename GDLIndexT, typename IndexT>
+  static BaseGDL* do_parallel_sort_fun(BaseGDL* p0, int nThreads)
+  {
+    SizeT nEl = p0->N_Elements();
+    switch (p0->Type()) {
+    case GDL_BYTE: return ParallelRadixSortResult<GDLIndexT, IndexT>((DByte*) p0->DataAddr(), nEl, nThreads);
+    case GDL_INT: return ParallelRadixSortResult<GDLIndexT, IndexT>((DInt*) p0->DataAddr(), nEl, nThreads);
+    case GDL_UINT: return ParallelRadixSortResult<GDLIndexT, IndexT>((DUInt*) p0->DataAddr(), nEl, nThreads);
+    case GDL_LONG: return ParallelRadixSortResult<GDLIndexT, IndexT>((DLong*) p0->DataAddr(), nEl, nThreads);
+    case GDL_ULONG: return ParallelRadixSortResult<GDLIndexT, IndexT>((DULong*) p0->DataAddr(), nEl, nThreads);
+    case GDL_LONG64: return ParallelRadixSortResult<GDLIndexT, IndexT>((DLong64*) p0->DataAddr(), nEl, nThreads);
+    case GDL_ULONG64: return ParallelRadixSortResult<GDLIndexT, IndexT>((DULong64*) p0->DataAddr(), nEl, nThreads);
+    case GDL_FLOAT: return ParallelRadixSortResult<GDLIndexT, IndexT>((DFloat*) p0->DataAddr(), nEl, nThreads);
+    case GDL_DOUBLE: return ParallelRadixSortResult<GDLIndexT, IndexT>((DDouble*) p0->DataAddr(), nEl, nThreads);
+    case GDL_PTR: return ParallelRadixSortResult<GDLIndexT, IndexT>((DPtr*) p0->DataAddr(), nEl, nThreads);
+    case GDL_OBJ: return ParallelRadixSortResult<GDLIndexT, IndexT>((DObj*) p0->DataAddr(), nEl, nThreads);
+    case GDL_COMPLEX: {
+      DComplex* ff = (DComplex*) p0->DataAddr();
+      std::vector<DFloat> magnitude(nEl);
+#pragma omp parallel for num_threads(nThreads)
+      for (OMPInt i = 0; i < nEl; ++i) magnitude[i] = std::norm(ff[i]);
+      return ParallelRadixSortResult<GDLIndexT, IndexT>(&magnitude[0], nEl, nThreads);
+    }
+    case GDL_COMPLEXDBL: {
+      DComplexDbl* ff = (DComplexDbl*) p0->DataAddr();
+      std::vector<DDouble> magnitude(nEl);
+#pragma omp parallel for num_threads(nThreads)
+      for (OMPInt i = 0; i < nEl; ++i) magnitude[i] = std::norm(ff[i]);
+      return ParallelRadixSortResult<GDLIndexT, IndexT>(&magnitude[0], nEl, nThreads);
+    }
+    case GDL_STRING: {
+      DString* val = (DString*) p0->DataAddr();
+      GDLIndexT* res = new GDLIndexT(dimension(nEl), BaseGDL::INDGEN);
+      ParallelMergeSortIndex(val, static_cast<IndexT*> (res->DataAddr()), nEl, nThreads);
+      return res;
+    }
+    default: return NULL;
+    }
+  }
+
+//--------------------------------------------------------------------------------------------------------------------
 // Sorting algos: The "private" GDL_SORT enables keywords QUICK,MERGE,RADIX,INSERT. Those are not there to for the user
 // to choose the algo (s)he wants. They are primarily to test the relative speed of each of them and find, for a given machine,
 // where the default algorithm, that is basically a clever combinaison of all of them, should switch from algo to algo
@@ -1927,6 +2168,11 @@ template <typename T, typename IndexT>
   inline BaseGDL* do_sort_fun(BaseGDL* p0)
   {
     SizeT nEl = p0->N_Elements();
+    int nThreads = ParallelSortThreads(nEl);
+    if (nThreads > 1) {
+      BaseGDL* res = do_parallel_sort_fun<GDLIndexT, IndexT>(p0, nThreads);
+      if (res != NULL) return res;
+    }
     if (p0->Type() == GDL_BYTE) { //lack of 'res' creation overhead makes "Bytes Radix Sort" better than anything else.
       DByte* val = (DByte*)(static_cast<DByteGDL*>(p0)->DataAddr());
       GDLIndexT* res = new GDLIndexT(dimension(nEl), BaseGDL::NOALLOC);
@@ -40,6 +40,7 @@
 
 #include "str.hpp"
 #include "gdlexception.hpp"
+#include "fmtnum.hpp" // ScanDouble, ScanLong
 #include "initsysvar.hpp" // GDLPath();
 namespace lib {
   std::string PathSeparator()
@@ -247,7 +248,14 @@ void StrLowCaseInplace(std::string& s)
 // however, it is done only, if strtod stops at a 'd' or 'D' character 
 double StrToD( const char* cStart, char** cEnd)
 {
-  double ret = strtod( cStart, cEnd);
+  double ret;
+  const char* fastEnd;
+  if( ScanDouble( cStart, ret, &fastEnd, true))
+    {
+      if( cEnd != NULL) *cEnd = const_cast<char*>( fastEnd);
+      return ret;
+    }
+  ret = strtod( cStart, cEnd);
   if( cEnd != NULL && (**cEnd == 'd' || **cEnd == 'D'))
     {
       int dPos = *cEnd - cStart;      
@@ -276,8 +284,11 @@ double StrToD( const char* cStart, char** cEnd)
 }
 double Str2D( const char* cStart)
 {
+  double ret;
+  const char* fastEnd;
+  if( ScanDouble( cStart, ret, &fastEnd, false)) return ret;
   char* cEnd;
-  double ret = strtod( cStart, &cEnd);
+  ret = strtod( cStart, &cEnd);
   if( cEnd == cStart)
     {
       Warning("Type conversion error: "
@@ -287,8 +298,11 @@ double Str2D( const char* cStart)
 }
 long int Str2L( const char* cStart, int base)
 {
+  long int ret;
+  const char* fastEnd;
+  if( base == 10 && ScanLong( cStart, ret, &fastEnd)) return ret;
   char* cEnd;
-  long int ret = strtol( cStart, &cEnd, base);
+  ret = strtol( cStart, &cEnd, base);
   if( cEnd == cStart)
     {
       Warning("Type conversion error: "
@@ -470,6 +484,97 @@ std::string FullPathFileName(std::string in_file)
 // GDL> HELP, /source  ou HELP, /traceback
 // GDL> print, ROUTINE_INFO('dist',/function,/source)
 
+#ifndef _MSC_VER
+#include <dirent.h>
+#include <sys/stat.h>
+#include <ctime>
+#include <unordered_map>
+
+// listing of the !PATH directories: file name -> first directory containing it
+// taken once per !PATH value, so that resolving a name costs a hash lookup
+// instead of one fopen() per directory.
+// The listing is revalidated once per pass (see NewPathListingPass()): if
+// a directory was modified (its mtime changed) since the listing was
+// taken, it is taken again. Within a pass, hits and misses are answered
+// from the listing alone.
+namespace {
+  StrArr pathListed;
+  std::vector<time_t> pathListedMTime;
+  time_t pathListedTime;
+  std::unordered_map<std::string, SizeT> pathListing;
+  bool pathListingValid = false;
+  SizeT pathListingPass = 0;      // current pass
+  SizeT pathListingCheckedPass = 0; // pass the listing was last validated in
+
+  time_t DirMTime( const std::string& dir)
+  {
+    struct stat st;
+    if( stat( dir.c_str(), &st) != 0) return 0;
+    return st.st_mtime;
+  }
+
+  void ListPath( const StrArr& path)
+  {
+    pathListing.clear();
+    pathListedTime = time( NULL);
+    pathListedMTime.resize( path.size());
+    for( SizeT p=0; p<path.size(); ++p)
+      {
+	pathListedMTime[p] = DirMTime( path[p]);
+	DIR* dir = opendir( path[p].c_str());
+	if( dir == NULL) continue;
+	struct dirent* entry;
+	while( (entry = readdir( dir)) != NULL)
+	  pathListing.insert( std::make_pair( std::string( entry->d_name), p)); // first wins
+	closedir( dir);
+      }
+    pathListed = path;
+    pathListingValid = true;
+    pathListingCheckedPass = pathListingPass;
+  }
+
+  // true if a directory changed since the listing
+  bool PathListingOutdated()
+  {
+    for( SizeT p=0; p<pathListed.size(); ++p)
+      {
+	time_t mTime = DirMTime( pathListed[p]);
+	if( mTime != pathListedMTime[p]) return true;
+	// mtime has a resolution of one second: a change later within the
+	// second the listing was taken cannot be told apart. An mtime after
+	// that second (in the future, e.g. clock skew) is not a change as
+	// long as it stays the same.
+	if( mTime == pathListedTime) return true;
+      }
+    return false;
+  }
+
+  // returns the index into path of the directory containing fn, -1 if none
+  long FindInPathListing( const StrArr& path, const std::string& fn)
+  {
+    if( !pathListingValid || path != pathListed)
+      ListPath( path);
+    else if( pathListingCheckedPass != pathListingPass)
+      {
+	if( PathListingOutdated())
+	  ListPath( path);
+	else
+	  pathListingCheckedPass = pathListingPass;
+      }
+    std::unordered_map<std::string, SizeT>::const_iterator it = pathListing.find( fn);
+    if( it == pathListing.end()) return -1;
+    return it->second;
+  }
+}
+#endif
+
+void NewPathListingPass()
+{
+#ifndef _MSC_VER
+  ++pathListingPass;
+#endif
+}
+
 bool CompleteFileName(std::string& fn)
 {
   WordExp( fn);
@@ -505,6 +610,25 @@ bool CompleteFileName(std::string& fn)
     }
   }
   else
+  {
+#ifndef _MSC_VER
+    long listed = FindInPathListing( path, fn);
+    if( listed >= 0)
+      {
+	std::string act=path[listed];
+	AppendIfNeeded(act,lib::PathSeparator());
+	act=act+fn;
+	fp = fopen(act.c_str(),"r");
+	if(fp) {
+	  fclose(fp);
+	  fn=FullPathFileName(act);
+	  return true;
+	}
+	pathListingValid = false; // removed since the listing was taken
+      }
+    else
+      return false;
+#endif
     for(unsigned p=0; p<path.size(); p++)
       {
 	std::string act=path[p];
@@ -522,8 +646,12 @@ bool CompleteFileName(std::string& fn)
 	  fclose(fp);
 	  fn=act;
 	  fn=FullPathFileName(fn);
+#ifndef _MSC_VER
+	  pathListingValid = false; // listing is outdated
+#endif
 	  return true;
 	}
       }
+  }
   return false;
 }
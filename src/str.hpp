@@ -57,6 +57,10 @@ void WordExp( std::string& s);
 // and returns true, else false
 // If fn starts with '/' or ".." or "./", just checks it is readable.
 bool CompleteFileName(std::string& fn);
+// CompleteFileName() revalidates its listing of the !PATH directories at
+// most once per pass: a new pass starts with each command line and with
+// explicit requests like RESOLVE_ROUTINE
+void NewPathListingPass();
 
 // Strip whitespace from the start and end of a string.
 inline void StrTrim(std::string& s)
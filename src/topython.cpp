@@ -40,7 +40,7 @@ const int pyType[] = {
   NPY_COMPLEX128,  //GDL_COMPLEXDBL,	
   NPY_NOTYPE,        //GDL_PTR***		
   NPY_NOTYPE,        //GDL_OBJ***
-  NPY_UINT32,     //GDL_UINT*
+  NPY_UINT16,     //GDL_UINT*
   NPY_UINT32,     //GDL_ULONG*
   NPY_INT64,      //GDL_LONG64*
   NPY_UINT64      //GDL_ULONG64*
@@ -78,6 +78,44 @@ PyObject* Data_<Sp>::ToPython()
   return ret;
 }
 
+// capsule owning a GDL variable which data a NumPy array views
+static const char* gdlDataCapsule = "GDL.data";
+
+static void DeleteGDLCapsule( PyObject* capsule)
+{
+  delete static_cast<BaseGDL*>( PyCapsule_GetPointer( capsule, gdlDataCapsule));
+}
+
+// hands 'var' over to python without copying its data: the returned NumPy
+// array views them and owns 'var' (deleted with the array). For values GDL
+// discards anyway (function results, output arguments to python).
+// Returns NULL (and 'var' is still owned by the caller) if 'var' does
+// not convert to a NumPy array, ToPython() must be used then.
+PyObject* GiveToPython( BaseGDL* var)
+{
+  if( var->N_Elements() <= 1 || var->Type() >= sizeof( pyType) / sizeof( int))
+    return NULL;
+  const int item_type = pyType[ var->Type()];
+  if( item_type == NPY_NOTYPE)
+    return NULL;
+
+  int n_dim = var->Rank();
+  npy_intp dimArr[MAXRANK];
+  for( int i=0; i<n_dim; ++i) dimArr[i]=var->Dim(i);
+
+  PyObject* ret = PyArray_SimpleNewFromData( n_dim, dimArr, item_type, var->DataAddr());
+  if( ret == NULL)
+    return NULL;
+  PyObject* capsule = PyCapsule_New( var, gdlDataCapsule, DeleteGDLCapsule);
+  if( capsule == NULL)
+    {
+      Py_DECREF( ret);
+      return NULL;
+    }
+  PyArray_SetBaseObject( reinterpret_cast<PyArrayObject*>( ret), capsule); // steals capsule
+  return ret;
+}
+
 template < typename Sp>
 PyObject* Data_<Sp>::ToPythonScalar()
 {
@@ -199,6 +199,11 @@ extern DLong CpuHW_NCPU;
 extern DLong CpuTPOOL_NTHREADS;
 extern DLong64 CpuTPOOL_MIN_ELTS;
 extern DLong64 CpuTPOOL_MAX_ELTS;
+// per operation class thresholds: cheap element-wise operations
+// (arithmetic, comparison, copy, conversion) and expensive ones
+// (power, exponential, logarithm, trigonometric)
+extern DLong64 CpuTPOOL_MIN_ELTS_ARITH;
+extern DLong64 CpuTPOOL_MIN_ELTS_TRANSC;
 
 // convert something to string
 template <typename T>
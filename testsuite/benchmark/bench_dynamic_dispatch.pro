@@ -0,0 +1,96 @@
+;
+; Micro-benchmark of the dynamic dispatch cost:
+; CALL_FUNCTION, CALL_PROCEDURE and EXECUTE on a library of
+; many compiled user routines (name lookup in the routine tables)
+;
+; BENCH_DYNAMIC_DISPATCH, nb_routines=2000, nb_calls=100000
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written when the routine tables
+;   got a hashed name index
+;
+; --------------------------------------------------------------
+;
+pro BENCH_DYNAMIC_DISPATCH, nb_routines=nb_routines, nb_calls=nb_calls, $
+                            keep=keep, verbose=verbose, test=test, help=help
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro BENCH_DYNAMIC_DISPATCH, nb_routines=nb_routines, nb_calls=nb_calls, $'
+   print, '                            keep=keep, verbose=verbose, test=test, help=help'
+   return
+endif
+;
+if (N_ELEMENTS(nb_routines) EQ 0) then nb_routines=2000
+if (N_ELEMENTS(nb_calls) EQ 0) then nb_calls=100000L
+;
+; generating the routines in a temporary directory
+;
+tmpdir=FILEPATH('bench_dispatch_'+STRTRIM(STRING(SYSTIME(/seconds), format='(I12)'),2), /tmp)
+FILE_MKDIR, tmpdir
+;
+names=STRING(LINDGEN(nb_routines), format='("BDD_",I6.6)')
+for ii=0L, nb_routines-1 do begin
+   OPENW, lun, FILEPATH(STRLOWCASE(names[ii])+'_f.pro', root=tmpdir), /get_lun
+   PRINTF, lun, 'function '+names[ii]+'_F, x'
+   PRINTF, lun, 'return, x+1'
+   PRINTF, lun, 'end'
+   FREE_LUN, lun
+   OPENW, lun, FILEPATH(STRLOWCASE(names[ii])+'_p.pro', root=tmpdir), /get_lun
+   PRINTF, lun, 'pro '+names[ii]+'_P, x'
+   PRINTF, lun, 'x=x+1'
+   PRINTF, lun, 'end'
+   FREE_LUN, lun
+endfor
+;
+old_path=!PATH
+!PATH=tmpdir+PATH_SEP(/search_path)+!PATH
+;
+time0=SYSTIME(1)
+RESOLVE_ROUTINE, names+'_F', /is_function, /compile_full_file, /no_recompile, /quiet
+RESOLVE_ROUTINE, names+'_P', /compile_full_file, /no_recompile, /quiet
+time_compile=SYSTIME(1)-time0
+;
+; calls spread over the whole table (worst case for a linear search)
+;
+idx=LINDGEN(nb_calls) MOD nb_routines
+fnames=names[idx]+'_F'
+pnames=names[idx]+'_P'
+;
+x=0L
+time0=SYSTIME(1)
+for ii=0L, nb_calls-1 do x=CALL_FUNCTION(fnames[ii], x)
+time_call_function=SYSTIME(1)-time0
+;
+x=0L
+time0=SYSTIME(1)
+for ii=0L, nb_calls-1 do CALL_PROCEDURE, pnames[ii], x
+time_call_procedure=SYSTIME(1)-time0
+;
+; built-in functions (library table)
+;
+lnames=(['SIN','COS','ABS','SQRT','EXP','FLOAT','LONG','FIX'])[LINDGEN(nb_calls) MOD 8]
+time0=SYSTIME(1)
+for ii=0L, nb_calls-1 do y=CALL_FUNCTION(lnames[ii], 1.)
+time_call_libfunction=SYSTIME(1)-time0
+;
+nb_exec=nb_calls/10
+x=0L
+time0=SYSTIME(1)
+for ii=0L, nb_exec-1 do r=EXECUTE('x='+fnames[ii]+'(x)')
+time_execute=SYSTIME(1)-time0
+;
+!PATH=old_path
+if ~KEYWORD_SET(keep) then FILE_DELETE, tmpdir, /recursive, /quiet
+;
+print, 'Routines : ', nb_routines, ' functions + ', nb_routines, ' procedures'
+print, 'Compiling               : ', time_compile, ' s'
+print, 'CALL_FUNCTION   [us/call]: ', 1e6*time_call_function/nb_calls
+print, 'CALL_PROCEDURE  [us/call]: ', 1e6*time_call_procedure/nb_calls
+print, 'CALL_FUNCTION (lib) [us/call]: ', 1e6*time_call_libfunction/nb_calls
+print, 'EXECUTE         [us/call]: ', 1e6*time_execute/nb_exec
+;
+if KEYWORD_SET(test) then STOP
+;
+end
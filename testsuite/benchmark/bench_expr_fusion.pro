@@ -0,0 +1,54 @@
+;
+; Micro-benchmark of elementwise expressions on large arrays, to be run
+; with and without the environment variable GDL_EXPR_FUSION set
+;
+; BENCH_EXPR_FUSION, nb_elts=1e7
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written with the fused evaluation
+;
+; --------------------------------------------------------------
+;
+pro BENCH_EXPR_FUSION, nb_elts=nb_elts, double=double, nb_loops=nb_loops, $
+                       times=times, test=test, help=help
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro BENCH_EXPR_FUSION, nb_elts=nb_elts, double=double, nb_loops=nb_loops, $'
+   print, '                       times=times, test=test, help=help'
+   return
+endif
+;
+if (N_ELEMENTS(nb_elts) EQ 0) then nb_elts=10000000L
+if (N_ELEMENTS(nb_loops) EQ 0) then nb_loops=5
+;
+a=RANDOMU(seed, nb_elts, double=double)
+b=RANDOMU(seed, nb_elts, double=double)
+c=RANDOMU(seed, nb_elts, double=double)
+d=RANDOMU(seed, nb_elts, double=double)
+;
+names=['a*b+c*d', 'a*b + c*exp(-d)', '(2*a-b/3)*!pi', 'sqrt(a*a+b*b)']
+times=FLTARR(N_ELEMENTS(names))
+;
+time0=SYSTIME(1)
+for ii=1, nb_loops do r=a*b+c*d
+times[0]=(SYSTIME(1)-time0)/nb_loops
+time0=SYSTIME(1)
+for ii=1, nb_loops do r=a*b + c*EXP(-d)
+times[1]=(SYSTIME(1)-time0)/nb_loops
+time0=SYSTIME(1)
+for ii=1, nb_loops do r=(2*a-b/3)*!pi
+times[2]=(SYSTIME(1)-time0)/nb_loops
+time0=SYSTIME(1)
+for ii=1, nb_loops do r=SQRT(a*a+b*b)
+times[3]=(SYSTIME(1)-time0)/nb_loops
+;
+fused=GETENV('GDL_EXPR_FUSION') NE ''
+print, 'Elements : ', nb_elts, (fused ? '   (fused)' : '   (not fused)'), '     [ms]'
+for ii=0, N_ELEMENTS(names)-1 do $
+   print, FORMAT='(A-22,F12.2)', names[ii], 1e3*times[ii]
+;
+if KEYWORD_SET(test) then STOP
+;
+end
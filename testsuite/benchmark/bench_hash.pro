@@ -0,0 +1,71 @@
+;
+; Micro-benchmark of HASH/ORDEREDHASH: insert, lookup (scalar and
+; vectorized) and iterate throughput, for string and numeric keys
+;
+; BENCH_HASH, nb_keys=100000
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written when HASH got a native
+;   key index
+;
+; --------------------------------------------------------------
+;
+pro BENCH_HASH_ONE, h, keys, name, times
+;
+nb_keys=N_ELEMENTS(keys)
+;
+time0=SYSTIME(1)
+for ii=0L, nb_keys-1 do h[keys[ii]]=ii
+t_insert=SYSTIME(1)-time0
+;
+idx=LONG(RANDOMU(seed, nb_keys)*nb_keys)
+time0=SYSTIME(1)
+for ii=0L, nb_keys-1 do x=h[keys[idx[ii]]]
+t_lookup=SYSTIME(1)-time0
+;
+time0=SYSTIME(1)
+sub=h[keys[idx]]
+t_multi=SYSTIME(1)-time0
+;
+time0=SYSTIME(1)
+total=0L
+foreach value, h do total+=value
+t_iterate=SYSTIME(1)-time0
+;
+print, FORMAT='(A-22,4F14.3)', name, $
+       1e6*[t_insert, t_lookup, t_multi, t_iterate]/nb_keys
+res=[t_insert, t_lookup, t_multi, t_iterate]
+if N_ELEMENTS(times) EQ 0 then times=res else times=[[times], [res]]
+;
+end
+;
+; --------------------------------------------------------------
+;
+pro BENCH_HASH, nb_keys=nb_keys, times=times, test=test, help=help
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro BENCH_HASH, nb_keys=nb_keys, times=times, test=test, help=help'
+   return
+endif
+;
+if (N_ELEMENTS(nb_keys) EQ 0) then nb_keys=100000L
+;
+skeys='key_'+STRTRIM(STRING(LINDGEN(nb_keys)),2)
+lkeys=LINDGEN(nb_keys)*7L
+dkeys=DINDGEN(nb_keys)/3.
+;
+print, 'Keys : ', nb_keys, '     [us/key]'
+print, FORMAT='(A-22,4A14)', '', 'insert', 'lookup', 'lookup[keys]', 'iterate'
+;
+times=!null
+BENCH_HASH_ONE, HASH(), skeys, 'HASH, string', times
+BENCH_HASH_ONE, HASH(/fold_case), skeys, 'HASH, string, fold', times
+BENCH_HASH_ONE, HASH(), lkeys, 'HASH, long', times
+BENCH_HASH_ONE, HASH(), dkeys, 'HASH, double', times
+BENCH_HASH_ONE, ORDEREDHASH(), skeys, 'ORDEREDHASH, string', times
+;
+if KEYWORD_SET(test) then STOP
+;
+end
@@ -5,6 +5,7 @@
 ; and adjust the combination of all these methods that makes for the performance in the final sort().
 ; With a modicum of work, this could be used to fine-tune the SORT() method for a particular machine or purpose,
 ; maintaining top performances in specific cases (clusters etc).
+; compare_sort_algos,/scaling reports the strong scaling of SORT() with the number of threads instead.
 
 
 function gdl_sort
@@ -142,8 +143,48 @@ pro do_compare_sort_algos, zerotime=zerotime, check=check, variant=variant
   endelse
   if (isgdl and ~runnull) then plot_sort_algos, variant=variant; final plot
 end
-pro compare_sort_algos, check=check, variant=variant
+;
+; strong scaling of SORT(): same arrays, 1, 2, 4 ... !CPU.HW_NCPU threads
+; (large arrays are sorted by the parallel radix sort, or merge sort for strings)
+;
+pro sort_strong_scaling, nbps=nbps, ntrials=ntrials, check=check
+  if (n_elements(nbps) eq 0) then nbps=1E7
+  if (n_elements(ntrials) eq 0) then ntrials=3
+  if (n_elements(check) eq 0) then check=0
+  cpu_save=!CPU
+  nthreads=[1]
+  while (2*nthreads[-1] le !CPU.HW_NCPU) do nthreads=[nthreads,2*nthreads[-1]]
+  if (nthreads[-1] lt !CPU.HW_NCPU) then nthreads=[nthreads,!CPU.HW_NCPU]
+
+  val=randomn(seed,nbps)
+  arrays=list(byte(val*40), long(val*1E6), long64(val*1E12), val, double(val), complex(val,val), string(long(val*1E4)))
+  names=['byte','long','long64','float','double','complex','string']
+
+  print,'SORT() strong scaling, '+strtrim(long64(nbps),2)+' elements, time in s (speedup)'
+  print,'threads',nthreads,format='(a10,'+strtrim(n_elements(nthreads),2)+'i16)'
+  for k=0,n_elements(names)-1 do begin
+     a=arrays[k]
+     times=dblarr(n_elements(nthreads))
+     for m=0,n_elements(nthreads)-1 do begin
+        cpu,tpool_nthreads=nthreads[m],tpool_min_elts=100000
+        t=tic() & for i=1,ntrials do b=sort(a) & times[m]=toc(t)/ntrials
+        if (check) then begin
+           s=(names[k] eq 'complex')?abs(a[b]):a[b]
+           if total(s[1:*] lt s) gt 0 then message,/info,"sort() invalid for "+names[k]+" and "+strtrim(nthreads[m],2)+" threads"
+        endif
+     endfor
+     print,names[k],string(times,format='(f8.4)')+' ('+string(times[0]/times,format='(f5.1)')+')',$
+           format='(a10,'+strtrim(n_elements(nthreads),2)+'a16)'
+  endfor
+  cpu,restore=cpu_save
+end
+
+pro compare_sort_algos, check=check, variant=variant, scaling=scaling
   forward_function gdl_sort
+  if keyword_set(scaling) then begin ; only the strong scaling report
+     sort_strong_scaling, check=check
+     return
+  endif
   do_compare_sort_algos, zerotime=zerotime; initialize zerotime with empty for loops
   do_compare_sort_algos, zerotime=zerotime, check=check, variant=variant ; the real job, removing the zerotime at the end.
 end
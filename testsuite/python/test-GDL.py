@@ -81,7 +81,7 @@ def test_function_user():
     numpy.arange(0, 259, dtype=numpy.uint8),
     numpy.arange(-255, 259, dtype=numpy.int16),
     # numpy.arange(-255, 255, dtype=numpy.int8), # GDL Error: unknown return array type
-    # numpy.arange(0, 259, dtype=numpy.uint16), # GDL Error: unknown return array type
+    numpy.arange(0, 259, dtype=numpy.uint16),
     numpy.arange(-255, 259, dtype=numpy.int32),
     numpy.arange(0, 259, dtype=numpy.uint32),
     numpy.arange(-1, 1., 0.1, dtype=float),
@@ -105,6 +105,64 @@ def test_function_arg_pass_return(arg):
         assert numpy.all(GDL.function(name, arg) == arg)
 
 
+@pytest.mark.parametrize('zero_copy', [False, True])
+@pytest.mark.parametrize('n', [259, 300000])
+@pytest.mark.parametrize('dtype', [numpy.uint16, numpy.float32, numpy.float64])
+def test_array_round_trip(dtype, n, zero_copy):
+    '''Pass arrays to GDL and back, copied and (for the large ones with
+    GDL.zero_copy(True)) used in place'''
+
+    code = '''
+    function ARRAY_ROUND_TRIP, arg
+      return, arg
+    end
+    '''
+    with GDLFile(code) as name:
+        previous = GDL.zero_copy(zero_copy)
+        try:
+            arg = numpy.arange(n).astype(dtype)
+            expected = numpy.copy(arg)
+            ret = GDL.function(name, arg)
+            # the result is a view of GDL data: still valid after more calls
+            GDL.function(name, numpy.ones(n, dtype=dtype))
+            assert ret.dtype == expected.dtype
+            assert ret.shape == expected.shape
+            assert numpy.array_equal(ret, expected)
+            assert numpy.array_equal(arg, expected)
+        finally:
+            GDL.zero_copy(previous)
+
+
+def test_zero_copy_adopted_array():
+    '''A NumPy array used in place by GDL stays valid when python drops
+    its reference'''
+
+    code = '''
+    function KEEP_ADOPTED_ARRAY, arg
+      common keep_adopted_array, kept
+      if N_ELEMENTS(arg) gt 0 then kept = TEMPORARY(arg)
+      return, TOTAL(kept, /double)
+    end
+    '''
+    import gc
+    n = 300000
+    with GDLFile(code) as name:
+        previous = GDL.zero_copy(True)
+        try:
+            arg = numpy.arange(n, dtype=numpy.float64)
+            expected = numpy.sum(arg)
+            # a tuple: local variable in GDL, not copied back
+            assert GDL.function(name, (arg,)) == expected
+            del arg
+            gc.collect()
+            # reuse the freed python memory
+            scratch = [numpy.full(n, -1.0) for i in range(4)]
+            assert GDL.function(name) == expected
+            del scratch
+        finally:
+            GDL.zero_copy(previous)
+
+
 def test_pro_internal():
     '''Call the internal setenv procedure'''
     
@@ -0,0 +1,73 @@
+;
+; - 2026-10-16 : the per operation class thresholds of CPU
+;   (TPOOL_MIN_ELTS_ARITH, TPOOL_MIN_ELTS_TRANSC), their interplay with
+;   TPOOL_MIN_ELTS, /RESET, RESTORE= and /CALIBRATE
+;
+pro TEST_CPU, no_exit=no_exit, test=test
+;
+total_errors=0
+saved=!CPU
+;
+; the defaults
+CPU, /reset
+defaults=!CPU
+if defaults.tpool_min_elts_arith le 0 then ERRORS_ADD, total_errors, 'default ARITH'
+if defaults.tpool_min_elts_transc le 0 then ERRORS_ADD, total_errors, 'default TRANSC'
+;
+; each keyword alone, read back from !CPU
+CPU, tpool_min_elts_arith=12345
+if !CPU.tpool_min_elts_arith ne 12345 then ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS_ARITH'
+if !CPU.tpool_min_elts_transc ne defaults.tpool_min_elts_transc then $
+   ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS_ARITH changed TRANSC'
+CPU, tpool_min_elts_transc=678
+if !CPU.tpool_min_elts_transc ne 678 then ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS_TRANSC'
+if !CPU.tpool_min_elts_arith ne 12345 then $
+   ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS_TRANSC changed ARITH'
+;
+; TPOOL_MIN_ELTS sets both, a class keyword given as well wins for its class
+CPU, tpool_min_elts=5000
+if !CPU.tpool_min_elts ne 5000 then ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS'
+if !CPU.tpool_min_elts_arith ne 5000 then ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS -> ARITH'
+if !CPU.tpool_min_elts_transc ne 5000 then ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS -> TRANSC'
+CPU, tpool_min_elts=7000, tpool_min_elts_arith=100
+if !CPU.tpool_min_elts_arith ne 100 then ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS with ARITH'
+if !CPU.tpool_min_elts_transc ne 7000 then ERRORS_ADD, total_errors, 'TPOOL_MIN_ELTS with ARITH -> TRANSC'
+;
+; /RESET restores the defaults
+CPU, /reset
+if !CPU.tpool_min_elts ne defaults.tpool_min_elts then ERRORS_ADD, total_errors, '/RESET: TPOOL_MIN_ELTS'
+if !CPU.tpool_min_elts_arith ne defaults.tpool_min_elts_arith then ERRORS_ADD, total_errors, '/RESET: ARITH'
+if !CPU.tpool_min_elts_transc ne defaults.tpool_min_elts_transc then ERRORS_ADD, total_errors, '/RESET: TRANSC'
+;
+; RESTORE= brings back a saved state
+state=!CPU
+state.tpool_min_elts_arith=4321
+state.tpool_min_elts_transc=321
+CPU, restore=state
+if !CPU.tpool_min_elts_arith ne 4321 then ERRORS_ADD, total_errors, 'RESTORE: ARITH'
+if !CPU.tpool_min_elts_transc ne 321 then ERRORS_ADD, total_errors, 'RESTORE: TRANSC'
+;
+; /CALIBRATE and RESTORE= conflict (and nothing is changed)
+caught=0
+CATCH, err
+if err EQ 0 then CPU, /calibrate, restore=defaults else caught=1
+CATCH, /cancel
+if ~caught then ERRORS_ADD, total_errors, '/CALIBRATE with RESTORE: no error'
+if !CPU.tpool_min_elts_arith ne 4321 then ERRORS_ADD, total_errors, '/CALIBRATE with RESTORE: changed ARITH'
+;
+; /CALIBRATE measures new defaults and applies them
+CPU, /calibrate
+if !CPU.tpool_min_elts_arith le 0 then ERRORS_ADD, total_errors, '/CALIBRATE: ARITH'
+if !CPU.tpool_min_elts_transc le 0 then ERRORS_ADD, total_errors, '/CALIBRATE: TRANSC'
+;
+CPU, restore=saved
+;
+; final message
+;
+BANNER_FOR_TESTSUITE, 'TEST_CPU', total_errors
+;
+if KEYWORD_SET(test) then STOP
+;
+if (total_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+end
@@ -0,0 +1,163 @@
+;
+; Elementwise expressions on large FLOAT/DOUBLE arrays may be evaluated
+; in a single fused pass (CPU, EXPR_FUSION=1): the results (values, type
+; and dimensions) must be exactly those of the step by step evaluation.
+; All the cases are run with and without fusion.
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written with the fused evaluation
+; * 2026-10-16 : fusion switched on and off by CPU, EXPR_FUSION=
+;
+; --------------------------------------------------------------
+;
+pro CHECK_FUSED, nb_errors, res, expected, name
+;
+if (SIZE(res, /type) NE SIZE(expected, /type)) then begin
+   ERRORS_ADD, nb_errors, name+': bad type'
+   return
+endif
+if ~ARRAY_EQUAL(SIZE(res, /dim), SIZE(expected, /dim)) then begin
+   ERRORS_ADD, nb_errors, name+': bad dimensions'
+   return
+endif
+if ~ARRAY_EQUAL(res, expected) then ERRORS_ADD, nb_errors, name+': bad values'
+;
+end
+;
+; --------------------------------------------------------------
+;
+pro TEST_EXPR_FUSION_CASES, nb_errors
+;
+n=10000L
+;
+a=FINDGEN(n)/100.
+b=1.5+FINDGEN(n)
+c=0.3*FINDGEN(n)
+d=FINDGEN(n)*1e-4
+;
+; the example from the request
+t1=a*b & t2=-d & t3=EXP(t2) & t4=c*t3
+CHECK_FUSED, nb_errors, a*b + c*EXP(-d), t1+t4, 'a*b + c*exp(-d)'
+;
+t1=ABS(a-b) & t2=SQRT(t1) & t3=ALOG(b) & t4=t3/2
+CHECK_FUSED, nb_errors, SQRT(ABS(a-b)) - ALOG(b)/2, t2-t4, 'sqrt/abs/alog'
+;
+t1=SIN(a) & t2=COS(c) & t3=t1*t2 & t4=TAN(d) & t5=ALOG10(b)
+CHECK_FUSED, nb_errors, SIN(a)*COS(c) + TAN(d) - ALOG10(b), t3+t4-t5, 'trigonometric'
+;
+; scalars, integer scalars and system variables
+t1=2*a & t2=b/3 & t3=t1-t2 & t4=t3*!pi
+CHECK_FUSED, nb_errors, (2*a - b/3)*!pi, t4, 'scalar operands'
+;
+; double precision, and FLOAT operands promoted at first use
+x=DINDGEN(n)/7d
+t1=x*x & t2=a*t1 & t3=1d + t2
+CHECK_FUSED, nb_errors, 1d + a*(x*x), t3, 'float promoted to double'
+;
+t1=a*b & t2=t1+x
+CHECK_FUSED, nb_errors, a*b + x, t2, 'float subexpression in double'
+;
+t1=SIN(a) & t2=t1*x & t3=t2-1
+CHECK_FUSED, nb_errors, SIN(a)*x - 1, t3, 'float function in double'
+;
+; integer operands
+l=LINDGEN(n)
+t1=l*a & t2=t1+b
+CHECK_FUSED, nb_errors, l*a + b, t2, 'long array operand'
+;
+i=INTARR(n)+300S
+t1=i*i & t2=t1+a & t3=t2*b
+CHECK_FUSED, nb_errors, (i*i + a)*b, t3, 'integer subexpression (overflow)'
+;
+t1=SIN(l) & t2=t1*b & t3=t2+c
+CHECK_FUSED, nb_errors, SIN(l)*b + c, t3, 'function of a long array'
+;
+; dimensions: those of the first array operand
+a2=REFORM(a, 100, 100)
+t1=b*c & t2=a2+t1
+CHECK_FUSED, nb_errors, a2 + b*c, t2, 'first operand 2D'
+t1=b*c & t2=t1+a2
+CHECK_FUSED, nb_errors, b*c + a2, t2, 'first operand 1D'
+t1=3*a2 & t2=t1*b & t3=t2-c
+CHECK_FUSED, nb_errors, 3*a2*b - c, t3, 'scalar first, then 2D'
+;
+; non conformable arrays: the shorter one wins
+s=a[0:99]
+t1=s*b & t2=t1+c
+CHECK_FUSED, nb_errors, s*b + c, t2, 'different sizes'
+;
+; one element arrays are not scalars
+one=[2.]
+t1=one*a & t2=t1+b
+CHECK_FUSED, nb_errors, one*a + b, t2, 'one element array'
+;
+; special values
+z=FLTARR(n)
+t1=(a+1)/z & t2=t1-b
+CHECK_FUSED, nb_errors, (a+1)/z - b, t2, 'division by zero'
+r=ALOG(-b) + SQRT(-b)
+if (SIZE(r, /type) NE 4) OR (TOTAL(FINITE(r, /nan)) NE n) then $
+   ERRORS_ADD, nb_errors, 'NaN'
+;
+; inside loops (the variables change their type and size)
+for k=0, 2 do begin
+   case k of
+      0: v=a
+      1: v=x
+      2: v=l
+   endcase
+   t1=v*v & t2=t1+b
+   CHECK_FUSED, nb_errors, v*v + b, t2, 'loop '+STRTRIM(k,2)
+endfor
+;
+; undefined operands must still report the error
+caught=0
+CATCH, err
+if err EQ 0 then begin
+   r=a*b + undefined_variable*c
+endif else caught=1
+CATCH, /cancel
+if ~caught then ERRORS_ADD, nb_errors, 'undefined operand not reported'
+;
+end
+;
+; --------------------------------------------------------------
+;
+pro TEST_EXPR_FUSION, help=help, verbose=verbose, short=short, $
+                      no_exit=no_exit, test=test
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro TEST_EXPR_FUSION, help=help, verbose=verbose, short=short, $'
+   print, '                      no_exit=no_exit, test=test'
+   return
+endif
+;
+nb_errors=0
+;
+; the fused and the unfused evaluation must agree
+n=10000L
+a=FINDGEN(n)/100.
+x=DINDGEN(n)/7d
+CPU, expr_fusion=1
+fused1=a*a + SIN(a)*EXP(-a)
+fused2=SQRT(ABS(a-x)) / (1 + x*a)
+CPU, expr_fusion=0
+CHECK_FUSED, nb_errors, a*a + SIN(a)*EXP(-a), fused1, 'fused/unfused FLOAT'
+CHECK_FUSED, nb_errors, SQRT(ABS(a-x)) / (1 + x*a), fused2, 'fused/unfused DOUBLE'
+;
+CPU, expr_fusion=1
+TEST_EXPR_FUSION_CASES, nb_errors
+CPU, expr_fusion=0
+TEST_EXPR_FUSION_CASES, nb_errors
+;
+; ----------------- final messages ----------
+;
+BANNER_FOR_TESTSUITE, 'TEST_EXPR_FUSION', nb_errors, short=short
+;
+if (nb_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+if KEYWORD_SET(test) then STOP
+;
+end
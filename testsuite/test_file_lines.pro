@@ -1,9 +1,67 @@
+;
+; - 2026-10-16 : end of line conventions, compressed files, several
+;   files at once and files larger than the read buffer (4 MB)
+;
+pro WRITE_BYTES_FOR_FILE_LINES, filename, bytes, compress=compress
+OPENW, lun, filename, /get_lun, compress=compress
+if N_ELEMENTS(bytes) GT 0 then WRITEU, lun, bytes
+FREE_LUN, lun
+end
+;
 PRO test_file_lines, no_exit=no_exit
 total_errors=0
 filesw = file_which("swap_endian.pro")
 if file_lines(filesw) ne 96 then total_errors++
 if file_lines(filesw,/compress) ne 96 then total_errors++
 ;
+; LF, CR and CRLF end a line, a last line without end of line counts
+lf=10b & cr=13b & x=BYTE('x')
+contents=LIST([x,lf,x,lf], [x,cr,x,cr], [x,cr,lf,x,cr,lf], [x,lf,x], $
+              [lf,lf,cr,cr,lf], [x], [cr,lf,cr])
+expected=[2, 2, 2, 2, 4, 1, 2]
+files=STRARR(contents.Count()+1)
+for i=0, contents.Count()-1 do begin
+   files[i]=FILEPATH('test_file_lines_'+STRTRIM(i,2)+'.txt', /tmp)
+   WRITE_BYTES_FOR_FILE_LINES, files[i], contents[i]
+endfor
+; an empty file has one line
+files[contents.Count()]=FILEPATH('test_file_lines_empty.txt', /tmp)
+WRITE_BYTES_FOR_FILE_LINES, files[contents.Count()]
+expected=[expected, 1]
+;
+for i=0, N_ELEMENTS(files)-1 do $
+   if FILE_LINES(files[i]) ne expected[i] then total_errors++
+; several files at once (counted concurrently), same dimensions
+res=FILE_LINES(REFORM(files, 2, 4))
+if ~ARRAY_EQUAL(res, REFORM(expected, 2, 4)) then total_errors++
+;
+; compressed
+gzfile=FILEPATH('test_file_lines.txt.gz', /tmp)
+WRITE_BYTES_FOR_FILE_LINES, gzfile, [x,cr,lf,x,cr,x,lf,x], /compress
+if FILE_LINES(gzfile, /compress) ne 4 then total_errors++
+;
+; larger than the read buffer, with a CRLF across its end
+big=REPLICATE(x, 5L*1024*1024)
+big[LINDGEN(5*1024)*1024+1023]=lf
+big[4L*1024*1024-1]=cr
+big[4L*1024*1024]=lf
+bigfile=FILEPATH('test_file_lines_big.txt', /tmp)
+WRITE_BYTES_FOR_FILE_LINES, bigfile, big
+if FILE_LINES(bigfile) ne 5*1024 then total_errors++
+WRITE_BYTES_FOR_FILE_LINES, gzfile, big, /compress
+if FILE_LINES(gzfile, /compress) ne 5*1024 then total_errors++
+;
+; non existing file
+caught=0
+CATCH, err
+if err EQ 0 then begin
+   n=FILE_LINES([files[0], FILEPATH('test_file_lines_none.txt', /tmp)])
+endif else caught=1
+CATCH, /cancel
+if ~caught then total_errors++
+;
+FILE_DELETE, files, gzfile, bigfile
+;
 ; final message
 ;
 BANNER_FOR_TESTSUITE, 'TEST_FILE_LINES', total_errors, short=short
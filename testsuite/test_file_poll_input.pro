@@ -0,0 +1,118 @@
+;
+; - 2026-10-16 : FILE_POLL_INPUT on file units (with and without
+;   TIMEOUT), and on a socket connected to a local server (if python3
+;   is available to run it): polling, READU and EOF
+;
+; a server on 127.0.0.1 which writes its port to 'portfile', accepts one
+; connection, sends 1000 bytes after 'delay' seconds and closes
+pro WRITE_SERVER_FOR_FILE_POLL_INPUT, script
+OPENW, lun, script, /get_lun
+PRINTF, lun, format='(A)', $
+   ['import os, socket, sys, time', $
+    'portfile, delay = sys.argv[1], float(sys.argv[2])', $
+    's = socket.socket(socket.AF_INET, socket.SOCK_STREAM)', $
+    's.bind(("127.0.0.1", 0))', $
+    's.listen(1)', $
+    's.settimeout(30)', $
+    'with open(portfile + ".tmp", "w") as f: f.write(str(s.getsockname()[1]))', $
+    'os.rename(portfile + ".tmp", portfile)', $
+    'c, a = s.accept()', $
+    'time.sleep(delay)', $
+    'c.sendall(bytes(i % 256 for i in range(1000)))', $
+    'time.sleep(0.5)', $
+    'c.close()', $
+    's.close()']
+FREE_LUN, lun
+end
+;
+pro TEST_FILE_POLL_INPUT_SOCKET, total_errors
+;
+if !version.os_family eq 'Windows' then return
+SPAWN, 'python3 -c "pass"', exit_status=status
+if status ne 0 then begin
+   MESSAGE, /continue, 'python3 not available: socket test skipped'
+   return
+endif
+;
+script=FILEPATH('test_file_poll_input_server.py', /tmp)
+portfile=FILEPATH('test_file_poll_input.port', /tmp)
+FILE_DELETE, portfile, /allow_nonexistent
+WRITE_SERVER_FOR_FILE_POLL_INPUT, script
+SPAWN, 'python3 '+script+' '+portfile+' 2 > /dev/null 2>&1 &'
+;
+for k=0,100 do begin
+   if FILE_TEST(portfile) then break
+   WAIT, 0.1
+endfor
+if ~FILE_TEST(portfile) then begin
+   ERRORS_ADD, total_errors, 'socket: server not started'
+   FILE_DELETE, script
+   return
+endif
+port=0L
+OPENR, lun, portfile, /get_lun
+READF, lun, port
+FREE_LUN, lun
+;
+SOCKET, lun, '127.0.0.1', port, /get_lun, connect_timeout=10, read_timeout=10
+;
+; the server waits 2 seconds before sending
+if FILE_POLL_INPUT(lun) then ERRORS_ADD, total_errors, 'socket: input before sending'
+t0=SYSTIME(1)
+if FILE_POLL_INPUT(lun, timeout=0.3) then ERRORS_ADD, total_errors, 'socket: input before sending (timeout)'
+if SYSTIME(1)-t0 lt 0.25 then ERRORS_ADD, total_errors, 'socket: TIMEOUT not waited for'
+if ~FILE_POLL_INPUT(lun, timeout=20) then ERRORS_ADD, total_errors, 'socket: no input'
+;
+b=BYTARR(1000)
+READU, lun, b
+if ~ARRAY_EQUAL(b, BYTE(LINDGEN(1000) mod 256)) then ERRORS_ADD, total_errors, 'socket: READU'
+;
+; the end of the connection is input too
+if ~FILE_POLL_INPUT(lun, timeout=20) then ERRORS_ADD, total_errors, 'socket: no end of connection'
+if ~EOF(lun) then ERRORS_ADD, total_errors, 'socket: EOF'
+FREE_LUN, lun
+;
+FILE_DELETE, script, portfile, /allow_nonexistent
+end
+;
+pro TEST_FILE_POLL_INPUT, no_exit=no_exit, test=test
+;
+total_errors=0
+;
+; files always have input (even at their end)
+file=FILEPATH('test_file_poll_input.txt', /tmp)
+OPENW, lun, file, /get_lun
+PRINTF, lun, 'a line'
+FREE_LUN, lun
+;
+OPENR, lun, file, /get_lun
+if FILE_POLL_INPUT(lun) ne 1 then ERRORS_ADD, total_errors, 'file'
+t0=SYSTIME(1)
+if FILE_POLL_INPUT(lun, timeout=5) ne 1 then ERRORS_ADD, total_errors, 'file: TIMEOUT'
+if SYSTIME(1)-t0 gt 2 then ERRORS_ADD, total_errors, 'file: TIMEOUT waited for'
+line=''
+READF, lun, line
+if FILE_POLL_INPUT(lun, timeout=1) ne 1 then ERRORS_ADD, total_errors, 'file: at the end'
+FREE_LUN, lun
+FILE_DELETE, file
+;
+if FILE_POLL_INPUT(0) ne 1 then ERRORS_ADD, total_errors, 'stdin'
+;
+; a closed unit
+caught=0
+CATCH, err
+if err EQ 0 then dummy=FILE_POLL_INPUT(lun) else caught=1
+CATCH, /cancel
+if ~caught then ERRORS_ADD, total_errors, 'closed unit'
+;
+TEST_FILE_POLL_INPUT_SOCKET, total_errors
+;
+; final message
+;
+BANNER_FOR_TESTSUITE, 'TEST_FILE_POLL_INPUT', total_errors
+;
+if KEYWORD_SET(test) then STOP
+;
+if (total_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+end
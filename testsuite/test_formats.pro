@@ -16,6 +16,9 @@
 ; Changes: 
 ; 2016-01612 : AC various changes for better managing paths,
 ;              expecially for Cmake automatic tests !
+; 2026-10-16 : every format code through the format cache and the
+;              flattened output program compared with FMTOut
+;              (CPU, FORMAT_CACHE=0)
 ;
 ; md5sum of current version of "formats.IDL" (-1 et 12 ...)
 ; 9f26db168d3d4d304db8651e5ef1d5d1  formats.IDL
@@ -133,6 +136,218 @@ end
 ;
 ; ------------------------------------------------------------
 ;
+; the same format strings used many times (parsed formats are cached):
+; every use must give the same result, whatever was used in between
+;
+pro TEST_FORMATS_REPEATED, nb_errors, test=test
+;
+fmts=['(I5)', '(2(F6.2,:,","))', '(A,1X,3(I2,"-"))', '("x=",E10.3)', $
+      '(G0.4)', '(%"%d and %s")', '(C(CYI4,"/",CMOI2.2))']
+vals=LIST(42, [1.5,2.25,3.25,4.,5.5], ['a','b'], !dpi, 1d-7, 3, 2451545.0d)
+args=LIST(!NULL, !NULL, [1,2,3,4,5,6,7], !NULL, !NULL, 'three', !NULL)
+;
+first=STRARR(N_ELEMENTS(fmts))
+for pass=0, 2 do begin
+   for i=0, N_ELEMENTS(fmts)-1 do begin
+      if N_ELEMENTS(args[i]) gt 0 then s=STRING(vals[i], args[i], FORMAT=fmts[i]) $
+      else s=STRING(vals[i], FORMAT=fmts[i])
+      s=STRJOIN(s, '|')
+      if pass eq 0 then first[i]=s else if s ne first[i] then begin
+         if KEYWORD_SET(test) then print, fmts[i], ': <', first[i], '> <', s, '>'
+         nb_errors++
+      endif
+   endfor
+   ; other formats in between
+   dummy=STRING(FINDGEN(3), FORMAT='(3F4.1)')
+endfor
+;
+; expected results (reversion, colon, C-style, nested groups)
+if first[0] ne '   42' then nb_errors++
+if first[1] ne '  1.50,  2.25,|  3.25,  4.00,|  5.50' then nb_errors++
+if first[5] ne '3 and three' then nb_errors++
+if first[6] ne '2000/01' then nb_errors++
+; an invalid format is not cached: it must fail every time
+for pass=0, 1 do begin
+   CATCH, err
+   if err eq 0 then begin
+      dummy=STRING(1, FORMAT='(I5')
+      nb_errors++
+   endif
+   CATCH, /CANCEL
+endfor
+;
+end
+;
+; ------------------------------------------------------------
+;
+; the output of one format for the arguments in the LIST 'args', as one
+; string (lines separated by '|'), or the error message
+;
+function FORMATS_ALL_CODES_OUT, fmt, args
+;
+CATCH, err
+if err ne 0 then begin
+   CATCH, /CANCEL
+   return, 'error: '+!ERROR_STATE.MSG
+endif
+case N_ELEMENTS(args) of
+   1: s=STRING(args[0], FORMAT=fmt)
+   2: s=STRING(args[0], args[1], FORMAT=fmt)
+   3: s=STRING(args[0], args[1], args[2], FORMAT=fmt)
+   4: s=STRING(args[0], args[1], args[2], args[3], FORMAT=fmt)
+endcase
+return, STRJOIN(s, '|')
+end
+;
+function FORMATS_ALL_CODES_FILE, filename
+;
+lines=STRARR(FILE_LINES(filename))
+OPENR, lun, filename, /GET_LUN
+READF, lun, lines
+FREE_LUN, lun
+return, lines
+end
+;
+; every format code, through the cached formats and the flattened output
+; program (FMTProgram) and through the format tree interpreter (FMTOut,
+; with CPU, FORMAT_CACHE=0, which parses each format anew): the output
+; must be the same
+;
+pro TEST_FORMATS_ALL_CODES, nb_errors, test=test
+;
+jd=JULDAY(3, 14, 2015, 9, 26, 53.5d)
+fmts=LIST()
+vals=LIST()
+; F, D, E, G with widths, precisions, flags, NaN and Inf
+fmts.Add, '(F8.3,F0.2,F+9.1,F-9.1,F09.2)'
+vals.Add, LIST([1.5, -2.25, 1e6, !values.f_nan, -!values.f_infinity])
+fmts.Add, '(D12.4,D0,D+15.7)'
+vals.Add, LIST(DINDGEN(6)*1.1d3-2.5)
+fmts.Add, '(3E12.4,E0,E+10.2,E-14.3,E014.3)'
+vals.Add, LIST([1d-300, -0.0125d, 6.02d23, 1d, -1d100, !values.d_nan, 42d])
+fmts.Add, '(G12.5,G0,G+10.3,G-12.4,G0.4,G15.8)'
+vals.Add, LIST([0.001d, 12345678d, -0.5d, 1d10, 100d, !dpi])
+; I, Z, O, B (minimum digits, left, sign, zero padding)
+fmts.Add, '(I5.3,I-6,I+6,I06,I0,I3)'
+vals.Add, LIST([-3, 7, 12, -45, 1234567, 123456])
+fmts.Add, '(Z8.4,Z,Z-6,Z06,O6,O0,O-8.4,O08)'
+vals.Add, LIST([255L, 4096, -1, 8, 64, 511, 9, 10])
+fmts.Add, '(B12.10,B0,B-10,B08)'
+vals.Add, LIST([5, 1023, 6, 3])
+fmts.Add, '(I4,Z4,O4,B8)'
+vals.Add, LIST(BYTE([200, 201, 202, 203]))
+fmts.Add, '(I22,I0,Z18)'
+vals.Add, LIST([-9223372036854775807LL, 1LL, -2LL])
+; A, X, T, TL, TR, quoted strings, /
+fmts.Add, '(A5,A-6,A,A0)'
+vals.Add, LIST(['abcdefg', 'xy', 'z', 'last'])
+fmts.Add, '(I3,5X,I3,T2,"|",TL1,"<",TR3,">")'
+vals.Add, LIST(1, 2)
+fmts.Add, '("[",A,"]",2X,I2,T12,F4.1,TL8,"^")'
+vals.Add, LIST('text', 9, 2.5)
+fmts.Add, '(2F6.1,/,I3,/)'
+vals.Add, LIST([1.5, 2.5], 3)
+; $ (no new line) and : (end of output if no data left)
+fmts.Add, '(I4,$)'
+vals.Add, LIST(7)
+fmts.Add, '("a",2(I2,:,"b"),:,"c")'
+vals.Add, LIST([1, 2, 3])
+fmts.Add, '("a",2(I2,:,"b"),:,"c")'
+vals.Add, LIST(1)
+fmts.Add, '(3(I2,:,","))'
+vals.Add, LIST(INDGEN(7))
+; nested groups, repeat counts and format reversion
+fmts.Add, '(2(I2,3(F5.1,:),"/"))'
+vals.Add, LIST(FINDGEN(17))
+fmts.Add, '(I3,2(2(A2,"."),I1))'
+vals.Add, LIST(5, ['ab', 'cd', 'ef', 'gh'], [1, 2], 'xx')
+fmts.Add, '(2(2(2(I1))),"|")'
+vals.Add, LIST(INDGEN(20))
+; complex
+fmts.Add, '(2F8.3,2E11.3)'
+vals.Add, LIST(COMPLEX(1.5, -2), DCOMPLEX(3d-5, 4d5))
+; C-style formats
+fmts.Add, '(%"%5.2f|%-4d|%x|%o|%s|%e|%g|%%")'
+vals.Add, LIST(1.234, 5, 255, 'q')
+; C() calendar codes
+fmts.Add, '(C(CYI4,"-",CMOI2.2,"-",CDI2.2,X,CHI2.2,":",CMI2.2,":",CSF05.2))'
+vals.Add, LIST(jd)
+fmts.Add, '(C(CMoA,X,CDwA,X,CapA,X,CHI,X,CMoa,X,CDwa))'
+vals.Add, LIST(jd)
+fmts.Add, '(C())'
+vals.Add, LIST([jd, jd+100.25d])
+;
+n=N_ELEMENTS(fmts)
+cached=STRARR(n)
+CPU, format_cache=1
+for pass=0, 1 do for i=0, n-1 do cached[i]=FORMATS_ALL_CODES_OUT(fmts[i], vals[i])
+CPU, format_cache=0
+for i=0, n-1 do begin
+   ref=FORMATS_ALL_CODES_OUT(fmts[i], vals[i])
+   if ref ne cached[i] then begin
+      if KEYWORD_SET(test) then print, fmts[i], ': <', cached[i], '> <', ref, '>'
+      nb_errors++
+   endif
+endfor
+;
+; PRINTF (with $) and the formats of GENERATE_FORMATS_FILE, to files
+for cache=0, 1 do begin
+   CPU, format_cache=cache
+   filename='formats_all_codes.'+STRTRIM(cache, 2)
+   OPENW, lun, filename, /GET_LUN
+   for i=0, n-1 do begin
+      PRINTF, lun, 17, FORMAT='(I4,$)'
+      PRINTF, lun, fmts[i], FORMAT='(A)'
+   endfor
+   PRINTF, lun, 1.5, 2, FORMAT='(F5.2,$,I3)'
+   PRINTF, lun, 'end'
+   FREE_LUN, lun
+   GENERATE_FORMATS_FILE, nb_cases
+   FILE_COPY, 'formats.'+GDL_IDL_FL(), 'formats_generated.'+STRTRIM(cache, 2), /overwrite
+endfor
+CPU, format_cache=1
+for k=0, 1 do begin
+   names=(['formats_all_codes.', 'formats_generated.'])[k]+['0', '1']
+   ref=FORMATS_ALL_CODES_FILE(names[0])
+   out=FORMATS_ALL_CODES_FILE(names[1])
+   if ~ARRAY_EQUAL(ref, out) then begin
+      if KEYWORD_SET(test) then print, 'differences in: ', names
+      nb_errors++
+   endif
+   FILE_DELETE, names
+endfor
+;
+end
+;
+; ------------------------------------------------------------
+;
+; many values in one format item (formatted in parallel blocks):
+; the values must come out complete and in order
+;
+pro TEST_FORMATS_LARGE, nb_errors, test=test
+;
+n=300000L
+idx=[0, 1, 99999, 100000, 150001, n-1]
+;
+s=STRING(LINDGEN(n)-5, FORMAT='('+STRTRIM(n,2)+'I8)')
+if STRLEN(s) ne 8*n then nb_errors++
+if ~ARRAY_EQUAL(LONG(STRMID(s, 8*idx, 8)), idx-5) then nb_errors++
+;
+s=STRING(FINDGEN(n)/8., FORMAT='('+STRTRIM(n,2)+'F12.3)')
+if STRLEN(s) ne 12*n then nb_errors++
+if ~ARRAY_EQUAL(STRMID(s, 12*idx, 12), STRING(idx/8., FORMAT='(F12.3)')) then nb_errors++
+;
+s=STRING(-DINDGEN(n)*1d5, FORMAT='('+STRTRIM(n,2)+'E15.6)')
+if STRLEN(s) ne 15*n then nb_errors++
+if ~ARRAY_EQUAL(DOUBLE(STRMID(s, 15*idx, 15)), -idx*1d5) then nb_errors++
+;
+s=STRING(LINDGEN(n), FORMAT='('+STRTRIM(n,2)+'Z6.4)')
+if ~ARRAY_EQUAL(STRMID(s, 6*idx, 6), STRING(idx, FORMAT='(Z6.4)')) then nb_errors++
+;
+end
+;
+; ------------------------------------------------------------
+;
 ; This code can be used in 3 softs : IDL, GDL, FL
 ; if IDL, it is used to generate the reference
 ;
@@ -244,6 +459,10 @@ endfor
 CLOSE, lun1, lun2
 FREE_LUN, lun1, lun2
 ;
+TEST_FORMATS_REPEATED, nb_errors, test=test
+TEST_FORMATS_ALL_CODES, nb_errors, test=test
+TEST_FORMATS_LARGE, nb_errors, test=test
+;
 ; ----------------- final message ----------
 ;
 BANNER_FOR_TESTSUITE, 'TEST_FORMATS', nb_errors;, short=short
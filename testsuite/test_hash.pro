@@ -169,6 +169,37 @@ scalars[allkeys]=allkeys.toarray()
 if KEYWORD_SET(verbose) then $
     foreach value, scalars, key do print," key:",key," =",value
 ;
+; larger hashes are looked up through a native key index, which must
+; follow insertions, removals and table growth
+;
+nb=1000
+skeys='k'+STRTRIM(SINDGEN(nb),2)
+big=HASH()
+for ii=0, nb-1 do big[skeys[ii]]=ii
+for ii=0, nb-1, 3 do big.remove, skeys[ii]
+bad=0
+for ii=0, nb-1 do begin
+   if (ii MOD 3) EQ 0 then bad+=big.HasKey(skeys[ii]) $
+   else if big[skeys[ii]] NE ii then bad++
+endfor
+if bad NE 0 then ERRORS_ADD, nb_errors, 'large HASH: lookups after remove'
+sub=big[skeys[1:*:3]]
+if (sub.count() NE N_ELEMENTS(skeys[1:*:3])) then $
+   ERRORS_ADD, nb_errors, 'large HASH: multi-key lookup'
+bad=0
+foreach value, sub, key do if value NE LONG(STRMID(key,1)) then bad++
+if bad NE 0 then ERRORS_ADD, nb_errors, 'large HASH: multi-key values'
+if ~ARRAY_EQUAL(big.HasKey(['k1','k3','k4','nokey']), [1,0,1,0]) then $
+   ERRORS_ADD, nb_errors, 'large HASH: HasKey on array'
+;
+nkeys=HASH(LINDGEN(nb), LINDGEN(nb)*2)
+if (nkeys[500] NE 1000) OR (nkeys[500.0] NE 1000) OR (nkeys[100b] NE 200) then $
+   ERRORS_ADD, nb_errors, 'large HASH: numeric keys'
+;
+fold=HASH(skeys, LINDGEN(nb), /fold_case)
+if (fold['K999'] NE 999) OR ~fold.HasKey('K1') then $
+   ERRORS_ADD, nb_errors, 'large HASH: fold_case'
+;
 ; ----------------- final messages ----------
 ;
 BANNER_FOR_TESTSUITE, 'TEST_HASH', nb_errors, short=short
@@ -287,6 +287,97 @@ end
 ;
 ; -----------------------------------------------
 ;
+;
+; hyperslab selection by the H5D_READ keywords (GDL extension), compared
+; to the subscripted full dataset
+;
+pro TEST_HDF5_HYPERSLAB, cumul_errors, test=test
+;
+errors=0
+;
+file='hdf5-data-test.h5'
+fullfile=FILE_SEARCH_FOR_TESTSUITE(file, /warning)
+if (STRLEN(fullfile) EQ 0) then begin
+    cumul_errors++
+    return
+endif
+;
+f_id = H5F_OPEN(fullfile)
+;
+; dset-03 is a [5,4,3] dataset
+d_id = H5D_OPEN(f_id, 'dset-03', chunk_cache_size=1024L^2)
+full = H5D_READ(d_id)
+;
+res = H5D_READ(d_id, start=[1,2,0], count=[3,2,3])
+if ~ARRAY_EQUAL(res, full[1:3,2:3,*]) || $
+   ~ARRAY_EQUAL(SIZE(res,/dim), [3,2,3]) then begin
+    MESSAGE, /continue, 'Bad START/COUNT hyperslab ...'
+    errors++
+endif
+;
+res = H5D_READ(d_id, start=[0,1,1], stride=[2,2,1])
+if ~ARRAY_EQUAL(res, full[0:*:2,1:*:2,1:*]) || $
+   ~ARRAY_EQUAL(SIZE(res,/dim), [3,2,2]) then begin
+    MESSAGE, /continue, 'Bad START/STRIDE hyperslab ...'
+    errors++
+endif
+;
+; blocks of 2 elements every 3 along the first dimension
+res = H5D_READ(d_id, count=[2,4,3], stride=[3,1,1], block=[2,1,1])
+if ~ARRAY_EQUAL(res, full[[0,1,3,4],*,*]) then begin
+    MESSAGE, /continue, 'Bad BLOCK hyperslab ...'
+    errors++
+endif
+if (TYPENAME(res) NE TYPENAME(full)) then begin
+    MESSAGE, /continue, 'Bad TYPE ...'
+    errors++
+endif
+;
+; a single block needs no STRIDE
+res = H5D_READ(d_id, start=[1,2,0], count=[1,1,1], block=[3,2,3])
+if ~ARRAY_EQUAL(res, full[1:3,2:3,*]) then begin
+    MESSAGE, /continue, 'Bad single BLOCK hyperslab ...'
+    errors++
+endif
+;
+; without STRIDE the blocks are adjacent
+res = H5D_READ(d_id, block=[2,2,3])
+if ~ARRAY_EQUAL(res, full[0:3,0:3,*]) then begin
+    MESSAGE, /continue, 'Bad adjacent BLOCK hyperslab ...'
+    errors++
+endif
+;
+; selections outside the dataset must be refused
+ok=EXECUTE('res = H5D_READ(d_id, start=[4,0,0], count=[2,1,1])')
+if ok then begin
+    MESSAGE, /continue, 'Hyperslab outside the dataset not refused ...'
+    errors++
+endif
+H5D_CLOSE, d_id
+;
+; dset-06 is a [5,4] dataset of [3] arrays: the elements are read whole
+d_id = H5D_OPEN(f_id, 'dset-06')
+full = H5D_READ(d_id)
+res = H5D_READ(d_id, start=[2,1], count=[2,3])
+if ~ARRAY_EQUAL(res, full[*,2:3,1:3]) then begin
+    MESSAGE, /continue, 'Bad hyperslab of an array dataset ...'
+    errors++
+endif
+H5D_CLOSE, d_id
+;
+H5F_CLOSE, f_id
+;
+BANNER_FOR_TESTSUITE, 'TEST_HDF5_HYPERSLAB', errors, /short
+;
+if KEYWORD_SET(test) then STOP
+;
+if ~ISA(cumul_errors) then cumul_errors=0
+cumul_errors=cumul_errors+errors
+;
+end
+;
+; -----------------------------------------------
+;
 pro TEST_HDF5, help=help, test=test, no_exit=no_exit
 ;
 if KEYWORD_SET(help) then begin
@@ -317,6 +408,8 @@ TEST_HDF5_ATTR, cumul_errors
 ;
 TEST_HDF5_DATA, cumul_errors
 ;
+TEST_HDF5_HYPERSLAB, cumul_errors
+;
 BANNER_FOR_TESTSUITE, 'TEST_HDF5', cumul_errors
 ;
 if (cumul_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
@@ -0,0 +1,60 @@
+;
+; HIST_ND (native since 2026; formerly hist_nd.pro).
+; See also test_hist_2d.pro
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written with the native HIST_ND
+;
+; --------------------------------------------------------------
+;
+pro TEST_HIST_ND, help=help, verbose=verbose, short=short, $
+                  no_exit=no_exit, test=test
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro TEST_HIST_ND, help=help, verbose=verbose, short=short, $'
+   print, '                  no_exit=no_exit, test=test'
+   return
+endif
+;
+nb_errors=0
+;
+v=[[0.5,0.5],[1.5,0.5],[1.5,1.5],[1.5,1.5]]
+h=HIST_ND(v, 1, min=0, max=1.99, reverse_indices=ri)
+if ~ARRAY_EQUAL(SIZE(h, /dim), [2,2]) then ERRORS_ADD, nb_errors, 'dimensions'
+if ~ARRAY_EQUAL(h, [[1,1],[0,2]]) then ERRORS_ADD, nb_errors, 'counts'
+if ~ARRAY_EQUAL(ri, [5,6,7,7,9,0,1,2,3]) then ERRORS_ADD, nb_errors, 'reverse indices'
+;
+; points out of [min, max] are not counted
+h=HIST_ND(v, 1, min=1, max=1.99)
+if ~ARRAY_EQUAL(h, 2) then ERRORS_ADD, nb_errors, 'range'
+;
+; NBINS instead of the bin size
+h=HIST_ND(v, nbins=2, min=0, max=2)
+if ~ARRAY_EQUAL(h, [[1,1],[0,2]]) then ERRORS_ADD, nb_errors, 'NBINS'
+;
+; one dimension: as HISTOGRAM
+v=REFORM(FINDGEN(100) MOD 10, 1, 100)
+if ~ARRAY_EQUAL(HIST_ND(v, 1), HISTOGRAM(v, binsize=1)) then ERRORS_ADD, nb_errors, '1D'
+;
+; large (threaded) 3D input against HISTOGRAM of the bin numbers
+CPU, TPOOL_MIN_ELTS=1000
+v=FLOAT(FIX(RANDOMU(seed, 3, 100000)*10))
+h=HIST_ND(v, 1, reverse_indices=ri)
+ix=LONG(v[0,*] + 10*(v[1,*] + 10*v[2,*]))
+hh=HISTOGRAM(ix, min=0, max=999, reverse_indices=rri)
+if ~ARRAY_EQUAL(SIZE(h, /dim), [10,10,10]) then ERRORS_ADD, nb_errors, 'large: dimensions'
+if ~ARRAY_EQUAL(h, REFORM(hh, 10, 10, 10)) then ERRORS_ADD, nb_errors, 'large: counts'
+if ~ARRAY_EQUAL(ri, rri) then ERRORS_ADD, nb_errors, 'large: reverse indices'
+CPU, /RESET
+;
+; ----------------- final messages ----------
+;
+BANNER_FOR_TESTSUITE, 'TEST_HIST_ND', nb_errors, short=short
+;
+if (nb_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+if KEYWORD_SET(test) then STOP
+;
+end
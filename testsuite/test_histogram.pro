@@ -0,0 +1,123 @@
+;
+; HISTOGRAM and its REVERSE_INDICES, on all real types, with and
+; without threads (the counting is done with per thread histograms,
+; and with a lookup table of the bins for integer data).
+; See also test_histo.pro
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written with the native HISTOGRAM
+;
+; --------------------------------------------------------------
+;
+; the indices of each bin must be in increasing order, and in the bin
+;
+pro CHECK_REVERSE_INDICES, nb_errors, data, h, ri, mini, binsize, name
+;
+nbins=N_ELEMENTS(h)
+if (ri[0] NE nbins+1) OR (N_ELEMENTS(ri) NE nbins+1+TOTAL(h, /int)) then begin
+   ERRORS_ADD, nb_errors, name+': bad reverse indices size'
+   return
+endif
+if ~ARRAY_EQUAL(ri[1:nbins]-ri[0:nbins-1], h) then begin
+   ERRORS_ADD, nb_errors, name+': bad reverse indices offsets'
+   return
+endif
+for i=0, nbins-1 do begin
+   if h[i] EQ 0 then continue
+   ix=ri[ri[i]:ri[i+1]-1]
+   if (h[i] GT 1) then if ~ARRAY_EQUAL(ix[1:*] GT ix[0:h[i]-2], 1) then begin
+      ERRORS_ADD, nb_errors, name+': reverse indices not sorted'
+      return
+   endif
+   if ~ARRAY_EQUAL(FLOOR((data[ix]-mini)/binsize), i) then begin
+      ERRORS_ADD, nb_errors, name+': reverse indices in the wrong bin'
+      return
+   endif
+endfor
+;
+end
+;
+; --------------------------------------------------------------
+;
+pro TEST_HISTOGRAM, help=help, verbose=verbose, short=short, $
+                    no_exit=no_exit, test=test
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro TEST_HISTOGRAM, help=help, verbose=verbose, short=short, $'
+   print, '                    no_exit=no_exit, test=test'
+   return
+endif
+;
+nb_errors=0
+;
+; small cases
+;
+h=HISTOGRAM([0,1,1,3,3,3], reverse_indices=ri)
+if ~ARRAY_EQUAL(h, [1,2,0,3]) then ERRORS_ADD, nb_errors, 'small: counts'
+if ~ARRAY_EQUAL(ri, [5,6,8,8,11,0,1,2,3,4,5]) then ERRORS_ADD, nb_errors, 'small: reverse indices'
+;
+h=HISTOGRAM(BYTE([0,1,255]), reverse_indices=ri)
+if (N_ELEMENTS(h) NE 256) OR (h[0] NE 1) OR (h[255] NE 1) then ERRORS_ADD, nb_errors, 'byte'
+;
+; values above MAX are not counted, neither in the reverse indices
+h=HISTOGRAM([0.,0.5,1.,1.5,2.], binsize=1, min=0, max=1.2, reverse_indices=ri)
+if ~ARRAY_EQUAL(h, [2,2]) then ERRORS_ADD, nb_errors, 'MAX: counts'
+if ~ARRAY_EQUAL(ri, [3,5,7,0,1,2,3]) then ERRORS_ADD, nb_errors, 'MAX: reverse indices'
+;
+; NaN are never counted
+h=HISTOGRAM([1.,!values.f_nan,2.,!values.f_nan,3.], /nan, reverse_indices=ri)
+if ~ARRAY_EQUAL(h, [1,1,1]) then ERRORS_ADD, nb_errors, 'NaN: counts'
+if ~ARRAY_EQUAL(ri, [4,5,6,7,0,2,4]) then ERRORS_ADD, nb_errors, 'NaN: reverse indices'
+;
+h=HISTOGRAM([1,2,2], input=[10,20])
+if ~ARRAY_EQUAL(h, [11,22]) then ERRORS_ADD, nb_errors, 'INPUT'
+;
+; all (real) types, single threaded and threaded
+;
+n=200000L
+seed=1
+; integer values: the bins of binsize 1 and 7 are exact
+raw=LONG(RANDOMU(seed, n)*1000)-3
+types=[1,2,3,4,5,12,13,14,15]
+for pass=0, 1 do begin
+   if pass EQ 1 then CPU, TPOOL_MIN_ELTS=1000, TPOOL_NTHREADS=4
+   for k=0, N_ELEMENTS(types)-1 do begin
+      t=types[k]
+      if (t EQ 1) OR (t GE 12 AND t LE 13) OR (t EQ 15) then v=FIX(ABS(raw), type=t) $
+      else v=FIX(raw, type=t)
+      name=TYPENAME(v)+(pass ? ' (threads)' : '')
+      ;
+      h=HISTOGRAM(v, binsize=7, reverse_indices=ri, omin=omin)
+      if TOTAL(h, /int) NE n then ERRORS_ADD, nb_errors, name+': total'
+      CHECK_REVERSE_INDICES, nb_errors, v, h, ri, omin, 7, name
+      if pass EQ 0 then ref=h $
+      else if ~ARRAY_EQUAL(h, ref) then ERRORS_ADD, nb_errors, name+': threads'
+      ;
+      ; a small window on the data
+      h=HISTOGRAM(v, min=100, max=199, binsize=1, reverse_indices=ri)
+      w=WHERE(v GE 100 AND v LE 199, cnt)
+      if (N_ELEMENTS(h) NE 100) OR (TOTAL(h, /int) NE cnt) then ERRORS_ADD, nb_errors, name+': window'
+      if cnt GT 0 then if ~ARRAY_EQUAL(ri[101:*], w[SORT(LONG(v[w])*n+w)]) then $
+         ERRORS_ADD, nb_errors, name+': window reverse indices'
+   endfor
+endfor
+CPU, /RESET
+;
+; strings are histogrammed as their DOUBLE values
+h=HISTOGRAM(['1','2','3','3'], reverse_indices=ri)
+if ~ARRAY_EQUAL(h, [1,1,2]) then ERRORS_ADD, nb_errors, 'STRING'
+if ~ARRAY_EQUAL(ri, [4,5,6,8,0,1,2,3]) then ERRORS_ADD, nb_errors, 'STRING: reverse indices'
+h=HISTOGRAM(['0.5','2.5'], binsize=1, min=0)
+if ~ARRAY_EQUAL(h, [1,0,1]) then ERRORS_ADD, nb_errors, 'STRING: binsize'
+;
+; ----------------- final messages ----------
+;
+BANNER_FOR_TESTSUITE, 'TEST_HISTOGRAM', nb_errors, short=short
+;
+if (nb_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+if KEYWORD_SET(test) then STOP
+;
+end
@@ -312,7 +312,42 @@ jj=where(ll eq findgen(5),nj)
 if(nj ne n_elements(vv) ) then $
     ERRORS_ADD, nb_errors, ' ll[vv]= findgen(5)'
 ll = 0
-   
+;
+; long lists are indexed through a node index, which must follow
+; appends, removals at both ends and any relinking (insert, move,
+; swap, reverse)
+;
+nb=200
+ll=LIST()
+ref=LINDGEN(nb)
+for k=0,nb-1 do ll.add, ref[k]
+if (ll[150] NE 150) then ERRORS_ADD, nb_errors, 'long list: ll[150] after add'
+ll.add, -1, 100 & ref=[ref[0:99],-1,ref[100:*]]
+if (ll[150] NE ref[150]) then ERRORS_ADD, nb_errors, 'long list: ll[150] after insert'
+dummy=ll.remove() & ref=ref[0:-2]
+dummy=ll.remove(0) & ref=ref[1:*]
+dummy=ll.remove(60) & ref=[ref[0:59],ref[61:*]]
+if (ll[150] NE ref[150]) then ERRORS_ADD, nb_errors, 'long list: ll[150] after remove'
+ll.swap, 40, 150 & tmp=ref[40] & ref[40]=ref[150] & ref[150]=tmp
+if (ll[150] NE ref[150]) then ERRORS_ADD, nb_errors, 'long list: ll[150] after swap'
+ll.move, 50, 120 & ref=[ref[0:49],ref[51:120],ref[50],ref[121:*]]
+if (ll[120] NE ref[120]) then ERRORS_ADD, nb_errors, 'long list: ll[120] after move'
+ll.reverse & ref=REVERSE(ref)
+for k=0,N_ELEMENTS(ref)-1 do ll.add, k
+ref=[ref,LINDGEN(N_ELEMENTS(ref))]
+res=LONARR(N_ELEMENTS(ref))
+for k=0,N_ELEMENTS(ref)-1 do res[k]=ll[k]
+if ~ARRAY_EQUAL(res, ref) then ERRORS_ADD, nb_errors, 'long list: indexing after reverse/add'
+if ~ARRAY_EQUAL(ll.toarray(), ref) then ERRORS_ADD, nb_errors, 'long list: toarray'
+ll = 0
+;
+; the index of a freed list must not be found by a new one
+for k=0,9 do begin
+   ll=LIST(LINDGEN(nb)+k*1000, /extract)
+   if (ll[150] NE k*1000+150) then ERRORS_ADD, nb_errors, 'long list: new list '+STRTRIM(k,2)
+endfor
+ll = 0
+
 ; ----------------- final messages ----------
 ;
 BANNER_FOR_TESTSUITE, 'TEST_LIST', nb_errors, short=short
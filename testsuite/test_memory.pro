@@ -5,4 +5,22 @@ pro test_memory
     message, 'reported memory consumption should increase after allocating a big array!', /conti
     exit, status=1
   endif
+  ; large temporaries in a loop: once the pool has seen a size, it should
+  ; be reused (the pool is off by default)
+  CPU, buffer_pool=512
+  b = a + 1
+  hits = memory(/pool_hits)
+  for i = 0, 4 do tmp = a * b + 2
+  if (memory(/pool_hits) le hits) then begin
+    message, 'large temporaries should be reused in a loop!', /conti
+    exit, status=1
+  endif
+  ; disabled: no reuse
+  CPU, buffer_pool=0
+  hits = memory(/pool_hits)
+  for i = 0, 4 do tmp = a * b + 2
+  if (memory(/pool_hits) ne hits) then begin
+    message, 'large temporaries should not be reused with the pool disabled!', /conti
+    exit, status=1
+  endif
 end
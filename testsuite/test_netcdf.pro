@@ -11,6 +11,57 @@
 ;
 ; Alain Coulais, 30 August 2013
 ;
+; 2026-10-16 : NCDF_VARGET/NCDF_VARPUT subsets (one library call each)
+;
+; --------------------------------------------
+;
+; subsets read by NCDF_VARGET compared to the subscripted full variable
+;
+pro TEST_NCDF_VARGET_SUBSET, cumul_errors
+;
+errors=0
+file='test_ncdf_varget_subset.nc'
+data=FINDGEN(10,7,4)
+;
+nc=NCDF_CREATE(file, /clobber)
+dx=NCDF_DIMDEF(nc, 'x', 10)
+dy=NCDF_DIMDEF(nc, 'y', 7)
+dz=NCDF_DIMDEF(nc, 'z', 4)
+vf=NCDF_VARDEF(nc, 'f', [dx,dy,dz], /float)
+vl=NCDF_VARDEF(nc, 'l', [dx,dy], /long)
+NCDF_CONTROL, nc, /endef
+NCDF_VARPUT, nc, vf, data
+NCDF_VARPUT, nc, vl, LINDGEN(10,7)
+; strided write: the odd columns
+NCDF_VARPUT, nc, vl, -LINDGEN(5,7), offset=[1,0], stride=[2,1]
+NCDF_CLOSE, nc
+;
+nc=NCDF_OPEN(file)
+NCDF_VARGET, nc, vf, full, chunk_cache_size=1024L^2
+if ~ARRAY_EQUAL(full, data) then ERRORS_ADD, errors, 'full read'
+;
+NCDF_VARGET, nc, vf, val, offset=[2,1,1], count=[5,3,2]
+if ~ARRAY_EQUAL(val, data[2:6,1:3,1:2]) then ERRORS_ADD, errors, 'offset+count'
+;
+NCDF_VARGET, nc, vf, val, offset=[1,0,0], count=[3,4,2], stride=[3,2,2]
+if ~ARRAY_EQUAL(val, data[1:7:3,0:6:2,0:3:2]) then ERRORS_ADD, errors, 'offset+count+stride'
+;
+; without COUNT: all the elements up to the end (10 by 3: 4 elements)
+NCDF_VARGET, nc, vf, val, stride=[3,1,1]
+if ~ARRAY_EQUAL(val, data[0:*:3,*,*]) then ERRORS_ADD, errors, 'stride only'
+;
+expected=LINDGEN(10,7)
+expected[1:*:2,*]=-LINDGEN(5,7)
+NCDF_VARGET, nc, vl, val
+if ~ARRAY_EQUAL(val, expected) || (TYPENAME(val) NE 'LONG') then $
+   ERRORS_ADD, errors, 'strided write'
+NCDF_CLOSE, nc
+FILE_DELETE, file
+;
+BANNER_FOR_TESTSUITE, 'TEST_NCDF_VARGET_SUBSET', errors, /short
+cumul_errors=cumul_errors+errors
+end
+;
 ; --------------------------------------------
 ;
 pro TEST_NETCDF
@@ -27,4 +78,8 @@ TEST_BUG_3057520
 TEST_BUG_3061072
 TEST_BUG_3100945
 ;
+cumul_errors=0
+TEST_NCDF_VARGET_SUBSET, cumul_errors
+if (cumul_errors GT 0) then EXIT, status=1
+;
 end
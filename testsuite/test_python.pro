@@ -15,4 +15,25 @@ pro test_python
     exit, status=1
   endif
 
+  ; arrays to python and back, the large results copied and used in
+  ; place (/NOCOPY)
+  foreach n, [259L, 300000L] do begin
+    arrays = LIST(UINDGEN(n), FINDGEN(n)/7., DINDGEN(n)/7d)
+    foreach a, arrays do begin
+      for nocopy = 0, 1 do begin
+        r = python("numpy", "copy", a, nocopy=nocopy)
+        ; the python reference is gone: python may reuse its memory
+        dummy = python("gc", "collect")
+        dummy = python("numpy", "ones", n)
+        if (SIZE(r, /type) ne SIZE(a, /type)) || ~ARRAY_EQUAL(r, a) || $
+           ~ARRAY_EQUAL(SIZE(r, /dim), SIZE(a, /dim)) then begin
+          message, /conti, 'round trip of '+TYPENAME(a)+'['+STRTRIM(n,2)+ $
+                   '], nocopy='+STRTRIM(nocopy,2)
+          exit, status=1
+        endif
+        r = 0 ; releases an adopted array
+      endfor
+    endforeach
+  endforeach
+
 end
@@ -0,0 +1,80 @@
+;
+; - 2026-10-16 : READ_CSV is native: column types, quotes, header and
+;   table header, RECORD_START, NUM_RECORDS, MISSING_VALUE, TYPES and
+;   a file large enough to be split in parallel
+;
+pro WRITE_LINES_FOR_READ_CSV, filename, lines
+OPENW, lun, filename, /get_lun
+PRINTF, lun, lines, format='(A)'
+FREE_LUN, lun
+end
+;
+pro TEST_READ_CSV, no_exit=no_exit, test=test
+;
+total_errors=0
+;
+file=FILEPATH('test_read_csv.csv', /tmp)
+WRITE_LINES_FOR_READ_CSV, file, $
+   ['# some table', $
+    'name, x, n, s', $
+    '"a, b",1.5,3,hello', $
+    '"say ""hi""",2E3,,x', $
+    '  ', $
+    'c,-1,5,world']
+;
+a=READ_CSV(file, n_table_header=1, header=header, table_header=th, count=count)
+if count ne 3 then ERRORS_ADD, total_errors, 'count'
+if ~ARRAY_EQUAL(header, ['name','x','n','s']) then ERRORS_ADD, total_errors, 'header'
+if th ne '# some table' then ERRORS_ADD, total_errors, 'table header'
+if ~ARRAY_EQUAL(TAG_NAMES(a), ['FIELD1','FIELD2','FIELD3','FIELD4']) then $
+   ERRORS_ADD, total_errors, 'tag names'
+if SIZE(a.field1, /type) ne 7 || ~ARRAY_EQUAL(a.field1, ['a, b','say "hi"','c']) then $
+   ERRORS_ADD, total_errors, 'quoted strings'
+if SIZE(a.field2, /type) ne 5 || ~ARRAY_EQUAL(a.field2, [1.5d, 2d3, -1d]) then $
+   ERRORS_ADD, total_errors, 'doubles'
+if SIZE(a.field3, /type) ne 3 || ~ARRAY_EQUAL(a.field3, [3, 0, 5]) then $
+   ERRORS_ADD, total_errors, 'longs'
+if ~ARRAY_EQUAL(a.field4, ['hello','x','world']) then ERRORS_ADD, total_errors, 'strings'
+;
+a=READ_CSV(file, n_table_header=1, missing_value=-99)
+if ~ARRAY_EQUAL(a.field3, [3, -99, 5]) then ERRORS_ADD, total_errors, 'missing value'
+;
+a=READ_CSV(file, record_start=1, num_records=2, count=count, types=['STRING','FLOAT'])
+if count ne 2 then ERRORS_ADD, total_errors, 'num_records'
+if SIZE(a.field2, /type) ne 4 || ~ARRAY_EQUAL(a.field2, [1.5, 2e3]) then $
+   ERRORS_ADD, total_errors, 'types'
+;
+; a table of strings: the header is the first value
+WRITE_LINES_FOR_READ_CSV, file, ['a,b','c,d']
+a=READ_CSV(file, header=header, count=count)
+if count ne 1 || ~ARRAY_EQUAL(a.field1, ['a','c']) || ~ARRAY_EQUAL(header, ['','']) then $
+   ERRORS_ADD, total_errors, 'strings only'
+;
+; GDL only: another separator
+WRITE_LINES_FOR_READ_CSV, file, ['i;x','1;"2;3"']
+a=READ_CSV(file, separator=';')
+if a.field1 ne 1 || a.field2 ne '2;3' then ERRORS_ADD, total_errors, 'separator'
+;
+; large enough for the parallel splitting
+n=300000L
+l=LINDGEN(n)
+WRITE_LINES_FOR_READ_CSV, file, ['i,x', STRTRIM(l,2)+','+STRTRIM(2*l,2)+'.5']
+a=READ_CSV(file, count=count)
+if count ne n then ERRORS_ADD, total_errors, 'large: count'
+if ~ARRAY_EQUAL(a.field1, l) then ERRORS_ADD, total_errors, 'large: longs'
+if ~ARRAY_EQUAL(a.field2, 2*l+0.5d) then ERRORS_ADD, total_errors, 'large: doubles'
+;
+FILE_DELETE, file
+;
+if READ_CSV(FILEPATH('test_read_csv_none.csv', /tmp), count=count) ne 0 || count ne 0 then $
+   ERRORS_ADD, total_errors, 'missing file'
+;
+; final message
+;
+BANNER_FOR_TESTSUITE, 'TEST_READ_CSV', total_errors
+;
+if KEYWORD_SET(test) then STOP
+;
+if (total_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+end
@@ -465,6 +465,50 @@ end
 ;
 ; -------------------------------------
 ;
+; READF of large arrays (free format) from a file: the values must be
+; exactly those strtod/strtol give, whatever notation is used
+;
+pro TEST_READF_LARGE, cumul_errors, verbose=verbose, test=test
+;
+errors=0
+;
+n=100000L
+x=(RANDOMU(seed, n, /DOUBLE)-0.5)*10d^(LINDGEN(n) MOD 30 - 15)
+i=LONG64(x*1d3)
+;
+filename='test_readf_large.txt'
+OPENW, lun, filename, /GET_LUN
+PRINTF, lun, STRTRIM(STRING(x[0:n/2-1], FORMAT='(G25.17)'),2), FORMAT='(5A30)'
+PRINTF, lun, STRTRIM(STRING(x[n/2:*], FORMAT='(E25.16)'),2), FORMAT='(3(A," "))'
+PRINTF, lun, i, FORMAT='(7I25)'
+PRINTF, lun, '1.5d3 -2.5D-2 1e 7.', FORMAT='(A)'
+FREE_LUN, lun
+;
+xx=DBLARR(n)
+ii=LON64ARR(n)
+ff=FLTARR(4)
+OPENR, lun, filename, /GET_LUN
+READF, lun, xx
+READF, lun, ii
+READF, lun, ff
+FREE_LUN, lun
+FILE_DELETE, filename
+;
+if ~ARRAY_EQUAL(xx, x) then ERRORS_ADD, errors, 'large DOUBLE array: bad values !'
+if ~ARRAY_EQUAL(ii, i) then ERRORS_ADD, errors, 'large LONG64 array: bad values !'
+if ~ARRAY_EQUAL(ff, [1.5e3, -2.5e-2, 1., 7.]) then ERRORS_ADD, errors, 'D exponents: bad values !'
+;
+; ----- final ----
+;
+BANNER_FOR_TESTSUITE, 'TEST_READF_LARGE', errors, /status
+ERRORS_CUMUL, cumul_errors, errors
+;
+if KEYWORD_SET(test) then STOP
+;
+end
+;
+; -------------------------------------
+;
 pro TEST_READS, help=help, verbose=verbose, no_exit=no_exit, test=test
 ;
 if KEYWORD_SET(help) then begin
@@ -489,6 +533,8 @@ TEST_READS_MIXED, errors, verbose=verbose, test=test
 ;
 TEST_READS_MIXING_TYPES, errors, verbose=verbose, test=test
 ;
+TEST_READF_LARGE, errors, verbose=verbose, test=test
+;
 ; ----------------- final message ----------
 ;
 BANNER_FOR_TESTSUITE, 'TEST_READS', errors, /status
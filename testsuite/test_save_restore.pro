@@ -16,6 +16,11 @@
 ; * cross-test : try to read back equivalent files,
 ;    generated by IDL or FL. FL tests are not good
 ; (some types are missing, /compress not working, 
+;
+; 2026-Oct-16:
+; * adding TEST_SR_LARGE : large arrays of all numeric types,
+;    in structures and pointers, with and without /compress
+; * adding TEST_SR_NAMES : keyword NAMES= of RESTORE
 ; 
 ; -----------------------------------------------
 ;
@@ -139,6 +144,14 @@ end
 ;
 pro TEST_SR_COMPRESS, total_errors, test=test, verbose=verbose
 ;
+; fourth test : large arrays (bulk conversion of the data)
+;
+TEST_SR_LARGE, total_errors, test=test, verbose=verbose
+;
+; fifth test : restoring some variables only (NAMES=)
+;
+TEST_SR_NAMES, total_errors, test=test, verbose=verbose
+;
 errors=0
 ;
 array=DIST(4,7)
@@ -180,6 +193,113 @@ if KEYWORD_SET(test) then STOP
 ;
 end
 ;
+;
+; -----------------------------------------------
+;
+; arrays larger than the chunks (1 MB) in which the data are
+; converted, full ranges of values (sign of INT, UINT > 32767,
+; special values), in structures and behind pointers,
+; with and without /compress
+;
+pro TEST_SR_LARGE, total_errors, test=test, verbose=verbose
+;
+; fifth test : restoring some variables only (NAMES=)
+;
+TEST_SR_NAMES, total_errors, test=test, verbose=verbose
+;
+errors=0
+;
+nb=300001L
+i_ref=FIX(LINDGEN(nb)*7-1000000)
+ui_ref=UINT(LINDGEN(nb)*3)
+l_ref=LINDGEN(nb)*7919L-1000000000L
+ul_ref=ULINDGEN(nb)*14321UL
+l64_ref=(L64INDGEN(nb)-150000)*123456789012LL
+f_ref=(FINDGEN(nb)-nb/2)/7.
+f_ref[0:2]=[!values.f_nan, !values.f_infinity, -0.]
+d_ref=(DINDGEN(nb)-nb/2)*1d-3/7d
+d_ref[0:2]=[!values.d_nan, -!values.d_infinity, 1d300]
+c_ref=COMPLEX(f_ref, -f_ref)
+dc_ref=DCOMPLEX(d_ref, d_ref/3)
+s_ref={a:i_ref[0:999], b:d_ref[0:999], c:'str'}
+p_ref=PTR_NEW(l_ref)
+;
+for compress=0, 1 do begin
+   file='sr_large_'+STRTRIM(compress,2)+'.xdr'
+   vi=i_ref & vui=ui_ref & vl=l_ref & vul=ul_ref & vl64=l64_ref
+   vf=f_ref & vd=d_ref & vc=c_ref & vdc=dc_ref & vs=s_ref & vp=p_ref
+   SAVE, vi, vui, vl, vul, vl64, vf, vd, vc, vdc, vs, vp, $
+         file=file, compress=compress
+   vi=0 & vui=0 & vl=0 & vul=0 & vl64=0
+   vf=0 & vd=0 & vc=0 & vdc=0 & vs=0 & vp=0
+   RESTORE, file
+   FILE_DELETE, file
+   txt=' (compress='+STRTRIM(compress,2)+')'
+   if ~ARRAY_EQUAL(vi, i_ref, /no_typeconv) then ERRORS_ADD, errors, 'INT'+txt
+   if ~ARRAY_EQUAL(vui, ui_ref, /no_typeconv) then ERRORS_ADD, errors, 'UINT'+txt
+   if ~ARRAY_EQUAL(vl, l_ref, /no_typeconv) then ERRORS_ADD, errors, 'LONG'+txt
+   if ~ARRAY_EQUAL(vul, ul_ref, /no_typeconv) then ERRORS_ADD, errors, 'ULONG'+txt
+   if ~ARRAY_EQUAL(vl64, l64_ref, /no_typeconv) then ERRORS_ADD, errors, 'LONG64'+txt
+   if ~ARRAY_EQUAL(vf[1:*], f_ref[1:*], /no_typeconv) OR FINITE(vf[0]) then $
+      ERRORS_ADD, errors, 'FLOAT'+txt
+   if ~ARRAY_EQUAL(vd[1:*], d_ref[1:*], /no_typeconv) OR FINITE(vd[0]) then $
+      ERRORS_ADD, errors, 'DOUBLE'+txt
+   if ~ARRAY_EQUAL(vc[1:*], c_ref[1:*], /no_typeconv) then ERRORS_ADD, errors, 'COMPLEX'+txt
+   if ~ARRAY_EQUAL(vdc[1:*], dc_ref[1:*], /no_typeconv) then ERRORS_ADD, errors, 'DCOMPLEX'+txt
+   if ~ARRAY_EQUAL(vs.a, s_ref.a, /no_typeconv) OR ~ARRAY_EQUAL(vs.b[1:*], s_ref.b[1:*]) $
+      OR (vs.c NE 'str') then ERRORS_ADD, errors, 'STRUCT'+txt
+   if ~PTR_VALID(vp) then ERRORS_ADD, errors, 'PTR'+txt $
+   else if ~ARRAY_EQUAL(*vp, l_ref, /no_typeconv) then ERRORS_ADD, errors, 'PTR data'+txt
+endfor
+PTR_FREE, p_ref
+;
+BANNER_FOR_TESTSUITE, "TEST_SR_LARGE", errors, /status, verb=verbose
+;
+ERRORS_CUMUL, total_errors, errors
+;
+if KEYWORD_SET(test) then STOP
+;
+end
+;
+; -----------------------------------------------
+;
+; NAMES= (GDL extension) : only the requested variables are restored
+;
+pro TEST_SR_NAMES, total_errors, test=test, verbose=verbose
+;
+errors=0
+;
+file='sr_names.xdr'
+big=FINDGEN(1000,1000)
+small=[1,2,3]
+other='other'
+p=PTR_NEW(small*2)
+SAVE, big, small, other, p, file=file
+big=0 & small=0 & other=0 & p=0
+;
+RESTORE, file, names='small'
+if ~ARRAY_EQUAL(small, [1,2,3], /no_typeconv) then ERRORS_ADD, errors, 'SMALL not restored'
+if ~ARRAY_EQUAL(big, 0) OR ~ARRAY_EQUAL(other, 0) OR ~ARRAY_EQUAL(p, 0) then $
+   ERRORS_ADD, errors, 'unrequested variables restored'
+;
+RESTORE, file, names=['Other', 'p', 'missing']
+if (other NE 'other') then ERRORS_ADD, errors, 'OTHER not restored'
+if ~PTR_VALID(p) then ERRORS_ADD, errors, 'P not restored' $
+else if ~ARRAY_EQUAL(*p, [2,4,6], /no_typeconv) then ERRORS_ADD, errors, 'bad *P'
+if ~ARRAY_EQUAL(big, 0) then ERRORS_ADD, errors, 'BIG restored'
+;
+RESTORE, file
+if ~ARRAY_EQUAL(big, FINDGEN(1000,1000)) then ERRORS_ADD, errors, 'BIG not restored'
+FILE_DELETE, file
+;
+BANNER_FOR_TESTSUITE, "TEST_SR_NAMES", errors, /status, verb=verbose
+;
+ERRORS_CUMUL, total_errors, errors
+;
+if KEYWORD_SET(test) then STOP
+;
+end
+;
 ; -----------------------------------------------
 ;
 pro TEST_SAVE_RESTORE, help=help, test=test, verbose=verbose
@@ -247,6 +367,14 @@ endfor
 ;
 TEST_SR_COMPRESS, total_errors, test=test, verbose=verbose
 ;
+; fourth test : large arrays (bulk conversion of the data)
+;
+TEST_SR_LARGE, total_errors, test=test, verbose=verbose
+;
+; fifth test : restoring some variables only (NAMES=)
+;
+TEST_SR_NAMES, total_errors, test=test, verbose=verbose
+;
 ; ---- Final message ----
 ;
 BANNER_FOR_TESTSUITE, 'TEST_SAVE_RESTORE', total_errors, short=short
@@ -11,6 +11,7 @@
 ; - 2019-10-31 : AC. Creation, from a suggestion of @maynardGK in #659
 ;                but the original WHERE() is remplace by a TOTAL()
 ;                (less side-effect expected TBC)
+; - 2026-10-16 : TEST_SORT_THREADS for the parallel sorts of large arrays
 ;
 ; ---------------------------------
 ;
@@ -33,6 +34,58 @@ end
 ;
 ; -------------------------------------------------
 ;
+;
+; large arrays are sorted in parallel: the sorted values (NaNs last)
+; must be those of the single thread sort, for all types
+;
+pro TEST_SORT_THREADS, cumul_errors, test=test
+;
+nb_errors=0
+;
+nbps=300000L
+val=RANDOMN(seed, nbps)*1000
+fval=val & fval[RANDOMU(seed, 100)*nbps]=!values.f_nan
+fval[0:9]=-0.0 & fval[10]=-!values.f_infinity & fval[11]=!values.f_infinity
+arrays=LIST(BYTE(val), FIX(val), UINT(val), LONG(val), ULONG(ABS(val)), $
+            LONG64(val*1e9), ULONG64(ABS(val)*1e9), fval, DOUBLE(fval), $
+            COMPLEX(val, 1), DCOMPLEX(val, -1), STRING(LONG(val)))
+;
+cpu_save=!CPU
+for k=0, arrays.Count()-1 do begin
+   a=arrays[k]
+   CPU, TPOOL_NTHREADS=1
+   ref=a[SORT(a)]
+   CPU, TPOOL_NTHREADS=4, TPOOL_MIN_ELTS=100000
+   ix=SORT(a)
+   ix64=SORT(a, /L64)
+   if ~ARRAY_EQUAL(ix[SORT(ix)], LINDGEN(nbps)) then $
+      ERRORS_ADD, nb_errors, TYPENAME(a)+': not a permutation'
+   res=a[ix]
+   if (SIZE(a, /type) EQ 4) OR (SIZE(a, /type) EQ 5) then begin
+      nan=FINITE(res, /nan)
+      if ~ARRAY_EQUAL(nan, FINITE(ref, /nan)) then $
+         ERRORS_ADD, nb_errors, TYPENAME(a)+': NaN not last'
+      ok=WHERE(~nan)
+      res=res[ok] & ref=ref[ok]
+   endif
+   if (SIZE(a, /type) EQ 6) OR (SIZE(a, /type) EQ 9) then begin
+      res=ABS(res) & ref=ABS(ref)
+   endif
+   if ~ARRAY_EQUAL(res, ref) then ERRORS_ADD, nb_errors, TYPENAME(a)+': bad order'
+   if ~ARRAY_EQUAL(ix64, ix) then ERRORS_ADD, nb_errors, TYPENAME(a)+': bad /L64 result'
+   CPU, RESTORE=cpu_save
+endfor
+;
+; ----- final ----
+;
+BANNER_FOR_TESTSUITE, 'TEST_SORT_THREADS', nb_errors, /short
+ERRORS_CUMUL, cumul_errors, nb_errors
+if KEYWORD_set(test) then STOP
+;
+end
+;
+; -------------------------------------------------
+;
 pro TEST_SORT, no_exit=no_exit, test=test
 ;
 TEST_SORT_NELEMENTS, cumul_errors, 50
@@ -43,6 +96,8 @@ TEST_SORT_NELEMENTS, cumul_errors, 280
 TEST_SORT_NELEMENTS, cumul_errors, 990
 TEST_SORT_NELEMENTS, cumul_errors, 1190
 ;
+TEST_SORT_THREADS, cumul_errors
+;
 ; ----------------- final message ----------
 ;
 BANNER_FOR_TESTSUITE, 'TEST_SORT', cumul_errors
@@ -104,6 +104,37 @@ endif else begin
     if KEYWORD_SET(verbose) then MESSAGE, /continue, 'test 3b OK'
 endelse
 
+;
+; large arrays (matched in parallel) must give the same results as the
+; elements one by one; the same patterns again come from the cache
+;
+big='x'+STRTRIM(LINDGEN(50000),2)+(['ab','aab','bc',''])[LINDGEN(50000) MOD 4]
+for pass=0,1 do begin
+   pos=STREGEX(big, 'a+b', length=len)
+   sub=STREGEX(big, 'x([0-9]+)(a*)', /SUBEXPR, /EXTRACT)
+   bool=STREGEX(big, '7$', /BOOLEAN)
+   bad=0
+   for i=0L, N_ELEMENTS(big)-1, 997 do begin
+      if (pos[i] NE STREGEX(big[i], 'a+b', length=l1)) OR (len[i] NE l1) then bad++
+      if ~ARRAY_EQUAL(sub[*,i], STREGEX(big[i], 'x([0-9]+)(a*)', /SUBEXPR, /EXTRACT)) then bad++
+      if bool[i] NE STREGEX(big[i], '7$', /BOOLEAN) then bad++
+   endfor
+   if (bad GT 0) OR (TOTAL(bool) NE 2500) then begin
+      if KEYWORD_SET(verbose) then MESSAGE, /continue, 'test 4 (large array) FAILED'
+      nb_errors=nb_errors+1
+   endif
+endfor
+;
+; an invalid pattern is still reported
+caught=0
+CATCH, err
+if err EQ 0 then resu=STREGEX(str, 'a(') else caught=1
+CATCH, /cancel
+if ~caught then begin
+   if KEYWORD_SET(verbose) then MESSAGE, /continue, 'test 5 (invalid pattern) FAILED'
+   nb_errors=nb_errors+1
+endif
+;
 if (nb_errors GT 0) then begin
     MESSAGE, /continue, STRING(nb_errors)+' Errors found'
     if ~KEYWORD_SET(test) then EXIT, status=1
@@ -41,5 +41,10 @@ pro test_strmatch
   err += assert('.()+{}|^$', '.()+{?^$', 0)
   err += assert('foot', 'f??t', 1)
   err += ~array_equal(strmatch(['gdl', 'GDL'], 'gdl'), [1,0])
+  err += assert('', '*', 1)
+  err += assert('abcabd', '*ab?', 1)
+  err += assert('aXb', 'a[x]b', 1, /fold)
+  err += assert('a[b', 'a[b', 1)
+  err += ~array_equal(strmatch([['gdl', 'GDL'],['gd', 'xgdl']], 'g*', /fold), [[1,1],[1,0]])
   if err ne 0 then exit, status=1
 end
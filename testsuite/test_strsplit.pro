@@ -357,6 +357,36 @@ endelse
 ;new version: supports arrays:
 res=strsplit(strarray,COUNT=c, LENGTH=l)
 ;
+; each element as for a scalar input
+if (N_ELEMENTS(res) NE N_ELEMENTS(strarray)) OR (N_ELEMENTS(l) NE N_ELEMENTS(strarray)) then begin
+   if KEYWORD_SET(verbose) then MESSAGE, 'error array: bad number of elements', /continue
+   nb_pbs=nb_pbs+1
+endif else begin
+   for i=0, N_ELEMENTS(strarray)-1 do begin
+      tab=STRSPLIT(strarray[i], COUNT=ci, LENGTH=li)
+      if ~ARRAY_EQUAL(res[i], tab, /NO_TYPECONV) OR (c[i] NE ci) OR ~ARRAY_EQUAL(l[i], li) then begin
+         if KEYWORD_SET(verbose) then MESSAGE, 'error array element '+STRTRIM(i,2), /continue
+         nb_pbs=nb_pbs+1
+      endif
+   endfor
+endelse
+;
+; a pattern per element, /EXTRACT, /REGEX
+res=STRSPLIT(['a,b;c', 'd;e,f'], [',', ';'], /extract, count=c)
+if ~ARRAY_EQUAL(res[0], ['a','b;c']) OR ~ARRAY_EQUAL(res[1], ['d','e,f']) OR ~ARRAY_EQUAL(c, [2,2]) then begin
+   if KEYWORD_SET(verbose) then MESSAGE, 'error array: pattern per element', /continue
+   nb_pbs=nb_pbs+1
+endif
+res=STRSPLIT(['a, b,,c', 'xy'], ', *', /regex, /extract)
+if ~ARRAY_EQUAL(res[0], ['a','b','c']) OR (res[1] NE 'xy') then begin
+   if KEYWORD_SET(verbose) then MESSAGE, 'error array: /regex', /continue
+   nb_pbs=nb_pbs+1
+endif
+if EXECUTE('res=STRSPLIT(strarray, [" ", "a"])') then begin
+   if KEYWORD_SET(verbose) then MESSAGE, 'error array: bad number of patterns accepted', /continue
+   nb_pbs=nb_pbs+1
+endif
+;
 line="======================================="
 MESSAGE, /Continue, line
 MESSAGE, /Continue, " "
@@ -0,0 +1,53 @@
+;
+; UNIQ (native since 2026; formerly uniq.pro)
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written with the native UNIQ
+;
+; --------------------------------------------------------------
+;
+pro TEST_UNIQ, help=help, verbose=verbose, short=short, $
+               no_exit=no_exit, test=test
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro TEST_UNIQ, help=help, verbose=verbose, short=short, $'
+   print, '               no_exit=no_exit, test=test'
+   return
+endif
+;
+nb_errors=0
+;
+if ~ARRAY_EQUAL(UNIQ([1,1,2,3,3,3,5]), [1,2,5,6]) then ERRORS_ADD, nb_errors, 'sorted'
+;
+; the last element is compared with the first one
+if ~ARRAY_EQUAL(UNIQ([1,2,1]), [0,1]) then ERRORS_ADD, nb_errors, 'wrap around'
+;
+res=UNIQ([1,1,1])
+if (N_ELEMENTS(res) NE 1) OR (res[0] NE 2) then ERRORS_ADD, nb_errors, 'all equal'
+if UNIQ([7]) NE 0 then ERRORS_ADD, nb_errors, 'one element'
+if ~ARRAY_EQUAL(UNIQ(['a','a','b']), [1,2]) then ERRORS_ADD, nb_errors, 'strings'
+;
+; unsorted input with SORT()
+b=[3,1,3,2,1]
+if ~ARRAY_EQUAL(b[UNIQ(b, SORT(b))], [1,2,3]) then ERRORS_ADD, nb_errors, 'with index'
+;
+; large (threaded) input
+CPU, TPOOL_MIN_ELTS=1000
+a=LONG(RANDOMU(seed, 1000000)*1000)
+s=a[SORT(a)]
+if ~ARRAY_EQUAL(UNIQ(s), WHERE(s NE SHIFT(s, -1))) then ERRORS_ADD, nb_errors, 'large sorted'
+ix=SORT(a)
+if ~ARRAY_EQUAL(UNIQ(a, ix), ix[WHERE(s NE SHIFT(s, -1))]) then ERRORS_ADD, nb_errors, 'large with index'
+CPU, /RESET
+;
+; ----------------- final messages ----------
+;
+BANNER_FOR_TESTSUITE, 'TEST_UNIQ', nb_errors, short=short
+;
+if (nb_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+if KEYWORD_SET(test) then STOP
+;
+end
@@ -0,0 +1,80 @@
+;
+; VALUE_LOCATE (native since 2026; formerly value_locate.pro)
+;
+; ----------
+; Modification history :
+;
+; * 2026-10-16 : initial version, written with the native VALUE_LOCATE
+; * 2026-10-16 : conversions of STRING and COMPLEX arguments
+;
+; --------------------------------------------------------------
+;
+pro TEST_VALUE_LOCATE, help=help, verbose=verbose, short=short, $
+                       no_exit=no_exit, test=test
+;
+if KEYWORD_SET(help) then begin
+   print, 'pro TEST_VALUE_LOCATE, help=help, verbose=verbose, short=short, $'
+   print, '                       no_exit=no_exit, test=test'
+   return
+endif
+;
+nb_errors=0
+;
+x=[1,2,2,5,8]
+u=[0,1,1.5,2,3,5,8,9,!values.f_nan]
+;
+; increasing: index of the last x[i] LE u, -1 below x[0]
+res=VALUE_LOCATE(x, u)
+if ~ARRAY_EQUAL(res, [-1,0,0,2,2,3,4,4,4]) then ERRORS_ADD, nb_errors, 'increasing'
+if SIZE(res, /type) NE 3 then ERRORS_ADD, nb_errors, 'increasing: type'
+;
+; decreasing: counted from the right
+res=VALUE_LOCATE(REVERSE(x), u)
+if ~ARRAY_EQUAL(res, [4,3,3,1,1,0,-1,-1,-1]) then ERRORS_ADD, nb_errors, 'decreasing'
+;
+; scalars, dimensions and L64
+res=VALUE_LOCATE(x, 3)
+if (SIZE(res, /n_dim) NE 0) OR (res NE 2) then ERRORS_ADD, nb_errors, 'scalar'
+res=VALUE_LOCATE(x, [3])
+if (SIZE(res, /n_dim) NE 1) OR (res[0] NE 2) then ERRORS_ADD, nb_errors, 'one element array'
+res=VALUE_LOCATE(x, REFORM(FINDGEN(6), 2, 3))
+if ~ARRAY_EQUAL(SIZE(res, /dim), [2,3]) then ERRORS_ADD, nb_errors, 'dimensions'
+if SIZE(VALUE_LOCATE(x, u, /l64), /type) NE 14 then ERRORS_ADD, nb_errors, 'L64'
+;
+; one element reference
+if ~ARRAY_EQUAL(VALUE_LOCATE([2], [1,2,3]), [-1,0,0]) then ERRORS_ADD, nb_errors, 'one element reference'
+;
+; strings become FLOAT, or DOUBLE if the other argument is DOUBLE
+; (0.7 is below 0.7d as FLOAT)
+if VALUE_LOCATE([0.7d], '0.7') NE 0 then ERRORS_ADD, nb_errors, 'string in double'
+if VALUE_LOCATE([0.7d], 0.7) NE -1 then ERRORS_ADD, nb_errors, 'float in double'
+if VALUE_LOCATE([0.7], '0.7') NE 0 then ERRORS_ADD, nb_errors, 'string in float'
+if ~ARRAY_EQUAL(VALUE_LOCATE(['1','2','3'], [2.5,0]), [1,-1]) then $
+   ERRORS_ADD, nb_errors, 'string reference'
+if VALUE_LOCATE(['0.7'], 0.7d) NE 0 then ERRORS_ADD, nb_errors, 'string reference, double value'
+;
+; complex values: their real part
+if ~ARRAY_EQUAL(VALUE_LOCATE(x, COMPLEX([1.5,6],[9,9])), [0,3]) then $
+   ERRORS_ADD, nb_errors, 'complex'
+;
+; integers are compared exactly (not as FLOAT)
+if VALUE_LOCATE([16777217L], 16777216L) NE -1 then ERRORS_ADD, nb_errors, 'large longs'
+;
+; large (threaded) input
+CPU, TPOOL_MIN_ELTS=1000
+u=RANDOMU(seed, 100000)*10
+res=VALUE_LOCATE(FINDGEN(11), u)
+if ~ARRAY_EQUAL(res, LONG(u)) then ERRORS_ADD, nb_errors, 'large input'
+res=VALUE_LOCATE(DINDGEN(11), LONG(u))
+if ~ARRAY_EQUAL(res, LONG(u)) then ERRORS_ADD, nb_errors, 'large integer input'
+CPU, /RESET
+;
+; ----------------- final messages ----------
+;
+BANNER_FOR_TESTSUITE, 'TEST_VALUE_LOCATE', nb_errors, short=short
+;
+if (nb_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+if KEYWORD_SET(test) then STOP
+;
+end
@@ -0,0 +1,71 @@
+;
+; - 2026-10-16 : WRITE_CSV is native: vectors, 2D arrays, structures,
+;   HEADER and TABLE_HEADER, and a file written by several threads
+;
+function LINES_OF_WRITE_CSV, filename
+n=FILE_LINES(filename)
+lines=STRARR(n)
+OPENR, lun, filename, /get_lun
+READF, lun, lines
+FREE_LUN, lun
+return, lines
+end
+;
+pro TEST_WRITE_CSV, no_exit=no_exit, test=test
+;
+total_errors=0
+;
+file=FILEPATH('test_write_csv.csv', /tmp)
+;
+; vectors: STRING() of the values without blanks, strings quoted
+WRITE_CSV, file, [1,2], [1.5,2.5d], ['a b','q"x']
+if ~ARRAY_EQUAL(LINES_OF_WRITE_CSV(file), $
+                ['1,1.5000000,"ab"','2,2.5000000,"q""x"']) then $
+   ERRORS_ADD, total_errors, 'vectors'
+WRITE_CSV, file, [0.25], [COMPLEX(1,2)]
+if ~ARRAY_EQUAL(LINES_OF_WRITE_CSV(file), ['0.250000,"(1,2)"']) then $
+   ERRORS_ADD, total_errors, 'float and complex'
+;
+; a 2D array: one line per row
+WRITE_CSV, file, [[1,2,3],[4,5,6]]
+if ~ARRAY_EQUAL(LINES_OF_WRITE_CSV(file), ['1,2,3','4,5,6']) then $
+   ERRORS_ADD, total_errors, '2D array'
+;
+; structures: the tag names are the header
+WRITE_CSV, file, {a:[1L,2], b:['x','y']}
+if ~ARRAY_EQUAL(LINES_OF_WRITE_CSV(file), ['"A","B"','1,"x"','2,"y"']) then $
+   ERRORS_ADD, total_errors, 'structure'
+WRITE_CSV, file, REPLICATE({a:1, b:2.5}, 2)
+if ~ARRAY_EQUAL(LINES_OF_WRITE_CSV(file), ['"A","B"','1,2.50000','1,2.50000']) then $
+   ERRORS_ADD, total_errors, 'structure array'
+;
+WRITE_CSV, file, [1,2], header=['n'], table_header=['my table']
+if ~ARRAY_EQUAL(LINES_OF_WRITE_CSV(file), ['my table','"n"','1','2']) then $
+   ERRORS_ADD, total_errors, 'header'
+;
+caught=0
+CATCH, err
+if err EQ 0 then WRITE_CSV, file, [1,2], [1,2,3] else caught=1
+CATCH, /cancel
+if ~caught then ERRORS_ADD, total_errors, 'different lengths'
+;
+; large enough for several threads, read back
+n=300000L
+l=LINDGEN(n)
+WRITE_CSV, file, {i:l, x:2*l+0.5d}
+a=READ_CSV(file, count=count)
+if count ne n then ERRORS_ADD, total_errors, 'large: count'
+if ~ARRAY_EQUAL(a.field1, l) then ERRORS_ADD, total_errors, 'large: longs'
+if ~ARRAY_EQUAL(a.field2, 2*l+0.5d) then ERRORS_ADD, total_errors, 'large: doubles'
+;
+FILE_DELETE, file
+;
+; final message
+;
+BANNER_FOR_TESTSUITE, 'TEST_WRITE_CSV', total_errors
+;
+if KEYWORD_SET(test) then STOP
+;
+if (total_errors GT 0) AND ~KEYWORD_SET(no_exit) then EXIT, status=1
+;
+end